@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ERPC_BENCH_HISTOGRAM_HPP_
+#define _ERPC_BENCH_HISTOGRAM_HPP_
+
+#include <cstdint>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Log-linear histogram of latencies in nanoseconds.
+ *
+ * Every power of two range is split into kSubBuckets linear buckets, so percentiles are reported
+ * with relative error below 1/kSubBuckets while memory stays constant for any number of samples.
+ * Minimum, maximum and mean are exact.
+ */
+class LatencyHistogram
+{
+public:
+    LatencyHistogram(void) { reset(); }
+
+    void reset(void)
+    {
+        (void)memset(m_counts, 0, sizeof(m_counts));
+        m_count = 0;
+        m_sum = 0;
+        m_min = UINT64_MAX;
+        m_max = 0;
+    }
+
+    void record(uint64_t value)
+    {
+        ++m_counts[bucketIndex(value)];
+        ++m_count;
+        m_sum += value;
+        if (value < m_min)
+        {
+            m_min = value;
+        }
+        if (value > m_max)
+        {
+            m_max = value;
+        }
+    }
+
+    uint64_t count(void) const { return m_count; }
+    uint64_t min(void) const { return (m_count != 0U) ? m_min : 0U; }
+    uint64_t max(void) const { return m_max; }
+    double mean(void) const { return (m_count != 0U) ? (double)m_sum / (double)m_count : 0.0; }
+
+    /*!
+     * @brief Returns value below which the given fraction of samples lies.
+     *
+     * @param[in] fraction Fraction in range 0..1, e.g. 0.99 for p99.
+     *
+     * @return Middle of the bucket containing the percentile, clamped to exact minimum and maximum.
+     */
+    uint64_t percentile(double fraction) const
+    {
+        uint64_t result = 0;
+        uint64_t rank;
+        uint64_t seen = 0;
+        uint32_t i;
+
+        if (m_count != 0U)
+        {
+            rank = (uint64_t)(fraction * (double)m_count + 0.5);
+            if (rank == 0U)
+            {
+                rank = 1U;
+            }
+            for (i = 0; i < kBucketCount; ++i)
+            {
+                seen += m_counts[i];
+                if (seen >= rank)
+                {
+                    result = bucketMiddle(i);
+                    break;
+                }
+            }
+            if (result < m_min)
+            {
+                result = m_min;
+            }
+            if (result > m_max)
+            {
+                result = m_max;
+            }
+        }
+
+        return result;
+    }
+
+private:
+    static const uint32_t kSubBucketBits = 5U;
+    static const uint32_t kSubBuckets = 1U << kSubBucketBits;
+    static const uint32_t kBucketCount = (64U - kSubBucketBits + 1U) * kSubBuckets;
+
+    uint64_t m_counts[kBucketCount];
+    uint64_t m_count;
+    uint64_t m_sum;
+    uint64_t m_min;
+    uint64_t m_max;
+
+    static uint32_t bucketIndex(uint64_t value)
+    {
+        uint32_t index;
+        uint32_t shift;
+
+        if (value < kSubBuckets)
+        {
+            index = (uint32_t)value;
+        }
+        else
+        {
+            shift = 63U - (uint32_t)__builtin_clzll(value) - kSubBucketBits;
+            index = (shift + 1U) * kSubBuckets + (uint32_t)((value >> shift) - kSubBuckets);
+        }
+
+        return index;
+    }
+
+    static uint64_t bucketMiddle(uint32_t index)
+    {
+        uint64_t value;
+        uint32_t shift;
+
+        if (index < kSubBuckets)
+        {
+            value = index;
+        }
+        else
+        {
+            shift = index / kSubBuckets - 1U;
+            value = ((uint64_t)(index % kSubBuckets + kSubBuckets) << shift) + (((uint64_t)1U << shift) >> 1U);
+        }
+
+        return value;
+    }
+};
+
+#endif // _ERPC_BENCH_HISTOGRAM_HPP_
@@ -0,0 +1,1059 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_bench_client.hpp"
+#include "erpc_bench_interface.hpp"
+#include "erpc_bench_server.hpp"
+
+#include "erpc_client_manager.h"
+#include "erpc_compact_codec.hpp"
+#include "erpc_compressing_transport.hpp"
+#include "erpc_crc16.hpp"
+#include "erpc_inter_thread_buffer_transport.hpp"
+#include "erpc_message_buffer.hpp"
+#include "erpc_port.h"
+#include "erpc_serial_transport.hpp"
+#if defined(__linux__)
+#include "erpc_shm_transport.hpp"
+#endif
+#include "erpc_simple_server.hpp"
+#include "erpc_tcp_transport.hpp"
+#include "erpc_version.h"
+
+#include "bench_histogram.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+using namespace erpcShim;
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#define BENCH_DEFAULT_ITERATIONS (10000U)
+#define BENCH_DEFAULT_WARMUP (100U)
+#define BENCH_DEFAULT_TCP_PORT (12350U)
+#define BENCH_DEFAULT_BINARY_SIZE (16384U)
+#define BENCH_DEFAULT_LIST_LENGTH (1024U)
+
+//! Space of the message buffer used by headers and other arguments of the largest call.
+#define BENCH_MESSAGE_OVERHEAD (128U)
+
+//! Number of segments in BenchRecord, as declared in erpc_bench.erpc.
+#define BENCH_RECORD_SEGMENTS (4U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////
+
+typedef std::chrono::steady_clock bench_clock_t;
+
+//! @brief Command line options.
+struct BenchOptions
+{
+    std::vector<std::string> transports;
+    std::vector<std::string> cases;
+    uint32_t iterations;
+    uint32_t warmup;
+    uint16_t tcpPort;
+    uint32_t binarySize;
+    uint32_t listLength;
+    bool compactCodec;
+    bool compress;
+    uint32_t compressThreshold;
+    const char *jsonPath;
+};
+
+//! @brief Inputs of benchmarked calls, prepared once before measurement.
+struct BenchData
+{
+    std::vector<uint8_t> binaryData;
+    binary_t binary;
+    std::vector<int32_t> listData;
+    list_int32_1_t list;
+    int64_t listSum;
+    BenchRecord record;
+    uint32_t onewayValue;
+};
+
+//! @brief Performs one benchmarked call, returns false when the result is wrong.
+typedef bool (*bench_call_t)(BenchService_client *client, BenchData *data);
+
+//! @brief Call shape measured by the benchmark.
+struct BenchCase
+{
+    const char *name;
+    bench_call_t call;
+    bool oneway;
+};
+
+//! @brief Measured results of one case on one transport.
+struct BenchResult
+{
+    std::string transport;
+    std::string name;
+    uint64_t calls;
+    uint64_t errors;
+    uint64_t bytes;
+    double seconds;
+    LatencyHistogram latency;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+//! Errors reported by client managers through the error handler.
+static std::atomic<uint32_t> s_clientErrors(0);
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+class BenchMessageBufferFactory : public MessageBufferFactory
+{
+public:
+    virtual MessageBuffer create(void) override
+    {
+        uint8_t *buf = new uint8_t[ERPC_DEFAULT_BUFFER_SIZE];
+        return MessageBuffer(buf, ERPC_DEFAULT_BUFFER_SIZE);
+    }
+
+    virtual void dispose(MessageBuffer *buf) override
+    {
+        erpc_assert(buf);
+        if (*buf)
+        {
+            delete[] buf->get();
+        }
+    }
+};
+
+/*!
+ * @brief Client side transport wrapper counting bytes of messages in both directions.
+ */
+class CountingTransport : public Transport
+{
+public:
+    explicit CountingTransport(Transport *transport) :
+    Transport(), m_transport(transport), m_bytes(0)
+    {
+    }
+
+    virtual uint8_t reserveHeaderSize(void) override { return m_transport->reserveHeaderSize(); }
+
+    virtual erpc_status_t receive(MessageBuffer *message) override
+    {
+        erpc_status_t err = m_transport->receive(message);
+
+        if (err == kErpcStatus_Success)
+        {
+            m_bytes += message->getUsed();
+        }
+
+        return err;
+    }
+
+    virtual erpc_status_t send(MessageBuffer *message) override
+    {
+        m_bytes += message->getUsed();
+        return m_transport->send(message);
+    }
+
+    virtual bool hasMessage(void) override { return m_transport->hasMessage(); }
+    virtual void setCrc16(Crc16 *crcImpl) override { m_transport->setCrc16(crcImpl); }
+    virtual Crc16 *getCrc16(void) override { return m_transport->getCrc16(); }
+
+    uint64_t bytes(void) const { return m_bytes; }
+
+private:
+    Transport *m_transport;
+    uint64_t m_bytes;
+};
+
+/*!
+ * @brief Server implementation, does the minimum work needed to produce correct replies.
+ */
+class BenchServiceImpl : public BenchService_interface
+{
+public:
+    BenchServiceImpl(void) :
+    m_onewayCount(0), m_running(true)
+    {
+    }
+
+    virtual void benchEmpty(void) override {}
+
+    virtual int64_t benchScalars(int8_t a, int16_t b, int32_t c, int64_t d, uint8_t e, uint16_t f, uint32_t g,
+                                 uint64_t h, float i, double j) override
+    {
+        return (int64_t)a + b + c + d + e + f + g + (int64_t)h + (int64_t)i + (int64_t)j;
+    }
+
+    virtual binary_t *benchBinary(const binary_t *data) override
+    {
+        binary_t *result = (binary_t *)erpc_malloc(sizeof(binary_t));
+
+        if (result != NULL)
+        {
+            result->data = (uint8_t *)erpc_malloc(data->dataLength);
+            result->dataLength = (result->data != NULL) ? data->dataLength : 0U;
+            if (result->data != NULL)
+            {
+                (void)memcpy(result->data, data->data, data->dataLength);
+            }
+        }
+
+        return result;
+    }
+
+    virtual void benchRecord(const BenchRecord *record, BenchRecord *result) override
+    {
+        *result = *record;
+        result->id = record->id + 1U;
+    }
+
+    virtual int64_t benchList(const list_int32_1_t *values) override
+    {
+        int64_t sum = 0;
+        uint32_t i;
+
+        for (i = 0; i < values->elementsCount; ++i)
+        {
+            sum += values->elements[i];
+        }
+
+        return sum;
+    }
+
+    virtual void benchOneway(uint32_t value) override
+    {
+        (void)value;
+        ++m_onewayCount;
+    }
+
+    virtual uint32_t benchOnewayCount(void) override { return m_onewayCount; }
+
+    virtual void benchQuit(void) override { m_running = false; }
+
+    bool isRunning(void) const { return m_running; }
+
+private:
+    uint32_t m_onewayCount;
+    volatile bool m_running;
+};
+
+/*!
+ * @brief Pair of connected client and server transports.
+ */
+class BenchLink
+{
+public:
+    virtual ~BenchLink(void) {}
+
+    virtual const char *name(void) const = 0;
+
+    virtual erpc_status_t open(const BenchOptions &options) = 0;
+
+    virtual void close(void) = 0;
+
+    virtual Transport *clientTransport(void) = 0;
+
+    virtual Transport *serverTransport(void) = 0;
+
+    //! Factory of client buffers, NULL for the common factory.
+    virtual MessageBufferFactory *clientMessageFactory(void) { return NULL; }
+
+    //! Factory of server buffers, NULL for the common factory.
+    virtual MessageBufferFactory *serverMessageFactory(void) { return NULL; }
+};
+
+class InterThreadLink : public BenchLink
+{
+public:
+    virtual const char *name(void) const override { return "inter_thread"; }
+
+    virtual erpc_status_t open(const BenchOptions &options) override
+    {
+        (void)options;
+        m_client.setMessageBufferFactory(&m_messageFactory);
+        m_server.setMessageBufferFactory(&m_messageFactory);
+        m_client.linkWithPeer(&m_server);
+        return kErpcStatus_Success;
+    }
+
+    virtual void close(void) override {}
+
+    virtual Transport *clientTransport(void) override { return &m_client; }
+
+    virtual Transport *serverTransport(void) override { return &m_server; }
+
+private:
+    // Buffers pass between client and server, stateless factory matches the one of client and server.
+    BenchMessageBufferFactory m_messageFactory;
+    InterThreadBufferTransport m_client;
+    InterThreadBufferTransport m_server;
+};
+
+class TcpLink : public BenchLink
+{
+public:
+    TcpLink(void) :
+    m_client(false), m_server(true)
+    {
+    }
+
+    virtual const char *name(void) const override { return "tcp"; }
+
+    virtual erpc_status_t open(const BenchOptions &options) override
+    {
+        erpc_status_t err;
+        uint32_t attempt;
+
+        m_server.configure("localhost", options.tcpPort);
+        m_client.configure("localhost", options.tcpPort);
+
+        err = m_server.open();
+
+        // Server socket is created by the server thread, give it time to listen.
+        for (attempt = 0; (err == kErpcStatus_Success) && (attempt < 100U); ++attempt)
+        {
+            err = m_client.open();
+            if (err == kErpcStatus_Success)
+            {
+                break;
+            }
+            err = kErpcStatus_Success;
+            Thread::sleep(10000);
+        }
+
+        return (attempt < 100U) ? err : kErpcStatus_ConnectionFailure;
+    }
+
+    // Server thread keeps accepting connections until the process exits.
+    virtual void close(void) override { (void)m_client.close(); }
+
+    virtual Transport *clientTransport(void) override { return &m_client; }
+
+    virtual Transport *serverTransport(void) override { return &m_server; }
+
+private:
+    TCPTransport m_client;
+    TCPTransport m_server;
+};
+
+#if defined(__linux__)
+/*!
+ * @brief Shared memory region mapped twice, client and server write messages in place into its slots.
+ */
+class ShmLink : public BenchLink
+{
+public:
+    ShmLink(void) :
+    m_clientFactory(&m_client), m_serverFactory(&m_server)
+    {
+        (void)snprintf(m_name, sizeof(m_name), "/erpc_bench_%d", (int)getpid());
+    }
+
+    virtual const char *name(void) const override { return "shm"; }
+
+    virtual erpc_status_t open(const BenchOptions &options) override
+    {
+        erpc_status_t err;
+
+        (void)options;
+
+        err = m_server.open(m_name, true);
+        if (err == kErpcStatus_Success)
+        {
+            err = m_client.open(m_name, false);
+        }
+
+        return err;
+    }
+
+    // Region is unlinked when the server transport is destroyed.
+    virtual void close(void) override {}
+
+    virtual Transport *clientTransport(void) override { return &m_client; }
+
+    virtual Transport *serverTransport(void) override { return &m_server; }
+
+    virtual MessageBufferFactory *clientMessageFactory(void) override { return &m_clientFactory; }
+
+    virtual MessageBufferFactory *serverMessageFactory(void) override { return &m_serverFactory; }
+
+private:
+    char m_name[32];
+    ShmTransport m_client;
+    ShmTransport m_server;
+    ShmMessageBufferFactory m_clientFactory;
+    ShmMessageBufferFactory m_serverFactory;
+};
+#endif
+
+/*!
+ * @brief Two pseudo terminals whose master sides are connected together.
+ *
+ * SerialTransport opens a device by name, so each side opens the slave of its own pseudo terminal and
+ * a relay thread per direction copies data between the masters, like a null modem cable would.
+ */
+class SerialLink : public BenchLink
+{
+public:
+    SerialLink(void) :
+    m_client(NULL), m_server(NULL), m_runRelay(false)
+    {
+        m_master[0] = -1;
+        m_master[1] = -1;
+    }
+
+    virtual ~SerialLink(void) { close(); }
+
+    virtual const char *name(void) const override { return "serial"; }
+
+    virtual erpc_status_t open(const BenchOptions &options) override
+    {
+        erpc_status_t err = kErpcStatus_Success;
+        uint32_t i;
+
+        (void)options;
+
+        for (i = 0; (err == kErpcStatus_Success) && (i < 2U); ++i)
+        {
+            m_master[i] = posix_openpt(O_RDWR | O_NOCTTY);
+            if ((m_master[i] < 0) || (grantpt(m_master[i]) != 0) || (unlockpt(m_master[i]) != 0))
+            {
+                err = kErpcStatus_InitFailed;
+            }
+            else
+            {
+                m_slave[i] = ptsname(m_master[i]);
+            }
+        }
+
+        if (err == kErpcStatus_Success)
+        {
+            m_client = new SerialTransport(m_slave[0].c_str(), 115200);
+            m_server = new SerialTransport(m_slave[1].c_str(), 115200);
+            err = m_client->init(0, 1);
+        }
+
+        if (err == kErpcStatus_Success)
+        {
+            err = m_server->init(0, 1);
+        }
+
+        if (err == kErpcStatus_Success)
+        {
+            m_runRelay = true;
+            m_relay[0] = std::thread(&SerialLink::relay, this, m_master[0], m_master[1]);
+            m_relay[1] = std::thread(&SerialLink::relay, this, m_master[1], m_master[0]);
+        }
+
+        return err;
+    }
+
+    virtual void close(void) override
+    {
+        uint32_t i;
+
+        m_runRelay = false;
+        for (i = 0; i < 2U; ++i)
+        {
+            if (m_relay[i].joinable())
+            {
+                m_relay[i].join();
+            }
+        }
+
+        delete m_client;
+        m_client = NULL;
+        delete m_server;
+        m_server = NULL;
+
+        for (i = 0; i < 2U; ++i)
+        {
+            if (m_master[i] >= 0)
+            {
+                (void)::close(m_master[i]);
+                m_master[i] = -1;
+            }
+        }
+    }
+
+    virtual Transport *clientTransport(void) override { return m_client; }
+
+    virtual Transport *serverTransport(void) override { return m_server; }
+
+private:
+    SerialTransport *m_client;
+    SerialTransport *m_server;
+    int m_master[2];
+    std::string m_slave[2];
+    std::thread m_relay[2];
+    std::atomic<bool> m_runRelay;
+
+    void relay(int from, int to)
+    {
+        uint8_t buffer[4096];
+        struct pollfd pfd;
+        ssize_t length;
+        ssize_t written;
+        ssize_t offset;
+
+        pfd.fd = from;
+        pfd.events = POLLIN;
+
+        while (m_runRelay)
+        {
+            // Timeout lets the thread notice the stop request.
+            if (poll(&pfd, 1, 100) <= 0)
+            {
+                continue;
+            }
+
+            length = read(from, buffer, sizeof(buffer));
+            for (offset = 0; (length > 0) && (offset < length); offset += written)
+            {
+                written = write(to, &buffer[offset], (size_t)(length - offset));
+                if (written <= 0)
+                {
+                    break;
+                }
+            }
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmark cases
+////////////////////////////////////////////////////////////////////////////////
+
+static bool benchEmpty(BenchService_client *client, BenchData *data)
+{
+    (void)data;
+    client->benchEmpty();
+    return true;
+}
+
+static bool benchScalars(BenchService_client *client, BenchData *data)
+{
+    (void)data;
+    return client->benchScalars(-1, -2, -3, -4, 5, 6, 7, 8, 9.0f, 10.0) == 35;
+}
+
+static bool benchBinary(BenchService_client *client, BenchData *data)
+{
+    bool ok;
+    binary_t *result = client->benchBinary(&data->binary);
+
+    ok = (result != NULL) && (result->dataLength == data->binary.dataLength);
+    if (result != NULL)
+    {
+        erpc_free(result->data);
+        erpc_free(result);
+    }
+
+    return ok;
+}
+
+static bool benchRecord(BenchService_client *client, BenchData *data)
+{
+    BenchRecord result;
+
+    result.id = 0;
+    client->benchRecord(&data->record, &result);
+
+    return result.id == data->record.id + 1U;
+}
+
+static bool benchList(BenchService_client *client, BenchData *data)
+{
+    return client->benchList(&data->list) == data->listSum;
+}
+
+static bool benchOneway(BenchService_client *client, BenchData *data)
+{
+    client->benchOneway(data->onewayValue++);
+    return true;
+}
+
+static const BenchCase s_cases[] = {
+    { "empty", benchEmpty, false },   { "scalars", benchScalars, false }, { "binary", benchBinary, false },
+    { "struct", benchRecord, false }, { "list", benchList, false },       { "oneway", benchOneway, true },
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+static void benchErrorHandler(erpc_status_t err, uint32_t functionID)
+{
+    (void)functionID;
+
+    // Handler is invoked after every call.
+    if (err != kErpcStatus_Success)
+    {
+        ++s_clientErrors;
+    }
+}
+
+static bool isSelected(const std::vector<std::string> &selection, const char *name)
+{
+    bool selected = selection.empty();
+    size_t i;
+
+    for (i = 0; !selected && (i < selection.size()); ++i)
+    {
+        selected = (selection[i] == name);
+    }
+
+    return selected;
+}
+
+static void prepareData(const BenchOptions &options, BenchData &data)
+{
+    uint32_t i;
+    uint32_t j;
+
+    data.binaryData.resize(options.binarySize);
+    for (i = 0; i < options.binarySize; ++i)
+    {
+        data.binaryData[i] = (uint8_t)i;
+    }
+    data.binary.data = data.binaryData.data();
+    data.binary.dataLength = options.binarySize;
+
+    data.listData.resize(options.listLength);
+    data.listSum = 0;
+    for (i = 0; i < options.listLength; ++i)
+    {
+        data.listData[i] = (int32_t)(i * 7U) - 1000;
+        data.listSum += data.listData[i];
+    }
+    data.list.elements = data.listData.data();
+    data.list.elementsCount = options.listLength;
+
+    data.record.id = 1;
+    for (i = 0; i < BENCH_RECORD_SEGMENTS; ++i)
+    {
+        j = i * 6U;
+        data.record.segments[i].start.x = (int32_t)j;
+        data.record.segments[i].start.y = (int32_t)j + 1;
+        data.record.segments[i].start.z = (int32_t)j + 2;
+        data.record.segments[i].end.x = (int32_t)j + 3;
+        data.record.segments[i].end.y = (int32_t)j + 4;
+        data.record.segments[i].end.z = (int32_t)j + 5;
+        data.record.segments[i].color = 0xff00ffU;
+    }
+    data.record.anchor.x = -1;
+    data.record.anchor.y = -2;
+    data.record.anchor.z = -3;
+    data.record.weight = 0.5f;
+    data.record.valid = true;
+
+    data.onewayValue = 0;
+}
+
+static void runCase(const BenchCase &benchCase, BenchService_client *client, CountingTransport *counter,
+                    const BenchOptions &options, BenchData &data, BenchResult &result)
+{
+    bench_clock_t::time_point start;
+    bench_clock_t::time_point callStart;
+    bench_clock_t::time_point callEnd;
+    uint32_t errorsBefore;
+    uint32_t onewayBefore = 0;
+    uint64_t bytesBefore;
+    uint32_t i;
+
+    for (i = 0; i < options.warmup; ++i)
+    {
+        (void)benchCase.call(client, &data);
+    }
+
+    if (benchCase.oneway)
+    {
+        onewayBefore = client->benchOnewayCount();
+    }
+
+    result.name = benchCase.name;
+    result.calls = options.iterations;
+    result.errors = 0;
+    result.latency.reset();
+    errorsBefore = s_clientErrors;
+    bytesBefore = counter->bytes();
+    start = bench_clock_t::now();
+
+    for (i = 0; i < options.iterations; ++i)
+    {
+        callStart = bench_clock_t::now();
+        if (!benchCase.call(client, &data))
+        {
+            ++result.errors;
+        }
+        callEnd = bench_clock_t::now();
+        result.latency.record(
+            (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(callEnd - callStart).count());
+    }
+
+    // Oneway throughput includes the time the server needs to process all of them.
+    if (benchCase.oneway && (client->benchOnewayCount() - onewayBefore != options.iterations))
+    {
+        ++result.errors;
+    }
+
+    result.seconds = std::chrono::duration<double>(bench_clock_t::now() - start).count();
+    result.bytes = counter->bytes() - bytesBefore;
+    result.errors += s_clientErrors - errorsBefore;
+}
+
+static void runServer(SimpleServer *server, BenchServiceImpl *impl)
+{
+    while (impl->isRunning())
+    {
+        (void)server->poll();
+    }
+}
+
+static erpc_status_t runLink(BenchLink &link, const BenchOptions &options, BenchData &data,
+                             std::vector<BenchResult> &results)
+{
+    erpc_status_t err;
+    size_t i;
+
+    err = link.open(options);
+    if (err != kErpcStatus_Success)
+    {
+        (void)fprintf(stderr, "erpc_bench: %s transport failed to open (%d)\n", link.name(), (int)err);
+        return err;
+    }
+
+    Crc16 crc16;
+    BenchMessageBufferFactory messageFactory;
+    BasicCodecFactory basicCodecFactory;
+    CompactCodecFactory compactCodecFactory;
+    CodecFactory *codecFactory =
+        options.compactCodec ? static_cast<CodecFactory *>(&compactCodecFactory) : &basicCodecFactory;
+
+    MessageBufferFactory *serverMessageFactory =
+        (link.serverMessageFactory() != NULL) ? link.serverMessageFactory() : &messageFactory;
+    MessageBufferFactory *clientMessageFactory =
+        (link.clientMessageFactory() != NULL) ? link.clientMessageFactory() : &messageFactory;
+
+    // Bytes are counted below the compressing transport, as they are sent.
+    link.serverTransport()->setCrc16(&crc16);
+    CountingTransport counter(link.clientTransport());
+    counter.setCrc16(&crc16);
+    CompressingTransport serverCompressing;
+    CompressingTransport clientCompressing;
+    if (options.compress)
+    {
+        err = serverCompressing.init(link.serverTransport(), serverMessageFactory, options.compressThreshold);
+        if (err == kErpcStatus_Success)
+        {
+            err = clientCompressing.init(&counter, clientMessageFactory, options.compressThreshold);
+        }
+        if (err != kErpcStatus_Success)
+        {
+            (void)fprintf(stderr, "erpc_bench: compressing transport failed to init (%d)\n", (int)err);
+            link.close();
+            return err;
+        }
+    }
+
+    BenchServiceImpl serviceImpl;
+    BenchService_service service(&serviceImpl);
+    SimpleServer server;
+    server.setTransport(options.compress ? static_cast<Transport *>(&serverCompressing) : link.serverTransport());
+    server.setCodecFactory(codecFactory);
+    server.setMessageBufferFactory(serverMessageFactory);
+    server.addService(&service);
+    std::thread serverThread(runServer, &server, &serviceImpl);
+
+    ClientManager clientManager;
+    clientManager.setTransport(options.compress ? static_cast<Transport *>(&clientCompressing) : &counter);
+    clientManager.setCodecFactory(codecFactory);
+    clientManager.setMessageBufferFactory(clientMessageFactory);
+    clientManager.setErrorHandler(benchErrorHandler);
+    BenchService_client client(&clientManager);
+
+    for (i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); ++i)
+    {
+        if (isSelected(options.cases, s_cases[i].name))
+        {
+            results.push_back(BenchResult());
+            results.back().transport = link.name();
+            runCase(s_cases[i], &client, &counter, options, data, results.back());
+        }
+    }
+
+    client.benchQuit();
+    serverThread.join();
+    link.close();
+
+    return err;
+}
+
+static void printTable(FILE *out, const std::vector<BenchResult> &results)
+{
+    size_t i;
+
+    (void)fprintf(out, "%-13s %-8s %10s %7s %10s %10s %10s %12s %12s\n", "transport", "case", "calls", "errors",
+                  "p50 [us]", "p99 [us]", "p999 [us]", "calls/s", "MB/s");
+    for (i = 0; i < results.size(); ++i)
+    {
+        const BenchResult &r = results[i];
+        (void)fprintf(out, "%-13s %-8s %10llu %7llu %10.2f %10.2f %10.2f %12.0f %12.2f\n", r.transport.c_str(),
+                      r.name.c_str(), (unsigned long long)r.calls, (unsigned long long)r.errors,
+                      r.latency.percentile(0.5) / 1000.0, r.latency.percentile(0.99) / 1000.0,
+                      r.latency.percentile(0.999) / 1000.0, r.calls / r.seconds, r.bytes / r.seconds / 1e6);
+    }
+}
+
+static void printJson(FILE *out, const BenchOptions &options, const std::vector<BenchResult> &results)
+{
+    size_t i;
+
+    (void)fprintf(out, "{\n");
+    (void)fprintf(out, "  \"erpc_version\": \"%s\",\n", ERPC_VERSION);
+    (void)fprintf(out,
+                  "  \"config\": {\"buffer_size\": %u, \"large_messages\": %s, \"iterations\": %u, \"warmup\": %u, "
+                  "\"binary_size\": %u, \"list_length\": %u, \"codec\": \"%s\", "
+                  "\"compress_threshold\": %ld},\n",
+                  (unsigned)ERPC_DEFAULT_BUFFER_SIZE, ERPC_LARGE_MESSAGES ? "true" : "false", options.iterations,
+                  options.warmup, options.binarySize, options.listLength, options.compactCodec ? "compact" : "basic",
+                  options.compress ? (long)options.compressThreshold : -1L);
+    (void)fprintf(out, "  \"results\": [\n");
+    for (i = 0; i < results.size(); ++i)
+    {
+        const BenchResult &r = results[i];
+        (void)fprintf(out,
+                      "    {\"transport\": \"%s\", \"case\": \"%s\", \"calls\": %llu, \"errors\": %llu, "
+                      "\"seconds\": %.6f, \"calls_per_sec\": %.1f, \"bytes\": %llu, \"bytes_per_sec\": %.1f, "
+                      "\"latency_ns\": {\"min\": %llu, \"mean\": %.1f, \"p50\": %llu, \"p99\": %llu, "
+                      "\"p999\": %llu, \"max\": %llu}}%s\n",
+                      r.transport.c_str(), r.name.c_str(), (unsigned long long)r.calls, (unsigned long long)r.errors,
+                      r.seconds, r.calls / r.seconds, (unsigned long long)r.bytes, r.bytes / r.seconds,
+                      (unsigned long long)r.latency.min(), r.latency.mean(),
+                      (unsigned long long)r.latency.percentile(0.5), (unsigned long long)r.latency.percentile(0.99),
+                      (unsigned long long)r.latency.percentile(0.999), (unsigned long long)r.latency.max(),
+                      (i + 1U < results.size()) ? "," : "");
+    }
+    (void)fprintf(out, "  ]\n}\n");
+}
+
+static void splitList(const char *text, std::vector<std::string> &items)
+{
+    std::string item;
+    const char *p;
+
+    items.clear();
+    for (p = text; ; ++p)
+    {
+        if ((*p == ',') || (*p == '\0'))
+        {
+            if (!item.empty() && (item != "all"))
+            {
+                items.push_back(item);
+            }
+            item.clear();
+            if (*p == '\0')
+            {
+                break;
+            }
+        }
+        else
+        {
+            item += *p;
+        }
+    }
+}
+
+static void printUsage(void)
+{
+    (void)printf(
+        "Usage: erpc_bench [options]\n"
+        "  --transport LIST   inter_thread,tcp,serial,shm (default all)\n"
+        "  --case LIST        empty,scalars,binary,struct,list,oneway (default all)\n"
+        "  --iterations N     measured calls per case (default %u)\n"
+        "  --warmup N         calls before measurement (default %u)\n"
+        "  --tcp-port PORT    loopback port of the tcp transport (default %u)\n"
+        "  --binary-size N    bytes sent and received by the binary case (default %u)\n"
+        "  --list-length N    elements of the list case (default %u)\n"
+        "  --codec NAME       basic or compact message format (default basic)\n"
+        "  --compress N       compress messages of N and more bytes by CompressingTransport\n"
+        "  --json FILE        write results as JSON, '-' for standard output\n",
+        BENCH_DEFAULT_ITERATIONS, BENCH_DEFAULT_WARMUP, BENCH_DEFAULT_TCP_PORT, BENCH_DEFAULT_BINARY_SIZE,
+        BENCH_DEFAULT_LIST_LENGTH);
+}
+
+static bool parseOptions(int argc, char **argv, BenchOptions &options)
+{
+    bool ok = true;
+    int i;
+
+    options.iterations = BENCH_DEFAULT_ITERATIONS;
+    options.warmup = BENCH_DEFAULT_WARMUP;
+    options.tcpPort = BENCH_DEFAULT_TCP_PORT;
+    options.binarySize = BENCH_DEFAULT_BINARY_SIZE;
+    options.listLength = BENCH_DEFAULT_LIST_LENGTH;
+    options.compactCodec = false;
+    options.compress = false;
+    options.compressThreshold = 0;
+    options.jsonPath = NULL;
+
+    for (i = 1; ok && (i < argc); ++i)
+    {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (value == NULL)
+        {
+            ok = false;
+        }
+        else if (strcmp(arg, "--transport") == 0)
+        {
+            splitList(value, options.transports);
+        }
+        else if (strcmp(arg, "--case") == 0)
+        {
+            splitList(value, options.cases);
+        }
+        else if (strcmp(arg, "--iterations") == 0)
+        {
+            options.iterations = (uint32_t)strtoul(value, NULL, 0);
+        }
+        else if (strcmp(arg, "--warmup") == 0)
+        {
+            options.warmup = (uint32_t)strtoul(value, NULL, 0);
+        }
+        else if (strcmp(arg, "--tcp-port") == 0)
+        {
+            options.tcpPort = (uint16_t)strtoul(value, NULL, 0);
+        }
+        else if (strcmp(arg, "--binary-size") == 0)
+        {
+            options.binarySize = (uint32_t)strtoul(value, NULL, 0);
+        }
+        else if (strcmp(arg, "--list-length") == 0)
+        {
+            options.listLength = (uint32_t)strtoul(value, NULL, 0);
+        }
+        else if (strcmp(arg, "--codec") == 0)
+        {
+            options.compactCodec = (strcmp(value, "compact") == 0);
+            ok = options.compactCodec || (strcmp(value, "basic") == 0);
+        }
+        else if (strcmp(arg, "--compress") == 0)
+        {
+            options.compress = true;
+            options.compressThreshold = (uint32_t)strtoul(value, NULL, 0);
+        }
+        else if (strcmp(arg, "--json") == 0)
+        {
+            options.jsonPath = value;
+        }
+        else
+        {
+            ok = false;
+        }
+        ++i;
+    }
+
+    if (ok && ((options.iterations == 0U) ||
+               (options.binarySize + BENCH_MESSAGE_OVERHEAD > ERPC_DEFAULT_BUFFER_SIZE) ||
+               (options.listLength * sizeof(int32_t) + BENCH_MESSAGE_OVERHEAD > ERPC_DEFAULT_BUFFER_SIZE)))
+    {
+        (void)fprintf(stderr, "erpc_bench: iterations must be non-zero and payloads must fit into %u B buffers\n",
+                      (unsigned)ERPC_DEFAULT_BUFFER_SIZE);
+        ok = false;
+    }
+
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    BenchOptions options;
+    BenchData data;
+    std::vector<BenchResult> results;
+    InterThreadLink interThreadLink;
+    TcpLink tcpLink;
+    SerialLink serialLink;
+#if defined(__linux__)
+    ShmLink shmLink;
+    BenchLink *links[] = { &interThreadLink, &tcpLink, &serialLink, &shmLink };
+#else
+    BenchLink *links[] = { &interThreadLink, &tcpLink, &serialLink };
+#endif
+    FILE *json = NULL;
+    int status = 0;
+    size_t i;
+
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage();
+        return 1;
+    }
+
+    prepareData(options, data);
+
+    for (i = 0; i < sizeof(links) / sizeof(links[0]); ++i)
+    {
+        if (isSelected(options.transports, links[i]->name()) &&
+            (runLink(*links[i], options, data, results) != kErpcStatus_Success))
+        {
+            status = 1;
+        }
+    }
+
+    for (i = 0; i < results.size(); ++i)
+    {
+        if (results[i].errors != 0U)
+        {
+            status = 1;
+        }
+    }
+
+    if (options.jsonPath == NULL)
+    {
+        printTable(stdout, results);
+    }
+    else if (strcmp(options.jsonPath, "-") == 0)
+    {
+        printJson(stdout, options, results);
+    }
+    else
+    {
+        printTable(stdout, results);
+        json = fopen(options.jsonPath, "w");
+        if (json == NULL)
+        {
+            (void)fprintf(stderr, "erpc_bench: cannot write %s\n", options.jsonPath);
+            status = 1;
+        }
+        else
+        {
+            printJson(json, options, results);
+            (void)fclose(json);
+        }
+    }
+
+    return status;
+}
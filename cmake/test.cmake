@@ -72,7 +72,7 @@ function(add_erpc_test)
 
     set_ifndef(__TEST_SOURCES
         ${TEST_COMMON_DIR}/unit_test_${__TRANSPORT}_${__TEST_TYPE}.cpp
-        ${TEST_SOURCE_DIR}/${TEST_NAME}_${__TEST_TYPE}_impl.cpp
+        ${TEST_IMPL_DIR}/${TEST_IMPL_NAME}_${__TEST_TYPE}_impl.cpp
 
         ${ERPC_ERPCGEN}/src/Logging.cpp
         ${__TEST_ERPC_FILES}
@@ -109,6 +109,14 @@ function(add_erpc_test)
         add_definitions(-DUNIT_TEST_TCP_PORT=${CONFIG_ERPC_TESTS.transport.tcp.port})
     endif()
 
+    if(CONFIG_ERPC_TESTS.codec.compact)
+        add_definitions(-DUNIT_TEST_COMPACT_CODEC=1)
+    endif()
+
+    if(CONFIG_ERPC_TESTS.transport.compressing)
+        add_definitions(-DUNIT_TEST_COMPRESSION_THRESHOLD=${CONFIG_ERPC_TESTS.transport.compressing.threshold})
+    endif()
+
     # Add test_name target to build current test
     if(NOT TARGET ${TEST_NAME})
         add_custom_target(${TEST_NAME})
@@ -144,6 +152,10 @@ macro(generate_erpc_test_variables)
     # IDL file
     set(IDL_FILE ${TEST_SOURCE_DIR}/${TEST_NAME}.erpc)
 
+    # Client and server implementation; variant of other test case (test_lists_arena, ...) can reuse its sources
+    set(TEST_IMPL_NAME ${TEST_NAME})
+    set(TEST_IMPL_DIR ${TEST_SOURCE_DIR})
+
     # Config directory
     set(CONFIG_DIR ${TEST_COMMON_DIR}/config)
 
@@ -43,6 +43,20 @@
 #define ERPC_NESTED_CALLS_DETECTION_DISABLED (0U) //!< Nested calls detection disabled.
 #define ERPC_NESTED_CALLS_DETECTION_ENABLED (1U)  //!< Nested calls detection enabled.
 
+#define ERPC_ASYNC_CALLS_DISABLED (0U) //!< No asynchronous calls support.
+#define ERPC_ASYNC_CALLS_ENABLED (1U)  //!< Asynchronous calls support.
+
+#define ERPC_CRC16_IMPLEMENTATION_BITWISE (0U)      //!< CRC16 computed bit by bit, smallest code.
+#define ERPC_CRC16_IMPLEMENTATION_TABLE (1U)        //!< CRC16 computed with 512 B lookup table.
+#define ERPC_CRC16_IMPLEMENTATION_SLICING_BY_8 (2U) //!< CRC16 computed 8 bytes at once with 4 KB lookup tables.
+#define ERPC_CRC16_IMPLEMENTATION_PORT (3U)         //!< CRC16 computed by erpc_crc16_port_compute() of the port.
+
+#define ERPC_LARGE_MESSAGES_DISABLED (0U) //!< 16-bit message sizes, messages up to 64 KB.
+#define ERPC_LARGE_MESSAGES_ENABLED (1U)  //!< 32-bit message sizes, messages up to 4 GB.
+
+#define ERPC_SERVICE_DISPATCH_TABLE_DISABLED (0U) //!< Services are searched in linked list.
+#define ERPC_SERVICE_DISPATCH_TABLE_ENABLED (1U)  //!< Services are indexed by service ID.
+
 #define ERPC_MESSAGE_LOGGING_DISABLED (0U) //!< Trace functions disabled.
 #define ERPC_MESSAGE_LOGGING_ENABLED (1U)  //!< Trace functions enabled.
 
@@ -54,6 +68,15 @@
 
 #define ERPC_PRE_POST_ACTION_DEFAULT_DISABLED (0U) //!< Pre post shim default callbacks functions disabled.
 #define ERPC_PRE_POST_ACTION_DEFAULT_ENABLED (1U)  //!< Pre post shim default callback functions enabled.
+
+#define ERPC_STATS_DISABLED (0U) //!< Call statistics disabled.
+#define ERPC_STATS_ENABLED (1U)  //!< Call statistics enabled.
+
+#define ERPC_CLIENT_REQUEST_CACHE_DISABLED (0U) //!< Codec and message buffer allocated for each client request.
+#define ERPC_CLIENT_REQUEST_CACHE_ENABLED (1U)  //!< Codec and message buffer cached for each calling thread.
+
+#define ERPC_SERVER_ARENA_DISABLED (0U) //!< Server shims allocate decoded parameters by erpc_malloc().
+#define ERPC_SERVER_ARENA_ENABLED (1U)  //!< Server shims allocate decoded parameters from per-request arena.
 //@}
 
 #ifdef MCUXPRESSO_SDK
@@ -98,6 +121,14 @@
 //! ERPC_ALLOCATION_POLICY_STATIC. Default value 1 (Most of current cases).
 // #define ERPC_CLIENTS_THREADS_AMOUNT (1U)
 
+//! @def ERPC_PENDING_CLIENTS_TABLE_SIZE
+//!
+//! @brief Set initial size of transport arbitrator table of client requests waiting for reply. In case of
+//! ERPC_ALLOCATION_POLICY_STATIC it limits the number of simultaneous client requests over one arbitrated transport,
+//! otherwise the table is doubled when it gets three quarters full. Default value is 2 * ERPC_CLIENTS_THREADS_AMOUNT
+//! in case of ERPC_ALLOCATION_POLICY_STATIC, otherwise 64.
+// #define ERPC_PENDING_CLIENTS_TABLE_SIZE (64U)
+
 //! @def ERPC_THREADS
 //!
 //! @brief Select threading model.
@@ -119,9 +150,23 @@
 //! @def ERPC_DEFAULT_BUFFERS_COUNT
 //!
 //! Uncomment to change the count of buffers allocated by one of statically allocated messages.
-//! Default value is set to 2.
+//! Default value is set to 2. ThreadPoolServer with static allocation policy processes at most
+//! ERPC_DEFAULT_BUFFERS_COUNT - 1 requests at once, one buffer receives the next request.
 //#define ERPC_DEFAULT_BUFFERS_COUNT (2U)
 
+//! @def ERPC_THREAD_POOL_SERVER_MAX_WORKERS
+//!
+//! Uncomment to change the maximal count of worker threads of ThreadPoolServer.
+//! Default value is set to 8.
+//#define ERPC_THREAD_POOL_SERVER_MAX_WORKERS (8U)
+
+//! @def ERPC_THREAD_POOL_SERVER_QUEUE_SIZE
+//!
+//! Uncomment to change the count of received requests waiting for a free ThreadPoolServer worker.
+//! Default value is set to 8. Queued requests hold message buffers and codecs too, with static allocation
+//! policy they are limited also by ERPC_DEFAULT_BUFFERS_COUNT and ERPC_CODEC_COUNT.
+//#define ERPC_THREAD_POOL_SERVER_QUEUE_SIZE (8U)
+
 //! @def ERPC_NOEXCEPT
 //!
 //! @brief Disable/enable noexcept support.
@@ -144,6 +189,73 @@
 //! to support nested calls. See ERPC_NESTED_CALLS macro.
 //#define ERPC_NESTED_CALLS_DETECTION (ERPC_NESTED_CALLS_DETECTION_DISABLED)
 
+//! @def ERPC_ASYNC_CALLS
+//!
+//! Default set to ERPC_ASYNC_CALLS_DISABLED. Uncomment to enable client functions with _async suffix,
+//! which send a request without waiting for its reply. Many requests can be in flight on one transport,
+//! replies are matched by sequence number and collected by functions with _async_result suffix.
+//#define ERPC_ASYNC_CALLS (ERPC_ASYNC_CALLS_ENABLED)
+
+//! @def ERPC_CRC16_IMPLEMENTATION
+//!
+//! Set one of the @c ERPC_CRC16_IMPLEMENTATION_x macros to select how CRC16 of messages is computed. Default set to
+//! ERPC_CRC16_IMPLEMENTATION_SLICING_BY_8 on POSIX systems, otherwise to ERPC_CRC16_IMPLEMENTATION_TABLE.
+//! ERPC_CRC16_IMPLEMENTATION_BITWISE saves the lookup table memory,
+//! ERPC_CRC16_IMPLEMENTATION_SLICING_BY_8 is the fastest for large messages and ERPC_CRC16_IMPLEMENTATION_PORT lets
+//! the port use a CRC hardware engine by implementing erpc_crc16_port_compute().
+//#define ERPC_CRC16_IMPLEMENTATION (ERPC_CRC16_IMPLEMENTATION_SLICING_BY_8)
+
+//! @def ERPC_LARGE_MESSAGES
+//!
+//! Default set to ERPC_LARGE_MESSAGES_DISABLED, message sizes are 16-bit and the framed transport header is 6 bytes.
+//! Uncomment to use 32-bit message sizes and an 8 bytes framed transport header, so one message can carry more than
+//! 64 KB of data. Both sides of the communication have to use the same setting. A mismatch is not reliably
+//! detected, frames of the other format usually fail the header CRC check, but not always.
+//#define ERPC_LARGE_MESSAGES (ERPC_LARGE_MESSAGES_ENABLED)
+
+//! @def ERPC_SERVICE_DISPATCH_TABLE
+//!
+//! Default set to ERPC_SERVICE_DISPATCH_TABLE_DISABLED, the server searches the linked list of added services for
+//! each received request. Uncomment to look up services with ID lower than 256 in an array indexed by service ID,
+//! which takes 256 pointers of RAM in each server object.
+//#define ERPC_SERVICE_DISPATCH_TABLE (ERPC_SERVICE_DISPATCH_TABLE_ENABLED)
+
+//! @def ERPC_TRANSPORT_READ_AHEAD_SIZE
+//!
+//! Size of read-ahead buffer of stream transports (TCP, serial). All data available on the stream are read at once into
+//! this buffer, so small messages do not need separate reads for frame header and body. Set to 0 to read only the
+//! requested data. Default value 1024.
+//#define ERPC_TRANSPORT_READ_AHEAD_SIZE (1024U)
+
+//! @def ERPC_INTER_THREAD_QUEUE_SIZE
+//!
+//! Number of messages InterThreadBufferTransport can hold for receiver, power of two. Default value 8.
+//#define ERPC_INTER_THREAD_QUEUE_SIZE (8U)
+
+//! @def ERPC_COMPRESSING_TRANSPORT_HASH_BITS
+//!
+//! Size of hash table of CompressingTransport compressor as power of two, each entry is one message_size_t. More bits
+//! find more matches in long messages. Range 1 to 16, default value 10.
+//#define ERPC_COMPRESSING_TRANSPORT_HASH_BITS (10U)
+
+//! @def ERPC_INTER_THREAD_SPIN_COUNT
+//!
+//! Maximal number of iterations InterThreadBufferTransport spins waiting for message or free slot before it blocks.
+//! Spinning pays off only when peer thread runs on other core. Default value 1024 for pthreads and Win32, otherwise 0.
+//#define ERPC_INTER_THREAD_SPIN_COUNT (1024U)
+
+//! @def ERPC_TRANSPORT_SHM_SLOTS_COUNT
+//!
+//! Number of message slots of each side of shared memory transport, power of two. Each slot has
+//! ERPC_DEFAULT_BUFFER_SIZE bytes. Both processes have to use the same value. Default value 8.
+//#define ERPC_TRANSPORT_SHM_SLOTS_COUNT (8U)
+
+//! @def ERPC_TRANSPORT_SHM_SPIN_COUNT
+//!
+//! Maximal number of iterations shared memory transport spins waiting for message or free slot before it sleeps on
+//! futex. Default value 1024.
+//#define ERPC_TRANSPORT_SHM_SPIN_COUNT (1024U)
+
 //! @def ERPC_MESSAGE_LOGGING
 //!
 //! Enable eRPC message logging code through the eRPC. Take look into "erpc_message_loggers.h". Can be used for base
@@ -185,6 +297,65 @@
 //! Uncomment for using pre post default callback feature.
 //#define ERPC_PRE_POST_ACTION_DEFAULT (ERPC_PRE_POST_ACTION_DEFAULT_ENABLED)
 
+//! @def ERPC_STATS
+//!
+//! Enable per method call statistics of clients and servers. Take look into "erpc_call_stats.h". Counts calls, errors
+//! and bytes, and measures decode, handler, encode and transport time of each call. Statistics are read by
+//! erpc_server_get_stats() and erpc_client_get_stats(). Requires atomics and erpc_call_stats_port_get_time() port
+//! function. Default set to ERPC_STATS_DISABLED.
+//!
+//! Uncomment for using call statistics.
+//#define ERPC_STATS (ERPC_STATS_ENABLED)
+
+//! @def ERPC_STATS_METHODS_COUNT
+//!
+//! Maximum number of methods recorded by call statistics of one client or server. Default value is 16.
+//#define ERPC_STATS_METHODS_COUNT (16U)
+
+//! @def ERPC_STATS_SAMPLE_SHIFT
+//!
+//! Call statistics measure time of one of every 2^ERPC_STATS_SAMPLE_SHIFT calls, counters of calls, errors and bytes
+//! cover all calls. Reading the clock several times per call costs more than the counters, set to 0 to measure every
+//! call. Default value is 4.
+//#define ERPC_STATS_SAMPLE_SHIFT (4U)
+
+//! @def ERPC_CLIENT_REQUEST_CACHE
+//!
+//! Default set to ERPC_CLIENT_REQUEST_CACHE_DISABLED, each client request creates a codec and a message buffer by their
+//! factories and disposes them when released. Uncomment to keep the codec and message buffer of released request for
+//! the next request of the same thread, so calls do not allocate once each thread made its first call. Requests are
+//! not cached with zero-copy message buffer factories (RPMsg, shared memory), whose buffers belong to the transport.
+//! Threads which exit release their cached request by erpc_client_release_thread_cache().
+//#define ERPC_CLIENT_REQUEST_CACHE (ERPC_CLIENT_REQUEST_CACHE_ENABLED)
+
+//! @def ERPC_CLIENT_REQUEST_CACHE_SIZE
+//!
+//! Number of threads with cached request of one client. Requests of other threads and nested or asynchronous requests
+//! of a thread whose cached request is in use are allocated as usual. Default value is 4.
+//#define ERPC_CLIENT_REQUEST_CACHE_SIZE (4U)
+
+//! @def ERPC_SERVER_ARENA
+//!
+//! Default set to ERPC_SERVER_ARENA_DISABLED. Uncomment to give the simple server an arena from which shims generated
+//! with @server_arena annotation allocate strings, binaries, lists and structures of the request. The arena is sized
+//! from the received message length, kept for next requests and reset after the reply is sent, so decoded parameters
+//! are released at once and do not fragment the heap. Allocations not fitting into the arena use erpc_malloc().
+//#define ERPC_SERVER_ARENA (ERPC_SERVER_ARENA_ENABLED)
+
+//! @def ERPC_SERVER_ARENA_SIZE_FACTOR
+//!
+//! Arena size as multiple of received message length. Decoded parameters need more space than their encoded form
+//! because of pointers, terminating zeros and structure padding. Default value is 2.
+//#define ERPC_SERVER_ARENA_SIZE_FACTOR (2U)
+
+//! @def ERPC_STREAM_WINDOW
+//!
+//! Count of chunk messages of streamed parameter or return value which can be sent before the receiver acknowledges
+//! them. Receiver acknowledges every half of the window, larger window keeps the transport busy while the receiver
+//! copies chunks, smaller one needs less buffering in the transport. Both sides shall use the same value. Default
+//! value is 4.
+//#define ERPC_STREAM_WINDOW (4U)
+
 //! @name Assert function definition
 //@{
 //! User custom asser defition. Include header file if needed before bellow line. If assert is not enabled, default will
@@ -15,9 +15,14 @@ set(ERPC_C_INCLUDES
 set(ERPC_C_HEADERS
     ${ERPC_C}/config/erpc_config.h
 	  ${ERPC_C}/infra/erpc_arbitrated_client_manager.hpp
+	  ${ERPC_C}/infra/erpc_arena.hpp
 	  ${ERPC_C}/infra/erpc_basic_codec.hpp
+	  ${ERPC_C}/infra/erpc_batching_transport.hpp
+	  ${ERPC_C}/infra/erpc_call_stats.h
 	  ${ERPC_C}/infra/erpc_client_manager.h
 	  ${ERPC_C}/infra/erpc_codec.hpp
+	  ${ERPC_C}/infra/erpc_compact_codec.hpp
+	  ${ERPC_C}/infra/erpc_compressing_transport.hpp
 	  ${ERPC_C}/infra/erpc_crc16.hpp
 	  ${ERPC_C}/infra/erpc_common.h
 	  ${ERPC_C}/infra/erpc_version.h
@@ -27,6 +32,8 @@ set(ERPC_C_HEADERS
 	  ${ERPC_C}/infra/erpc_message_loggers.hpp
 	  ${ERPC_C}/infra/erpc_server.hpp
 	  ${ERPC_C}/infra/erpc_static_queue.hpp
+	  ${ERPC_C}/infra/erpc_stream.hpp
+	  ${ERPC_C}/infra/erpc_thread_pool_server.hpp
 	  ${ERPC_C}/infra/erpc_transport_arbitrator.hpp
 	  ${ERPC_C}/infra/erpc_transport.hpp
 	  ${ERPC_C}/infra/erpc_utils.hpp
@@ -49,14 +56,21 @@ set(ERPC_C_HEADERS
 
 set(ERPC_C_SOURCES
 	${ERPC_C}/infra/erpc_arbitrated_client_manager.cpp
+	${ERPC_C}/infra/erpc_arena.cpp
 	${ERPC_C}/infra/erpc_basic_codec.cpp
+	${ERPC_C}/infra/erpc_batching_transport.cpp
+	${ERPC_C}/infra/erpc_call_stats.cpp
 	${ERPC_C}/infra/erpc_client_manager.cpp
+	${ERPC_C}/infra/erpc_compact_codec.cpp
+	${ERPC_C}/infra/erpc_compressing_transport.cpp
 	${ERPC_C}/infra/erpc_crc16.cpp
 	${ERPC_C}/infra/erpc_framed_transport.cpp
 	${ERPC_C}/infra/erpc_message_buffer.cpp
 	${ERPC_C}/infra/erpc_message_loggers.cpp
 	${ERPC_C}/infra/erpc_server.cpp
 	${ERPC_C}/infra/erpc_simple_server.cpp
+	${ERPC_C}/infra/erpc_stream.cpp
+	${ERPC_C}/infra/erpc_thread_pool_server.cpp
 	${ERPC_C}/infra/erpc_transport_arbitrator.cpp
 	${ERPC_C}/infra/erpc_utils.cpp
 	${ERPC_C}/infra/erpc_pre_post_action.cpp
@@ -67,13 +81,31 @@ set(ERPC_C_SOURCES
 
 	${ERPC_C}/setup/erpc_arbitrated_client_setup.cpp
 	${ERPC_C}/setup/erpc_client_setup.cpp
+	${ERPC_C}/setup/erpc_setup_batching.cpp
+	${ERPC_C}/setup/erpc_setup_compressing.cpp
 	${ERPC_C}/setup/erpc_setup_mbf_dynamic.cpp
 	${ERPC_C}/setup/erpc_setup_mbf_static.cpp
 	${ERPC_C}/setup/erpc_server_setup.cpp
 	${ERPC_C}/setup/erpc_setup_serial.cpp
 	${ERPC_C}/setup/erpc_setup_tcp.cpp
+	${ERPC_C}/setup/erpc_thread_pool_server_setup.cpp
 
 	${ERPC_C}/transports/erpc_inter_thread_buffer_transport.cpp
 	${ERPC_C}/transports/erpc_tcp_transport.cpp
 	${ERPC_C}/transports/erpc_serial_transport.cpp
-)
\ No newline at end of file
+)
+
+# epoll and futex based transports are available only on Linux
+if(CMAKE_SYSTEM_NAME STREQUAL "Linux")
+	list(APPEND ERPC_C_HEADERS
+		${ERPC_C}/transports/erpc_shm_transport.hpp
+		${ERPC_C}/transports/erpc_tcp_epoll_server_transport.hpp
+	)
+
+	list(APPEND ERPC_C_SOURCES
+		${ERPC_C}/setup/erpc_setup_shm.cpp
+		${ERPC_C}/setup/erpc_setup_tcp_epoll_server.cpp
+		${ERPC_C}/transports/erpc_shm_transport.cpp
+		${ERPC_C}/transports/erpc_tcp_epoll_server_transport.cpp
+	)
+endif()
\ No newline at end of file
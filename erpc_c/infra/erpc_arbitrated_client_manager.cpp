@@ -107,3 +107,101 @@ void ArbitratedClientManager::performClientRequest(RequestContext &request)
         }
     }
 }
+
+#if ERPC_ASYNC_CALLS
+void ArbitratedClientManager::performRequestAsync(AsyncRequest &asyncRequest)
+{
+    erpc_status_t err;
+    RequestContext &request = asyncRequest.getRequest();
+    TransportArbitrator::client_token_t token = 0;
+
+    erpc_assert((m_arbitrator != NULL) && ("arbitrator not set" != NULL));
+
+    asyncRequest.setCompleted(false);
+
+#if ERPC_STATS
+    request.markStatsSend();
+#endif
+
+    // Set up the client receive before we send the request, the reply may come at any time.
+    if (!request.isOneway() && (request.getCodec()->isStatusOk() == true))
+    {
+        token = m_arbitrator->prepareClientReceive(request);
+        if (token == 0U)
+        {
+            request.getCodec()->updateStatus(kErpcStatus_Fail);
+        }
+    }
+
+#if ERPC_MESSAGE_LOGGING
+    if (request.getCodec()->isStatusOk() == true)
+    {
+        err = logMessage(&request.getCodec()->getBufferRef());
+        request.getCodec()->updateStatus(err);
+    }
+#endif
+
+    // Send the request.
+    if (request.getCodec()->isStatusOk() == true)
+    {
+        err = m_arbitrator->send(&request.getCodec()->getBufferRef());
+        request.getCodec()->updateStatus(err);
+    }
+
+    if ((token != 0U) && (request.getCodec()->isStatusOk() == false))
+    {
+        m_arbitrator->removePendingClient(token);
+        token = 0;
+    }
+
+    asyncRequest.setToken(token);
+    if (token == 0U)
+    {
+#if ERPC_STATS
+        request.markStatsReply();
+#endif
+        asyncRequest.setCompleted(true);
+    }
+}
+
+void ArbitratedClientManager::waitForReply(AsyncRequest &asyncRequest)
+{
+#if ERPC_MESSAGE_LOGGING
+    erpc_status_t err;
+#endif
+    RequestContext &request = asyncRequest.getRequest();
+
+    if (!asyncRequest.isCompleted())
+    {
+        // Complete the receive through the arbitrator.
+        m_arbitrator->clientReceive(asyncRequest.getToken());
+        m_arbitrator->removePendingClient(asyncRequest.getToken());
+        asyncRequest.setToken(0);
+
+#if ERPC_STATS
+        request.markStatsReply();
+#endif
+
+#if ERPC_MESSAGE_LOGGING
+        if (request.getCodec()->isStatusOk() == true)
+        {
+            err = logMessage(&request.getCodec()->getBufferRef());
+            request.getCodec()->updateStatus(err);
+        }
+#endif
+
+        if (request.getCodec()->isStatusOk() == true)
+        {
+            // Check the reply.
+            verifyReply(request);
+        }
+
+        asyncRequest.setCompleted(true);
+    }
+}
+
+erpc_status_t ArbitratedClientManager::pollReplies(void)
+{
+    return kErpcStatus_Success;
+}
+#endif
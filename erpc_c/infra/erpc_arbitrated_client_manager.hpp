@@ -61,6 +61,32 @@ public:
      */
     TransportArbitrator *getArbitrator(void) { return m_arbitrator; };
 
+#if ERPC_ASYNC_CALLS
+    /*!
+     * @brief This function sends request without waiting for its reply.
+     *
+     * The reply is received by the server thread through the transport arbitrator. With static
+     * allocation policy, ERPC_CLIENTS_THREADS_AMOUNT limits count of pending requests.
+     *
+     * @param[in] asyncRequest Asynchronous request with encoded request context.
+     */
+    virtual void performRequestAsync(AsyncRequest &asyncRequest) override;
+
+    /*!
+     * @brief This function blocks until reply of asynchronous request is received.
+     *
+     * @param[in] asyncRequest Asynchronous request to wait for.
+     */
+    virtual void waitForReply(AsyncRequest &asyncRequest) override;
+
+    /*!
+     * @brief Replies are received by the server thread, nothing to do here.
+     *
+     * @retval #kErpcStatus_Success Always.
+     */
+    virtual erpc_status_t pollReplies(void) override;
+#endif
+
 protected:
     TransportArbitrator *m_arbitrator; //!< Optional transport arbitrator. May be NULL.
 
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_arena.hpp"
+#include "erpc_codec.hpp"
+#include "erpc_port.h"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! Alignment of arena allocations, enough for every type of decoded parameters.
+#define ERPC_ARENA_ALIGNMENT (8U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+Arena::Arena(void) : m_data(NULL), m_size(0), m_used(0) {}
+
+Arena::~Arena(void)
+{
+    erpc_free(m_data);
+}
+
+uint32_t Arena::open(uint32_t messageLength)
+{
+    uint32_t size = messageLength * ERPC_SERVER_ARENA_SIZE_FACTOR;
+    uint8_t *data;
+
+    size = (size + ERPC_ARENA_ALIGNMENT - 1U) & ~(ERPC_ARENA_ALIGNMENT - 1U);
+
+    // Block cannot move while it holds data of outer request.
+    if ((m_used == 0U) && (size > m_size))
+    {
+        data = reinterpret_cast<uint8_t *>(erpc_malloc(size));
+        if (data != NULL)
+        {
+            erpc_free(m_data);
+            m_data = data;
+            m_size = size;
+        }
+    }
+
+    return m_used;
+}
+
+void *Arena::allocate(size_t size)
+{
+    void *ptr = NULL;
+    size_t alignedSize = (size + ERPC_ARENA_ALIGNMENT - 1U) & ~static_cast<size_t>(ERPC_ARENA_ALIGNMENT - 1U);
+
+    if ((alignedSize >= size) && (alignedSize <= static_cast<size_t>(m_size - m_used)))
+    {
+        ptr = &m_data[m_used];
+        m_used += static_cast<uint32_t>(alignedSize);
+    }
+
+    return ptr;
+}
+
+void *erpc::arena_allocate(Codec *codec, size_t size)
+{
+    void *ptr = NULL;
+
+#if ERPC_SERVER_ARENA
+    Arena *arena = codec->getArena();
+
+    if ((arena != NULL) && (size > 0U))
+    {
+        ptr = arena->allocate(size);
+    }
+#else
+    (void)codec;
+    (void)size;
+#endif
+
+    return ptr;
+}
+
+bool erpc::arena_contains(Codec *codec, const void *ptr)
+{
+    bool contains = false;
+
+#if ERPC_SERVER_ARENA
+    Arena *arena = codec->getArena();
+
+    if (arena != NULL)
+    {
+        contains = arena->contains(ptr);
+    }
+#else
+    (void)codec;
+    (void)ptr;
+#endif
+
+    return contains;
+}
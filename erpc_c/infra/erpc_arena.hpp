@@ -0,0 +1,136 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _EMBEDDED_RPC__ARENA_H_
+#define _EMBEDDED_RPC__ARENA_H_
+
+#include "erpc_config_internal.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/*!
+ * @addtogroup infra_server
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+class Codec;
+
+/*!
+ * @brief Bump allocator for parameters decoded by server shims.
+ *
+ * Server opens the arena for each request with a size derived from the received message length
+ * and closes it after the reply is sent. Allocations only move the top of the arena and closing
+ * the arena returns all of them at once. Memory block grows only while the arena is empty and is
+ * kept for next requests. Requests nested into a processed request (nested calls) continue above
+ * the data of the outer request.
+ *
+ * @ingroup infra_server
+ */
+class Arena
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * This function initializes object attributes. Memory block is allocated by first request.
+     */
+    Arena(void);
+
+    /*!
+     * @brief Arena destructor
+     */
+    ~Arena(void);
+
+    /*!
+     * @brief Opens the arena for a request.
+     *
+     * When the arena is empty, its block is enlarged to ERPC_SERVER_ARENA_SIZE_FACTOR times the message length.
+     *
+     * @param[in] messageLength Length of received request message.
+     *
+     * @return Mark to be passed to close().
+     */
+    uint32_t open(uint32_t messageLength);
+
+    /*!
+     * @brief Releases all memory allocated since the arena was opened.
+     *
+     * @param[in] mark Value returned by open().
+     */
+    void close(uint32_t mark) { m_used = mark; }
+
+    /*!
+     * @brief Allocates memory from the arena.
+     *
+     * @param[in] size Requested size, must not be zero.
+     *
+     * @return Pointer to memory or NULL when arena has not enough free space.
+     */
+    void *allocate(size_t size);
+
+    /*!
+     * @brief Checks that the memory was allocated from the arena.
+     *
+     * @param[in] ptr Pointer to memory.
+     *
+     * @retval true Memory belongs to the arena.
+     * @retval false Memory does not belong to the arena.
+     */
+    bool contains(const void *ptr) const
+    {
+        const uint8_t *data = reinterpret_cast<const uint8_t *>(ptr);
+        return ((m_data != NULL) && (data >= m_data) && (data < &m_data[m_size]));
+    }
+
+protected:
+    uint8_t *m_data; /*!< Memory block of the arena. */
+    uint32_t m_size; /*!< Size of memory block. */
+    uint32_t m_used; /*!< Count of allocated bytes. */
+
+private:
+    Arena(const Arena &other);            //!< Disable copy ctor.
+    Arena &operator=(const Arena &other); //!< Disable copy operator.
+};
+
+/*!
+ * @brief Allocates memory for parameter decoded by server shim from the arena of the codec.
+ *
+ * Shims fall back to erpc_malloc() when NULL is returned, so that allocation macros of the application apply.
+ *
+ * @param[in] codec Codec of processed request.
+ * @param[in] size Requested size.
+ *
+ * @return Pointer to memory, NULL when the codec has no arena, arena has not enough free space or size is zero.
+ */
+void *arena_allocate(Codec *codec, size_t size);
+
+/*!
+ * @brief Checks that the memory was allocated from the arena of the codec.
+ *
+ * Memory of the arena is released by closing the arena, shims free only other memory by erpc_free().
+ *
+ * @param[in] codec Codec of processed request.
+ * @param[in] ptr Pointer to memory.
+ *
+ * @retval true Memory belongs to the arena.
+ * @retval false Memory does not belong to the arena or the codec has no arena.
+ */
+bool arena_contains(Codec *codec, const void *ptr);
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__ARENA_H_
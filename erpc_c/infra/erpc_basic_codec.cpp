@@ -18,6 +18,7 @@
 #include <new>
 #endif
 #include <cassert>
+#include <cstring>
 
 using namespace erpc;
 
@@ -27,10 +28,144 @@ using namespace erpc;
 
 const uint32_t BasicCodec::kBasicCodecVersion = 1UL;
 
-BasicCodec::BasicCodec(void) : Codec() {}
+/*!
+ * @brief Convert array elements from processor to communication endianness.
+ *
+ * Elements in the message buffer can be misaligned, so they are copied through a local variable. Each element size has
+ * its own loop, which the compiler can vectorize. Loops are removed when the endianness header does no conversion.
+ */
+static void writeAgnosticArray(uint8_t *data, uint32_t length, uint8_t elementSize, element_kind_t kind)
+{
+    uint16_t v16;
+    uint32_t v32;
+    uint64_t v64;
+    float vFloat;
+    double vDouble;
+    uint32_t i;
+
+    switch (elementSize)
+    {
+        case 2U:
+            for (i = 0U; i < length; ++i)
+            {
+                (void)memcpy(&v16, &data[i * 2U], sizeof(v16));
+                ERPC_WRITE_AGNOSTIC_16(v16);
+                (void)memcpy(&data[i * 2U], &v16, sizeof(v16));
+            }
+            break;
+        case 4U:
+            for (i = 0U; i < length; ++i)
+            {
+                if (kind == element_kind_t::kFloat)
+                {
+                    (void)memcpy(&vFloat, &data[i * 4U], sizeof(vFloat));
+                    ERPC_WRITE_AGNOSTIC_FLOAT(vFloat);
+                    (void)memcpy(&data[i * 4U], &vFloat, sizeof(vFloat));
+                }
+                else
+                {
+                    (void)memcpy(&v32, &data[i * 4U], sizeof(v32));
+                    ERPC_WRITE_AGNOSTIC_32(v32);
+                    (void)memcpy(&data[i * 4U], &v32, sizeof(v32));
+                }
+            }
+            break;
+        case 8U:
+            for (i = 0U; i < length; ++i)
+            {
+                if (kind == element_kind_t::kFloat)
+                {
+                    (void)memcpy(&vDouble, &data[i * 8U], sizeof(vDouble));
+                    ERPC_WRITE_AGNOSTIC_DOUBLE(vDouble);
+                    (void)memcpy(&data[i * 8U], &vDouble, sizeof(vDouble));
+                }
+                else
+                {
+                    (void)memcpy(&v64, &data[i * 8U], sizeof(v64));
+                    ERPC_WRITE_AGNOSTIC_64(v64);
+                    (void)memcpy(&data[i * 8U], &v64, sizeof(v64));
+                }
+            }
+            break;
+        default:
+            // Bytes have no endianness.
+            break;
+    }
+}
+
+/*!
+ * @brief Convert array elements from communication to processor endianness.
+ *
+ * Elements are aligned in the destination.
+ */
+static void readAgnosticArray(uint8_t *data, uint32_t length, uint8_t elementSize, element_kind_t kind)
+{
+    uint32_t i;
+
+    (void)data;
+    (void)kind;
+
+    switch (elementSize)
+    {
+        case 2U:
+            for (i = 0U; i < length; ++i)
+            {
+                ERPC_READ_AGNOSTIC_16(reinterpret_cast<uint16_t *>(data)[i]);
+            }
+            break;
+        case 4U:
+            for (i = 0U; i < length; ++i)
+            {
+                if (kind == element_kind_t::kFloat)
+                {
+                    ERPC_READ_AGNOSTIC_FLOAT(reinterpret_cast<float *>(data)[i]);
+                }
+                else
+                {
+                    ERPC_READ_AGNOSTIC_32(reinterpret_cast<uint32_t *>(data)[i]);
+                }
+            }
+            break;
+        case 8U:
+            for (i = 0U; i < length; ++i)
+            {
+                if (kind == element_kind_t::kFloat)
+                {
+                    ERPC_READ_AGNOSTIC_DOUBLE(reinterpret_cast<double *>(data)[i]);
+                }
+                else
+                {
+                    ERPC_READ_AGNOSTIC_64(reinterpret_cast<uint64_t *>(data)[i]);
+                }
+            }
+            break;
+        default:
+            // Bytes have no endianness.
+            break;
+    }
+}
+
+BasicCodec::BasicCodec(void) : Codec(), m_borrowedEnd(0) {}
 
 BasicCodec::~BasicCodec(void) {}
 
+void BasicCodec::setBuffer(MessageBuffer &buf, uint8_t skip)
+{
+    Codec::setBuffer(buf, skip);
+    m_borrowedEnd = 0;
+}
+
+void BasicCodec::reset(uint8_t skip)
+{
+    Codec::reset(skip);
+    m_borrowedEnd = 0;
+}
+
+void BasicCodec::markBorrowed(void)
+{
+    m_borrowedEnd = (message_size_t)(m_cursor.get() - m_cursor.getBufferRef().get());
+}
+
 void BasicCodec::startWriteMessage(message_type_t type, uint32_t service, uint32_t request, uint32_t sequence)
 {
     uint32_t header =
@@ -148,6 +283,48 @@ void BasicCodec::writeBinary(uint32_t length, const uint8_t *value)
     writeData(length, value);
 }
 
+void BasicCodec::writeArray(uint32_t length, uint8_t elementSize, element_kind_t kind, const void *value)
+{
+    uint8_t *data = m_cursor.get();
+
+    erpc_assert((elementSize == 1U) || (elementSize == 2U) || (elementSize == 4U) || (elementSize == 8U));
+
+    if (isStatusOk() && (length > (UINT32_MAX / elementSize)))
+    {
+        m_status = kErpcStatus_BufferOverrun;
+    }
+
+    // Copy all elements at once and convert them in the message buffer.
+    writeData(length * elementSize, value);
+
+    if (isStatusOk())
+    {
+        writeAgnosticArray(data, length, elementSize, kind);
+    }
+}
+
+uint8_t *BasicCodec::reserveWrite(uint32_t length)
+{
+    MessageBuffer &buffer = m_cursor.getBufferRef();
+    uint8_t *data = NULL;
+
+    if (isStatusOk())
+    {
+        if (length > m_cursor.getRemaining())
+        {
+            m_status = kErpcStatus_BufferOverrun;
+        }
+        else
+        {
+            data = m_cursor.get();
+            (void)(m_cursor += (message_size_t)length);
+            buffer.setUsed(buffer.getUsed() + length);
+        }
+    }
+
+    return data;
+}
+
 void BasicCodec::startWriteList(uint32_t length)
 {
     // Write the list length as a u32.
@@ -215,7 +392,7 @@ void BasicCodec::read(int16_t &value)
     readData(sizeof(value), &value);
     if (isStatusOk())
     {
-        ERPC_READ_AGNOSTIC_16(*value);
+        ERPC_READ_AGNOSTIC_16(value);
     }
 }
 
@@ -224,7 +401,7 @@ void BasicCodec::read(int32_t &value)
     readData(sizeof(value), &value);
     if (isStatusOk())
     {
-        ERPC_READ_AGNOSTIC_32(*value);
+        ERPC_READ_AGNOSTIC_32(value);
     }
 }
 
@@ -233,7 +410,7 @@ void BasicCodec::read(int64_t &value)
     readData(sizeof(value), &value);
     if (isStatusOk())
     {
-        ERPC_READ_AGNOSTIC_64(*value);
+        ERPC_READ_AGNOSTIC_64(value);
     }
 }
 
@@ -247,7 +424,7 @@ void BasicCodec::read(uint16_t &value)
     readData(sizeof(value), &value);
     if (isStatusOk())
     {
-        ERPC_READ_AGNOSTIC_16(*value);
+        ERPC_READ_AGNOSTIC_16(value);
     }
 }
 
@@ -256,7 +433,7 @@ void BasicCodec::read(uint32_t &value)
     readData(sizeof(value), &value);
     if (isStatusOk())
     {
-        ERPC_READ_AGNOSTIC_32(*value);
+        ERPC_READ_AGNOSTIC_32(value);
     }
 }
 
@@ -265,7 +442,7 @@ void BasicCodec::read(uint64_t &value)
     readData(sizeof(value), &value);
     if (isStatusOk())
     {
-        ERPC_READ_AGNOSTIC_64(*value);
+        ERPC_READ_AGNOSTIC_64(value);
     }
 }
 
@@ -274,7 +451,7 @@ void BasicCodec::read(float &value)
     readData(sizeof(value), &value);
     if (isStatusOk())
     {
-        ERPC_READ_AGNOSTIC_FLOAT(*value);
+        ERPC_READ_AGNOSTIC_FLOAT(value);
     }
 }
 
@@ -283,7 +460,7 @@ void BasicCodec::read(double &value)
     readData(sizeof(value), &value);
     if (isStatusOk())
     {
-        ERPC_READ_AGNOSTIC_DOUBLE(*value);
+        ERPC_READ_AGNOSTIC_DOUBLE(value);
     }
 }
 
@@ -301,7 +478,7 @@ void BasicCodec::readPtr(uintptr_t &value)
     readData(ptrSize, &value);
     if (isStatusOk())
     {
-        ERPC_READ_AGNOSTIC_PTR(*value);
+        ERPC_READ_AGNOSTIC_PTR(value);
     }
 }
 
@@ -334,7 +511,10 @@ void BasicCodec::readBinary(uint32_t &length, uint8_t **value)
             *value = m_cursor.get();
 
             // Skip over data.
-            (void)(m_cursor += (uint16_t)length);
+            (void)(m_cursor += (message_size_t)length);
+
+            // Caller may keep using the data in place.
+            markBorrowed();
         }
     }
     if (!isStatusOk())
@@ -344,6 +524,130 @@ void BasicCodec::readBinary(uint32_t &length, uint8_t **value)
     }
 }
 
+void BasicCodec::readBorrowedString(uint32_t &length, char **value)
+{
+    uint8_t *tempPtr = NULL;
+
+    readBinary(length, &tempPtr);
+    if (isStatusOk())
+    {
+        // Last byte of the length is already read, reuse it for the string.
+        tempPtr = static_cast<uint8_t *>(memmove(tempPtr - 1, tempPtr, length));
+        tempPtr[length] = 0;
+    }
+
+    *value = reinterpret_cast<char *>(tempPtr);
+}
+
+void BasicCodec::readBorrowedList(uint32_t length, uint8_t elementSize, element_kind_t kind, void **value)
+{
+    MessageBuffer &buffer = m_cursor.getBufferRef();
+    uint8_t *tempPtr = NULL;
+    uint32_t size = length * elementSize;
+    uint32_t misalignment;
+    uint32_t shift;
+
+    erpc_assert((elementSize == 1U) || (elementSize == 2U) || (elementSize == 4U) || (elementSize == 8U));
+
+    if (isStatusOk())
+    {
+        if ((length > (UINT32_MAX / elementSize)) || (m_cursor.getRemainingUsed() < size))
+        {
+            m_status = kErpcStatus_Fail;
+        }
+        else if (m_cursor.getRemaining() < size)
+        {
+            m_status = kErpcStatus_BufferOverrun;
+        }
+        else
+        {
+            tempPtr = m_cursor.get();
+            misalignment = (uint32_t)((uintptr_t)tempPtr % elementSize);
+            shift = (misalignment != 0U) ? (elementSize - misalignment) : 0U;
+
+            if (misalignment <= (uint32_t)(tempPtr - (buffer.get() + m_borrowedEnd)))
+            {
+                // Skip over data.
+                (void)(m_cursor += (message_size_t)size);
+
+                // Move elements over already read data to be aligned.
+                if (misalignment != 0U)
+                {
+                    tempPtr = static_cast<uint8_t *>(memmove(tempPtr - misalignment, tempPtr, size));
+                }
+            }
+            else if (shift <= (uint32_t)(m_cursor.getRemaining() - m_cursor.getRemainingUsed()))
+            {
+                // Already read data are lent out, move elements and rest of the message forward instead.
+                (void)memmove(tempPtr + shift, tempPtr, m_cursor.getRemainingUsed());
+                buffer.setUsed(buffer.getUsed() + (message_size_t)shift);
+                tempPtr += shift;
+
+                // Skip over data.
+                (void)(m_cursor += (message_size_t)(size + shift));
+            }
+            else
+            {
+                m_status = kErpcStatus_MemoryError;
+            }
+
+            if (isStatusOk())
+            {
+                readAgnosticArray(tempPtr, length, elementSize, kind);
+                markBorrowed();
+            }
+        }
+    }
+    if (!isStatusOk())
+    {
+        tempPtr = NULL;
+    }
+
+    *value = tempPtr;
+}
+
+void BasicCodec::readArray(uint32_t length, uint8_t elementSize, element_kind_t kind, void *value)
+{
+    erpc_assert((elementSize == 1U) || (elementSize == 2U) || (elementSize == 4U) || (elementSize == 8U));
+
+    if (isStatusOk() && (length > (UINT32_MAX / elementSize)))
+    {
+        m_status = kErpcStatus_Fail;
+    }
+
+    // Copy all elements at once and convert them in the destination.
+    readData(length * elementSize, value);
+
+    if (isStatusOk())
+    {
+        readAgnosticArray(static_cast<uint8_t *>(value), length, elementSize, kind);
+    }
+}
+
+const uint8_t *BasicCodec::reserveRead(uint32_t length)
+{
+    const uint8_t *data = NULL;
+
+    if (isStatusOk())
+    {
+        if (length > m_cursor.getRemainingUsed())
+        {
+            m_status = kErpcStatus_Fail;
+        }
+        else if (length > m_cursor.getRemaining())
+        {
+            m_status = kErpcStatus_BufferOverrun;
+        }
+        else
+        {
+            data = m_cursor.get();
+            (void)(m_cursor += (message_size_t)length);
+        }
+    }
+
+    return data;
+}
+
 void BasicCodec::startReadList(uint32_t &length)
 {
     // Read list length as u32.
@@ -53,6 +53,21 @@ public:
      */
     virtual ~BasicCodec(void);
 
+    /*!
+     * @brief Set message buffer used for read and write data.
+     *
+     * @param[in] buf Message buffer to set.
+     * @param[in] skip How many bytes to skip from reading.
+     */
+    virtual void setBuffer(MessageBuffer &buf, uint8_t skip = 0) override;
+
+    /*!
+     * @brief Reset the codec to initial state.
+     *
+     * @param[in] skip How many bytes to skip from reading.
+     */
+    virtual void reset(uint8_t skip = 0) override;
+
     //! @name Encoding
     //@{
     /*!
@@ -174,6 +189,27 @@ public:
      */
     virtual void writeBinary(uint32_t length, const uint8_t *value) override;
 
+    /*!
+     * @brief Prototype for write array of scalar values.
+     *
+     * Elements are copied at once and converted to communication endianness in the message buffer.
+     *
+     * @param[in] length Count of elements.
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     * @param[in] value Elements to write.
+     */
+    virtual void writeArray(uint32_t length, uint8_t elementSize, element_kind_t kind, const void *value) override;
+
+    /*!
+     * @brief Reserve message data of fixed size to write values directly.
+     *
+     * @param[in] length Count of bytes to reserve.
+     *
+     * @return Reserved memory in the message buffer. Null in case of error.
+     */
+    virtual uint8_t *reserveWrite(uint32_t length) override;
+
     /*!
      * @brief Prototype for start write list.
      *
@@ -318,6 +354,51 @@ public:
      */
     virtual void readBinary(uint32_t &length, uint8_t **value) override;
 
+    /*!
+     * @brief Prototype for read string value in place.
+     *
+     * The string is moved by one byte over its already read length to make space for the terminating zero.
+     *
+     * @param[out] length of string.
+     * @param[out] value Zero terminated string inside of the message buffer. Null in case of error.
+     */
+    virtual void readBorrowedString(uint32_t &length, char **value) override;
+
+    /*!
+     * @brief Prototype for read list of scalar values in place.
+     *
+     * Misaligned elements are moved back over already read data to the nearest aligned address. Data lent
+     * out of the buffer before, like borrowed strings and lists, are never overwritten: when the aligned
+     * address would reach into them, the rest of the message is moved forward instead.
+     *
+     * @param[in] length Count of list elements.
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     * @param[out] value Elements inside of the message buffer. Null in case of error.
+     */
+    virtual void readBorrowedList(uint32_t length, uint8_t elementSize, element_kind_t kind, void **value) override;
+
+    /*!
+     * @brief Prototype for read array of scalar values.
+     *
+     * Elements are copied at once and converted to processor endianness in the destination.
+     *
+     * @param[in] length Count of elements.
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     * @param[out] value Memory for elements.
+     */
+    virtual void readArray(uint32_t length, uint8_t elementSize, element_kind_t kind, void *value) override;
+
+    /*!
+     * @brief Reserve message data of fixed size to read values directly.
+     *
+     * @param[in] length Count of bytes to reserve.
+     *
+     * @return Reserved memory in the message buffer. Null in case of error.
+     */
+    virtual const uint8_t *reserveRead(uint32_t length) override;
+
     /*!
      * @brief Prototype for start read list.
      *
@@ -339,6 +420,14 @@ public:
      */
     virtual void readNullFlag(bool &isNull) override;
     //@}
+
+protected:
+    /*!
+     * @brief Mark data up to the cursor as lent out of the buffer.
+     */
+    void markBorrowed(void);
+
+    message_size_t m_borrowedEnd; /*!< Offset of end of data lent out of the buffer, not to be moved over. */
 };
 
 /*!
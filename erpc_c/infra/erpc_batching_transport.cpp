@@ -0,0 +1,342 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_batching_transport.hpp"
+
+#include "erpc_config_internal.h"
+#include ENDIANNESS_HEADER
+
+#include <cstring>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+BatchingTransport::BatchingTransport(void) :
+Transport(), m_transport(NULL), m_messageFactory(NULL), m_sendBatch(), m_receiveBatch(), m_receiveOffset(0),
+m_codec(NULL), m_maxDelayUs(0)
+#if !ERPC_THREADS_IS(NONE)
+,
+m_sendLock(), m_flushRequest(0), m_flushThreadStopped(0), m_flushThread("erpc_batching"),
+m_flushThreadRunning(false), m_stopFlushThread(false)
+#endif
+{
+}
+
+BatchingTransport::~BatchingTransport(void)
+{
+#if !ERPC_THREADS_IS(NONE)
+    if (m_flushThreadRunning)
+    {
+        m_stopFlushThread = true;
+        m_flushRequest.put();
+        (void)m_flushThreadStopped.get();
+    }
+#endif
+
+    if (m_messageFactory != NULL)
+    {
+        if (m_sendBatch.get() != NULL)
+        {
+            m_messageFactory->dispose(&m_sendBatch);
+        }
+        if (m_receiveBatch.get() != NULL)
+        {
+            m_messageFactory->dispose(&m_receiveBatch);
+        }
+    }
+}
+
+erpc_status_t BatchingTransport::init(Transport *transport, MessageBufferFactory *messageFactory,
+                                      uint32_t maxDelayUs)
+{
+    erpc_status_t err = kErpcStatus_Success;
+
+    erpc_assert(transport != NULL);
+    erpc_assert(messageFactory != NULL);
+
+    m_transport = transport;
+    m_messageFactory = messageFactory;
+    m_maxDelayUs = maxDelayUs;
+
+#if ERPC_THREADS_IS(NONE)
+    if (m_maxDelayUs != 0U)
+    {
+        err = kErpcStatus_InitFailed;
+    }
+#endif
+
+    if (err == kErpcStatus_Success)
+    {
+        m_sendBatch = m_messageFactory->create();
+        m_receiveBatch = m_messageFactory->create();
+        if ((m_sendBatch.get() == NULL) || (m_receiveBatch.get() == NULL) ||
+            (m_sendBatch.getLength() <= reserveHeaderSize()))
+        {
+            err = kErpcStatus_MemoryError;
+        }
+        else
+        {
+            m_sendBatch.setUsed(m_transport->reserveHeaderSize());
+        }
+    }
+
+#if !ERPC_THREADS_IS(NONE)
+    if ((err == kErpcStatus_Success) && (m_maxDelayUs != 0U))
+    {
+        m_flushThread.init(flushThreadStub);
+        m_flushThread.start(this);
+        m_flushThreadRunning = true;
+    }
+#endif
+
+    return err;
+}
+
+uint8_t BatchingTransport::reserveHeaderSize(void)
+{
+    return m_transport->reserveHeaderSize() + (uint8_t)sizeof(message_size_t);
+}
+
+erpc_status_t BatchingTransport::receive(MessageBuffer *message)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    uint8_t reserve = reserveHeaderSize();
+    message_size_t size;
+    message_size_t rest;
+
+    if (m_receiveOffset < m_receiveBatch.getUsed())
+    {
+        // Return next message of previously received batch.
+        static_cast<void>(memcpy(&size, &m_receiveBatch.get()[m_receiveOffset], sizeof(size)));
+#if ERPC_LARGE_MESSAGES
+        ERPC_READ_AGNOSTIC_32(size);
+#else
+        ERPC_READ_AGNOSTIC_16(size);
+#endif
+        m_receiveOffset += (message_size_t)sizeof(size);
+
+        if ((size > (m_receiveBatch.getUsed() - m_receiveOffset)) || (message->getLength() < reserve) ||
+            (size > (message->getLength() - reserve)))
+        {
+            err = kErpcStatus_ReceiveFailed;
+        }
+        else
+        {
+            static_cast<void>(memcpy(&message->get()[reserve], &m_receiveBatch.get()[m_receiveOffset], size));
+            message->setUsed(reserve + size);
+            m_receiveOffset += size;
+        }
+
+        if (err != kErpcStatus_Success)
+        {
+            // Drop rest of malformed batch.
+            m_receiveBatch.setUsed(0);
+            m_receiveOffset = 0;
+        }
+    }
+    else
+    {
+        // First message is returned in place, following ones are kept for next receive calls.
+        err = m_transport->receive(message);
+        if (err == kErpcStatus_Success)
+        {
+            if (message->getUsed() < reserve)
+            {
+                err = kErpcStatus_ReceiveFailed;
+            }
+        }
+
+        if (err == kErpcStatus_Success)
+        {
+            static_cast<void>(memcpy(&size, &message->get()[m_transport->reserveHeaderSize()], sizeof(size)));
+#if ERPC_LARGE_MESSAGES
+            ERPC_READ_AGNOSTIC_32(size);
+#else
+            ERPC_READ_AGNOSTIC_16(size);
+#endif
+            if (size > (message->getUsed() - reserve))
+            {
+                err = kErpcStatus_ReceiveFailed;
+            }
+        }
+
+        if (err == kErpcStatus_Success)
+        {
+            rest = message->getUsed() - reserve - size;
+            if (rest > m_receiveBatch.getLength())
+            {
+                err = kErpcStatus_ReceiveFailed;
+            }
+            else
+            {
+                static_cast<void>(memcpy(m_receiveBatch.get(), &message->get()[reserve + size], rest));
+                m_receiveBatch.setUsed(rest);
+                m_receiveOffset = 0;
+                message->setUsed(reserve + size);
+            }
+        }
+    }
+
+    return err;
+}
+
+erpc_status_t BatchingTransport::send(MessageBuffer *message)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    uint8_t transportReserve = m_transport->reserveHeaderSize();
+    message_size_t size;
+    message_size_t entrySize;
+    message_type_t msgType;
+    uint32_t service;
+    uint32_t request;
+    uint32_t sequence;
+    bool queue;
+    bool wasEmpty;
+
+    erpc_assert(message->getUsed() >= reserveHeaderSize());
+    erpc_assert(m_codec != NULL);
+
+    size = message->getUsed() - reserveHeaderSize();
+    entrySize = (message_size_t)sizeof(size) + size;
+
+    // Size prefix is written into the reserved space, so the message is also a batch of one message.
+#if ERPC_LARGE_MESSAGES
+    ERPC_WRITE_AGNOSTIC_32(size);
+#else
+    ERPC_WRITE_AGNOSTIC_16(size);
+#endif
+    static_cast<void>(memcpy(&message->get()[transportReserve], &size, sizeof(size)));
+
+    {
+#if !ERPC_THREADS_IS(NONE)
+        Mutex::Guard lock(m_sendLock);
+#endif
+
+        // Messages which are waited for are not delayed. Codec is shared by all senders, so it is used under lock.
+        m_codec->setBuffer(*message, reserveHeaderSize());
+        m_codec->startReadMessage(msgType, service, request, sequence);
+        queue = (m_codec->isStatusOk() && (msgType == message_type_t::kOnewayMessage));
+
+        if (queue && (entrySize > m_sendBatch.getFree()))
+        {
+            err = sendBatch();
+        }
+
+        if (queue && (err == kErpcStatus_Success) && (entrySize <= m_sendBatch.getFree()))
+        {
+            wasEmpty = (m_sendBatch.getUsed() == transportReserve);
+            static_cast<void>(
+                memcpy(&m_sendBatch.get()[m_sendBatch.getUsed()], &message->get()[transportReserve], entrySize));
+            m_sendBatch.setUsed(m_sendBatch.getUsed() + entrySize);
+
+#if !ERPC_THREADS_IS(NONE)
+            if (wasEmpty && m_flushThreadRunning)
+            {
+                m_flushRequest.put();
+            }
+#else
+            (void)wasEmpty;
+#endif
+        }
+        else
+        {
+            if (err == kErpcStatus_Success)
+            {
+                err = sendBatch();
+            }
+
+            if (err == kErpcStatus_Success)
+            {
+                err = m_transport->send(message);
+            }
+        }
+    }
+
+    return err;
+}
+
+bool BatchingTransport::hasMessage(void)
+{
+    return (m_receiveOffset < m_receiveBatch.getUsed()) || m_transport->hasMessage();
+}
+
+void BatchingTransport::setCrc16(Crc16 *crcImpl)
+{
+    erpc_assert(crcImpl != NULL);
+    erpc_assert(m_transport != NULL);
+    m_transport->setCrc16(crcImpl);
+}
+
+Crc16 *BatchingTransport::getCrc16(void)
+{
+    erpc_assert(m_transport != NULL);
+    return m_transport->getCrc16();
+}
+
+void BatchingTransport::setCodec(Codec *codec)
+{
+    m_codec = codec;
+}
+
+Codec *BatchingTransport::getCodec(void)
+{
+    return m_codec;
+}
+
+erpc_status_t BatchingTransport::flush(void)
+{
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_sendLock);
+#endif
+
+    return sendBatch();
+}
+
+erpc_status_t BatchingTransport::sendBatch(void)
+{
+    erpc_status_t err = kErpcStatus_Success;
+
+    if (m_sendBatch.getUsed() > m_transport->reserveHeaderSize())
+    {
+        err = m_transport->send(&m_sendBatch);
+        m_sendBatch.setUsed(m_transport->reserveHeaderSize());
+    }
+
+    return err;
+}
+
+#if !ERPC_THREADS_IS(NONE)
+void BatchingTransport::flushThread(void)
+{
+    while (!m_stopFlushThread)
+    {
+        // Wait for first queued message of a batch, then give the batch time to fill.
+        (void)m_flushRequest.get();
+        if (!m_stopFlushThread)
+        {
+            Thread::sleep(m_maxDelayUs);
+            (void)flush();
+        }
+    }
+
+    m_flushThreadStopped.put();
+}
+
+void BatchingTransport::flushThreadStub(void *arg)
+{
+    BatchingTransport *transport = reinterpret_cast<BatchingTransport *>(arg);
+
+    if (transport != NULL)
+    {
+        transport->flushThread();
+    }
+}
+#endif
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _EMBEDDED_RPC__BATCHING_TRANSPORT_H_
+#define _EMBEDDED_RPC__BATCHING_TRANSPORT_H_
+
+#include "erpc_codec.hpp"
+#include "erpc_config_internal.h"
+#include "erpc_message_buffer.hpp"
+#include "erpc_transport.hpp"
+
+#if !ERPC_THREADS_IS(NONE)
+#include "erpc_threading.h"
+#endif
+
+/*!
+ * @addtogroup infra_transport
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+
+/*!
+ * @brief Transport packing several messages into one unit of the wrapped transport.
+ *
+ * Each message is prefixed by its size. Oneway messages are queued in a batch buffer, which is
+ * sent when the next message does not fit into it, when the maximal delay since the first queued
+ * message elapses, when flush() is called, or together with the next invocation or reply message.
+ * Invocation and reply messages are never delayed. A message which is alone in its unit is sent
+ * from the caller's buffer without copying. Type of sent message is read by the codec set by
+ * setCodec(), which has to match the message format of clients and servers using this transport.
+ *
+ * The receiving side returns the contained messages one by one from receive(). Both sides of the
+ * communication have to use this transport.
+ *
+ * @ingroup infra_transport
+ */
+class BatchingTransport : public Transport
+{
+public:
+    /*!
+     * @brief Constructor.
+     */
+    BatchingTransport(void);
+
+    /*!
+     * @brief Destructor.
+     */
+    virtual ~BatchingTransport(void);
+
+    /*!
+     * @brief This function initializes the transport.
+     *
+     * Two buffers are taken from the message buffer factory, one for queued messages and one for
+     * received messages which were not returned yet.
+     *
+     * @param[in] transport Wrapped transport sending the batches.
+     * @param[in] messageFactory Message buffer factory for batch buffers.
+     * @param[in] maxDelayUs Maximal time in [us] for which oneway message is queued, 0 for sending
+     * only on flush() or when batch is full. It needs threading support.
+     *
+     * @retval kErpcStatus_Success When transport was initialized.
+     * @retval kErpcStatus_MemoryError When batch buffers were not created.
+     * @retval kErpcStatus_InitFailed When maximal delay is set without threading support.
+     */
+    erpc_status_t init(Transport *transport, MessageBufferFactory *messageFactory, uint32_t maxDelayUs);
+
+    /**
+     * @brief Size of data placed in MessageBuffer before serializing eRPC data.
+     *
+     * @return uint8_t Amount of bytes, reserved before serialized data.
+     */
+    virtual uint8_t reserveHeaderSize(void) override;
+
+    /*!
+     * @brief Receive next message of received batch.
+     *
+     * @param[out] message Will return pointer to received message buffer.
+     *
+     * @return kErpcStatus_ReceiveFailed when batch is malformed, otherwise based on wrapped transport.
+     */
+    virtual erpc_status_t receive(MessageBuffer *message) override;
+
+    /*!
+     * @brief Queue or send message.
+     *
+     * @param[in] message Pass message buffer to send.
+     *
+     * @return based on wrapped transport send.
+     */
+    virtual erpc_status_t send(MessageBuffer *message) override;
+
+    /*!
+     * @brief Check if a message is available.
+     *
+     * @retval True when a received message was not returned yet or wrapped transport has a message.
+     */
+    virtual bool hasMessage(void) override;
+
+    /*!
+     * @brief This functions sets the CRC-16 implementation.
+     *
+     * @param[in] crcImpl Object containing crc-16 compute function.
+     */
+    virtual void setCrc16(Crc16 *crcImpl) override;
+
+    /*!
+     * @brief This functions gets the CRC-16 object.
+     *
+     * @return Crc16* Pointer to CRC-16 object containing crc-16 compute function.
+     */
+    virtual Crc16 *getCrc16(void) override;
+
+    /*!
+     * @brief This function set codec.
+     *
+     * @param[in] codec Codec reading header of sent messages. Used only under send lock.
+     */
+    void setCodec(Codec *codec);
+
+    /*!
+     * @brief This function get codec.
+     *
+     * @return Codec * Pointer to codec used within transport.
+     */
+    Codec *getCodec(void);
+
+    /*!
+     * @brief This function sends all queued messages.
+     *
+     * @return based on wrapped transport send.
+     */
+    erpc_status_t flush(void);
+
+protected:
+    Transport *m_transport;                //!< Wrapped transport.
+    MessageBufferFactory *m_messageFactory; //!< Factory of batch buffers.
+    MessageBuffer m_sendBatch;             //!< Queued messages, used part begins with wrapped transport header.
+    MessageBuffer m_receiveBatch;          //!< Received messages which were not returned yet.
+    message_size_t m_receiveOffset;        //!< Offset of next message in m_receiveBatch.
+    Codec *m_codec;                        //!< Codec used to read type of sent message.
+    uint32_t m_maxDelayUs;                 //!< Maximal time of queuing oneway message.
+#if !ERPC_THREADS_IS(NONE)
+    Mutex m_sendLock;                //!< Mutex guarding the batch buffer and wrapped transport send.
+    Semaphore m_flushRequest;        //!< Signals flush thread that first message was queued.
+    Semaphore m_flushThreadStopped;  //!< Signals flush thread exit.
+    Thread m_flushThread;            //!< Thread sending batch after maximal delay.
+    bool m_flushThreadRunning;       //!< Flush thread was started.
+    volatile bool m_stopFlushThread; //!< Request of flush thread exit.
+#endif
+
+    /*!
+     * @brief This function sends queued messages. Send lock has to be locked.
+     *
+     * @return based on wrapped transport send.
+     */
+    erpc_status_t sendBatch(void);
+
+#if !ERPC_THREADS_IS(NONE)
+    /*!
+     * @brief Flush thread sending batches after maximal delay.
+     */
+    void flushThread(void);
+
+    /*!
+     * @brief Static function passed to the flush thread.
+     *
+     * @param[in] arg BatchingTransport instance.
+     */
+    static void flushThreadStub(void *arg);
+#endif
+
+private:
+    // Disable copy ctor.
+    BatchingTransport(const BatchingTransport &other);            /*!< Disable copy ctor. */
+    BatchingTransport &operator=(const BatchingTransport &other); /*!< Disable copy ctor. */
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__BATCHING_TRANSPORT_H_
@@ -0,0 +1,221 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_config_internal.h"
+#if ERPC_STATS
+
+#include "erpc_call_stats.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#endif
+
+#if !ERPC_HAS_ATOMICS
+#error "ERPC_STATS requires atomic operations."
+#endif
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+CallStats::CallStats(void) : m_dropped(0)
+{
+    uint32_t i;
+    uint32_t phase;
+    uint32_t bucket;
+
+    for (i = 0; i < ERPC_STATS_METHODS_COUNT; ++i)
+    {
+        m_entries[i].key.store(0, std::memory_order_relaxed);
+        m_entries[i].calls.store(0, std::memory_order_relaxed);
+        m_entries[i].errors.store(0, std::memory_order_relaxed);
+        m_entries[i].sampledCalls.store(0, std::memory_order_relaxed);
+        m_entries[i].bytesIn.store(0, std::memory_order_relaxed);
+        m_entries[i].bytesOut.store(0, std::memory_order_relaxed);
+        for (phase = 0; phase < (uint32_t)kErpcCallPhase_Count; ++phase)
+        {
+            m_entries[i].time[phase].store(0, std::memory_order_relaxed);
+            for (bucket = 0; bucket < ERPC_CALL_STATS_BUCKETS; ++bucket)
+            {
+                m_entries[i].histogram[phase][bucket].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+void CallStats::recordCall(uint32_t serviceId, uint32_t methodId, bool error, uint32_t bytesIn, uint32_t bytesOut,
+                           const uint64_t time[kErpcCallPhase_Count])
+{
+    Entry *entry = NULL;
+    uint32_t phase;
+
+    if ((serviceId < 0xffffU) && (methodId < 0xffffU))
+    {
+        entry = findEntry(((serviceId << 16U) | methodId) + 1U);
+    }
+
+    if (entry == NULL)
+    {
+        (void)m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        (void)entry->calls.fetch_add(1, std::memory_order_relaxed);
+        if (error)
+        {
+            (void)entry->errors.fetch_add(1, std::memory_order_relaxed);
+        }
+        (void)entry->bytesIn.fetch_add(bytesIn, std::memory_order_relaxed);
+        (void)entry->bytesOut.fetch_add(bytesOut, std::memory_order_relaxed);
+        if (time != NULL)
+        {
+            (void)entry->sampledCalls.fetch_add(1, std::memory_order_relaxed);
+            for (phase = 0; phase < (uint32_t)kErpcCallPhase_Count; ++phase)
+            {
+                (void)entry->time[phase].fetch_add(time[phase], std::memory_order_relaxed);
+                (void)entry->histogram[phase][getBucket(time[phase])].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+uint32_t CallStats::getCallStats(erpc_call_stats_t *stats, uint32_t maxCount, bool reset)
+{
+    uint32_t count = 0;
+    uint32_t key;
+    uint32_t i;
+    uint32_t phase;
+    uint32_t bucket;
+    erpc_call_stats_t discarded;
+    erpc_call_stats_t *out;
+
+    for (i = 0; i < ERPC_STATS_METHODS_COUNT; ++i)
+    {
+        Entry &entry = m_entries[i];
+
+        key = entry.key.load(std::memory_order_acquire);
+        if (key != 0U)
+        {
+            // Methods which do not fit into the array are still cleared on reset.
+            out = (count < maxCount) ? &stats[count] : &discarded;
+            out->serviceId = (key - 1U) >> 16U;
+            out->methodId = (key - 1U) & 0xffffU;
+            out->calls = readCounter(entry.calls, reset);
+            out->errors = readCounter(entry.errors, reset);
+            out->sampledCalls = readCounter(entry.sampledCalls, reset);
+            out->bytesIn = readCounter(entry.bytesIn, reset);
+            out->bytesOut = readCounter(entry.bytesOut, reset);
+            for (phase = 0; phase < (uint32_t)kErpcCallPhase_Count; ++phase)
+            {
+                out->time[phase] = readCounter(entry.time[phase], reset);
+                for (bucket = 0; bucket < ERPC_CALL_STATS_BUCKETS; ++bucket)
+                {
+                    out->histogram[phase][bucket] = readCounter(entry.histogram[phase][bucket], reset);
+                }
+            }
+            ++count;
+        }
+    }
+
+    if (reset)
+    {
+        m_dropped.store(0, std::memory_order_relaxed);
+    }
+
+    return count;
+}
+
+CallStats::Entry *CallStats::findEntry(uint32_t key)
+{
+    Entry *entry = NULL;
+    uint32_t index = (key * 2654435761U) % ERPC_STATS_METHODS_COUNT;
+    uint32_t probe;
+    uint32_t current;
+
+    for (probe = 0; (entry == NULL) && (probe < ERPC_STATS_METHODS_COUNT); ++probe)
+    {
+        current = m_entries[index].key.load(std::memory_order_acquire);
+        if (current == 0U)
+        {
+            // Claim free entry, another thread may claim it for the same or other method meanwhile.
+            if (!m_entries[index].key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+            {
+                if (current == key)
+                {
+                    entry = &m_entries[index];
+                }
+            }
+            else
+            {
+                entry = &m_entries[index];
+            }
+        }
+        else if (current == key)
+        {
+            entry = &m_entries[index];
+        }
+        else
+        {
+            // Entry of other method.
+        }
+
+        index = (index + 1U) % ERPC_STATS_METHODS_COUNT;
+    }
+
+    return entry;
+}
+
+uint32_t CallStats::getBucket(uint64_t time)
+{
+    uint32_t bucket = 0;
+    uint32_t value = (time > 0xffffffffU) ? 0xffffffffU : (uint32_t)time;
+
+#if defined(__GNUC__)
+    if (value != 0U)
+    {
+        bucket = 31U - (uint32_t)__builtin_clz(value);
+    }
+#else
+    while (value > 1U)
+    {
+        value >>= 1U;
+        ++bucket;
+    }
+#endif
+
+    return bucket;
+}
+
+#if defined(_WIN32)
+uint64_t erpc_call_stats_port_get_time(void)
+{
+    LARGE_INTEGER counter;
+    LARGE_INTEGER frequency;
+
+    (void)QueryPerformanceFrequency(&frequency);
+    (void)QueryPerformanceCounter(&counter);
+
+    return ((uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000000U) +
+           ((uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000000U / (uint64_t)frequency.QuadPart);
+}
+#elif defined(__unix__) || defined(__APPLE__)
+uint64_t erpc_call_stats_port_get_time(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+#endif /* ERPC_STATS */
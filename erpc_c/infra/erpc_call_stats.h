@@ -0,0 +1,218 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _EMBEDDED_RPC__CALL_STATS_H_
+#define _EMBEDDED_RPC__CALL_STATS_H_
+
+#include "erpc_config_internal.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*!
+ * @addtogroup infra_utility
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Number of histogram buckets of each call phase.
+#define ERPC_CALL_STATS_BUCKETS (32U)
+
+//! @brief Phases of a call measured by call statistics.
+typedef enum erpc_call_phase
+{
+    kErpcCallPhase_Decode = 0,    //!< Server: reading of request. Client: reading of reply.
+    kErpcCallPhase_Handler = 1,   //!< Server: served function. Not used by client.
+    kErpcCallPhase_Encode = 2,    //!< Server: writing of reply. Client: writing of request.
+    kErpcCallPhase_Transport = 3, //!< Server: sending of reply. Client: sending of request and waiting for reply.
+    kErpcCallPhase_Count = 4      //!< Number of phases.
+} erpc_call_phase_t;
+
+/*!
+ * @brief Statistics of one method, as returned by erpc_server_get_stats() and erpc_client_get_stats().
+ *
+ * Counters of calls, errors and bytes cover all calls. Times are measured only for one of every
+ * 2^ERPC_STATS_SAMPLE_SHIFT calls, selected by sequence number, counted by sampledCalls. Times are in
+ * nanoseconds. Bucket i of a histogram counts phases which took from 2^i to 2^(i+1) - 1 nanoseconds,
+ * bucket 0 also counts zero durations and the last bucket all longer durations.
+ */
+typedef struct erpc_call_stats
+{
+    uint32_t serviceId;                                                  //!< Service ID.
+    uint32_t methodId;                                                   //!< Method ID.
+    uint32_t calls;                                                      //!< Number of calls.
+    uint32_t errors;                                                     //!< Number of failed calls.
+    uint32_t sampledCalls;                                               //!< Number of calls with measured time.
+    uint64_t bytesIn;                                                    //!< Bytes of received messages.
+    uint64_t bytesOut;                                                   //!< Bytes of sent messages.
+    uint64_t time[kErpcCallPhase_Count];                                 //!< Total time of each phase.
+    uint32_t histogram[kErpcCallPhase_Count][ERPC_CALL_STATS_BUCKETS]; //!< Histogram of each phase.
+} erpc_call_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Returns monotonic time in nanoseconds used by call statistics.
+ *
+ * Implemented for POSIX and Windows, other ports have to implement it when ERPC_STATS is enabled.
+ *
+ * @return Current time in nanoseconds.
+ */
+uint64_t erpc_call_stats_port_get_time(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#if defined(__cplusplus) && ERPC_STATS
+
+#include <atomic>
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+
+/*!
+ * @brief Per method call statistics of client or server.
+ *
+ * Methods are kept in an open addressed table of ERPC_STATS_METHODS_COUNT entries. Entries are claimed
+ * and counters are updated with atomic operations, so recording does not take any lock and calls of
+ * several threads are recorded concurrently. Calls of methods which do not fit into the table are
+ * counted by getDroppedCalls().
+ *
+ * @ingroup infra_utility
+ */
+class CallStats
+{
+public:
+    /*!
+     * @brief CallStats constructor.
+     */
+    CallStats(void);
+
+    /*!
+     * @brief CallStats destructor.
+     */
+    ~CallStats(void) {}
+
+    /*!
+     * @brief This function records one call.
+     *
+     * @param[in] serviceId Service ID, lower than 0xffff.
+     * @param[in] methodId Method ID, lower than 0xffff.
+     * @param[in] error True when the call failed.
+     * @param[in] bytesIn Bytes of received message.
+     * @param[in] bytesOut Bytes of sent message.
+     * @param[in] time Time of each phase in nanoseconds, NULL when the call was not measured.
+     */
+    void recordCall(uint32_t serviceId, uint32_t methodId, bool error, uint32_t bytesIn, uint32_t bytesOut,
+                    const uint64_t time[kErpcCallPhase_Count]);
+
+    /*!
+     * @brief This function copies statistics of recorded methods.
+     *
+     * Counters are read one by one, so a snapshot taken while calls are recorded does not need to be
+     * consistent between counters of one method.
+     *
+     * @param[out] stats Array for statistics, can be NULL when maxCount is 0.
+     * @param[in] maxCount Size of stats array.
+     * @param[in] reset True to clear copied counters.
+     *
+     * @return Number of recorded methods, can be higher than maxCount.
+     */
+    uint32_t getCallStats(erpc_call_stats_t *stats, uint32_t maxCount, bool reset);
+
+    /*!
+     * @brief This function returns number of calls not recorded because the table was full.
+     *
+     * @return Number of dropped calls.
+     */
+    uint32_t getDroppedCalls(void) const { return m_dropped.load(std::memory_order_relaxed); }
+
+    /*!
+     * @brief This function returns if time of a call is measured.
+     *
+     * Client and server select the same calls, as both see the same sequence number.
+     *
+     * @param[in] sequence Sequence number of the call.
+     *
+     * @retval True Time of the call is measured.
+     * @retval False Only counters of the call are updated.
+     */
+    static bool isSampled(uint32_t sequence)
+    {
+        return ((sequence & ((1UL << ERPC_STATS_SAMPLE_SHIFT) - 1U)) == 0U);
+    }
+
+protected:
+    /*!
+     * @brief Statistics of one method.
+     */
+    struct Entry
+    {
+        std::atomic<uint32_t> key; //!< Service and method ID plus one, zero for free entry.
+        std::atomic<uint32_t> calls;
+        std::atomic<uint32_t> errors;
+        std::atomic<uint32_t> sampledCalls;
+        std::atomic<uint64_t> bytesIn;
+        std::atomic<uint64_t> bytesOut;
+        std::atomic<uint64_t> time[kErpcCallPhase_Count];
+        std::atomic<uint32_t> histogram[kErpcCallPhase_Count][ERPC_CALL_STATS_BUCKETS];
+    };
+
+    Entry m_entries[ERPC_STATS_METHODS_COUNT]; //!< Open addressed table of methods.
+    std::atomic<uint32_t> m_dropped;            //!< Calls not recorded because the table was full.
+
+    /*!
+     * @brief This function finds or claims entry of method.
+     *
+     * @param[in] key Service and method ID plus one.
+     *
+     * @return Entry of the method, NULL when the table is full.
+     */
+    Entry *findEntry(uint32_t key);
+
+    /*!
+     * @brief This function reads counter and optionally clears it.
+     *
+     * @param[in] counter Counter to read.
+     * @param[in] reset True to clear the counter.
+     *
+     * @return Value of the counter.
+     */
+    template <typename T>
+    static T readCounter(std::atomic<T> &counter, bool reset)
+    {
+        return reset ? counter.exchange(0, std::memory_order_relaxed) : counter.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * @brief This function returns histogram bucket of a duration.
+     *
+     * @param[in] time Duration in nanoseconds.
+     *
+     * @return Bucket index.
+     */
+    static uint32_t getBucket(uint64_t time);
+};
+
+} // namespace erpc
+
+#endif
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__CALL_STATS_H_
@@ -40,6 +40,10 @@ void ClientManager::performRequest(RequestContext &request)
     // Check the codec status
     performRequest = request.getCodec()->isStatusOk();
 
+#if ERPC_STATS
+    request.markStatsSend();
+#endif
+
 #if ERPC_NESTED_CALLS
     if (performRequest)
     {
@@ -55,12 +59,14 @@ void ClientManager::performRequest(RequestContext &request)
     {
         performClientRequest(request);
     }
+
+#if ERPC_STATS
+    request.markStatsReply();
+#endif
 }
 
 void ClientManager::performClientRequest(RequestContext &request)
 {
-    erpc_status_t err;
-
 #if ERPC_NESTED_CALLS_DETECTION
     if (!request.isOneway() && nestingDetection)
     {
@@ -68,6 +74,56 @@ void ClientManager::performClientRequest(RequestContext &request)
     }
 #endif
 
+    sendRequest(request);
+
+    // If the request is oneway, then there is nothing more to do.
+    if (!request.isOneway())
+    {
+        receiveReply(request);
+    }
+}
+
+void ClientManager::sendStreamRequest(RequestContext &request)
+{
+#if ERPC_STATS
+    request.markStatsSend();
+#endif
+
+#if ERPC_NESTED_CALLS_DETECTION
+    if (nestingDetection)
+    {
+        request.getCodec()->updateStatus(kErpcStatus_NestedCallFailure);
+    }
+#endif
+#if ERPC_NESTED_CALLS
+    // Stream needs the transport for itself, it cannot be received by the server.
+    if ((request.getCodec()->isStatusOk() == true) && (Thread::getCurrentThreadId() == m_serverThreadId))
+    {
+        request.getCodec()->updateStatus(kErpcStatus_NestedCallFailure);
+    }
+#endif
+
+    sendRequest(request);
+}
+
+Stream ClientManager::createStream(RequestContext &request, uint32_t service, uint32_t method)
+{
+    return Stream(request.getCodec(), m_transport, m_messageFactory, service, method, request.getSequence());
+}
+
+void ClientManager::receiveStreamReply(RequestContext &request)
+{
+    receiveReply(request);
+
+#if ERPC_STATS
+    request.markStatsReply();
+#endif
+}
+
+void ClientManager::sendRequest(RequestContext &request)
+{
+    erpc_status_t err;
+
 #if ERPC_MESSAGE_LOGGING
     if (request.getCodec()->isStatusOk() == true)
     {
@@ -82,30 +138,31 @@ void ClientManager::performClientRequest(RequestContext &request)
         err = m_transport->send(&request.getCodec()->getBufferRef());
         request.getCodec()->updateStatus(err);
     }
+}
 
-    // If the request is oneway, then there is nothing more to do.
-    if (!request.isOneway())
+void ClientManager::receiveReply(RequestContext &request)
+{
+    erpc_status_t err;
+
+    if (request.getCodec()->isStatusOk() == true)
     {
-        if (request.getCodec()->isStatusOk() == true)
-        {
-            // Receive reply.
-            err = m_transport->receive(&request.getCodec()->getBufferRef());
-            request.getCodec()->updateStatus(err);
-        }
+        // Receive reply.
+        err = m_transport->receive(&request.getCodec()->getBufferRef());
+        request.getCodec()->updateStatus(err);
+    }
 
 #if ERPC_MESSAGE_LOGGING
-        if (request.getCodec()->isStatusOk() == true)
-        {
-            err = logMessage(request.getCodec()->getBuffer());
-            request.getCodec()->updateStatus(err);
-        }
+    if (request.getCodec()->isStatusOk() == true)
+    {
+        err = logMessage(request.getCodec()->getBuffer());
+        request.getCodec()->updateStatus(err);
+    }
 #endif
 
-        // Check the reply.
-        if (request.getCodec()->isStatusOk() == true)
-        {
-            verifyReply(request);
-        }
+    // Check the reply.
+    if (request.getCodec()->isStatusOk() == true)
+    {
+        verifyReply(request);
     }
 }
 
@@ -185,36 +242,471 @@ void ClientManager::verifyReply(RequestContext &request)
 
 Codec *ClientManager::createBufferAndCodec(void)
 {
-    Codec *codec = m_codecFactory->create();
+    Codec *codec = NULL;
     MessageBuffer message;
     uint8_t reservedMessageSpace = m_transport->reserveHeaderSize();
 
+#if ERPC_CLIENT_REQUEST_CACHE
+    codec = takeCachedCodec(reservedMessageSpace);
+    if (codec == NULL)
+#endif
+    {
+        codec = m_codecFactory->create();
+        if (codec != NULL)
+        {
+            message = m_messageFactory->create(reservedMessageSpace);
+            if (NULL != message.get())
+            {
+                codec->setBuffer(message, reservedMessageSpace);
+            }
+            else
+            {
+                // Dispose of buffers and codecs.
+                m_codecFactory->dispose(codec);
+                codec = NULL;
+            }
+        }
+    }
+
+    return codec;
+}
+
+void ClientManager::disposeBufferAndCodec(Codec *codec)
+{
+    m_messageFactory->dispose(&codec->getBufferRef());
+    m_codecFactory->dispose(codec);
+}
+
+void ClientManager::releaseRequest(RequestContext &request)
+{
+    bool cached = false;
+
+    if (request.getCodec() != NULL)
+    {
+#if ERPC_STATS
+        recordClientCall(request);
+#endif
+#if ERPC_CLIENT_REQUEST_CACHE
+        cached = cacheCodec(request.getCodec());
+#endif
+        if (!cached)
+        {
+            disposeBufferAndCodec(request.getCodec());
+        }
+    }
+}
+
+#if ERPC_CLIENT_REQUEST_CACHE
+Codec *ClientManager::takeCachedCodec(uint8_t reservedMessageSpace)
+{
+    Codec *codec = NULL;
+#if !ERPC_THREADS_IS(NONE)
+    Thread::thread_id_t self = Thread::getCurrentThreadId();
+#endif
+
+    {
+#if !ERPC_THREADS_IS(NONE)
+        Mutex::Guard lock(m_requestCacheLock);
+#endif
+
+        for (uint32_t i = 0U; (codec == NULL) && (i < ERPC_CLIENT_REQUEST_CACHE_SIZE); ++i)
+        {
+#if !ERPC_THREADS_IS(NONE)
+            if (m_requestCache[i].owner == self)
+#endif
+            {
+                // Entry stays owned by this thread while the codec is used.
+                codec = m_requestCache[i].codec;
+                m_requestCache[i].codec = NULL;
+            }
+        }
+    }
+
+    if (codec != NULL)
+    {
+        // Message buffer may hold the last reply, start writing after the transport header again.
+        codec->getBufferRef().setUsed(reservedMessageSpace);
+        codec->reset(reservedMessageSpace);
+    }
+
+    return codec;
+}
+
+bool ClientManager::cacheCodec(Codec *codec)
+{
+    bool cached = false;
+    uint32_t index = ERPC_CLIENT_REQUEST_CACHE_SIZE;
+#if !ERPC_THREADS_IS(NONE)
+    Thread::thread_id_t self = Thread::getCurrentThreadId();
+#endif
+
+    // Buffers of zero-copy message buffer factories belong to the transport once the request was sent.
+    if ((codec->getBufferRef().get() != NULL) && m_messageFactory->createServerBuffer())
+    {
+#if !ERPC_THREADS_IS(NONE)
+        Mutex::Guard lock(m_requestCacheLock);
+#endif
+
+        for (uint32_t i = 0U; i < ERPC_CLIENT_REQUEST_CACHE_SIZE; ++i)
+        {
+#if !ERPC_THREADS_IS(NONE)
+            // Prefer the entry of this thread, otherwise take the first free one.
+            if (m_requestCache[i].owner == self)
+            {
+                index = i;
+                break;
+            }
+            if ((m_requestCache[i].owner == NULL) && (index == ERPC_CLIENT_REQUEST_CACHE_SIZE))
+            {
+                index = i;
+            }
+#else
+            if (m_requestCache[i].codec == NULL)
+            {
+                index = i;
+                break;
+            }
+#endif
+        }
+
+        // Entry of this thread is occupied when a nested or asynchronous request was released first.
+        if ((index < ERPC_CLIENT_REQUEST_CACHE_SIZE) && (m_requestCache[index].codec == NULL))
+        {
+#if !ERPC_THREADS_IS(NONE)
+            m_requestCache[index].owner = self;
+#endif
+            m_requestCache[index].codec = codec;
+            cached = true;
+        }
+    }
+
+    return cached;
+}
+
+void ClientManager::releaseThreadRequestCache(void)
+{
+#if ERPC_THREADS_IS(NONE)
+    // All cached requests belong to the only thread.
+    flushRequestCache();
+#else
+    Codec *codec = NULL;
+    Thread::thread_id_t self = Thread::getCurrentThreadId();
+
+    {
+        Mutex::Guard lock(m_requestCacheLock);
+
+        for (uint32_t i = 0U; i < ERPC_CLIENT_REQUEST_CACHE_SIZE; ++i)
+        {
+            if (m_requestCache[i].owner == self)
+            {
+                codec = m_requestCache[i].codec;
+                m_requestCache[i].owner = NULL;
+                m_requestCache[i].codec = NULL;
+                break;
+            }
+        }
+    }
+
     if (codec != NULL)
     {
-        message = m_messageFactory->create(reservedMessageSpace);
-        if (NULL != message.get())
+        disposeBufferAndCodec(codec);
+    }
+#endif
+}
+
+void ClientManager::flushRequestCache(void)
+{
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_requestCacheLock);
+#endif
+
+    for (uint32_t i = 0U; i < ERPC_CLIENT_REQUEST_CACHE_SIZE; ++i)
+    {
+        if (m_requestCache[i].codec != NULL)
+        {
+            disposeBufferAndCodec(m_requestCache[i].codec);
+        }
+#if !ERPC_THREADS_IS(NONE)
+        m_requestCache[i].owner = NULL;
+#endif
+        m_requestCache[i].codec = NULL;
+    }
+}
+#endif
+
+#if ERPC_STATS
+void ClientManager::recordClientCall(RequestContext &request)
+{
+    uint64_t time[kErpcCallPhase_Count];
+    uint64_t send;
+    uint64_t reply;
+    bool statusOk = request.getCodec()->isStatusOk();
+    uint32_t bytesIn = 0;
+
+    if (!request.isOneway() && statusOk)
+    {
+        bytesIn = request.getCodec()->getBufferRef().getUsed();
+    }
+
+    if (request.m_statsStart == 0U)
+    {
+        // Time of this call is not measured.
+        recordCall(request.m_statsServiceId, request.m_statsMethodId, !statusOk, bytesIn, request.m_statsBytesOut,
+                   NULL);
+    }
+    else
+    {
+        send = (request.m_statsSend != 0U) ? request.m_statsSend : request.m_statsStart;
+        reply = (request.m_statsReply != 0U) ? request.m_statsReply : send;
+
+        time[kErpcCallPhase_Decode] = erpc_call_stats_port_get_time() - reply;
+        time[kErpcCallPhase_Handler] = 0;
+        time[kErpcCallPhase_Encode] = send - request.m_statsStart;
+        time[kErpcCallPhase_Transport] = reply - send;
+
+        recordCall(request.m_statsServiceId, request.m_statsMethodId, !statusOk, bytesIn, request.m_statsBytesOut,
+                   time);
+    }
+}
+#endif
+
+#if ERPC_ASYNC_CALLS
+void ClientManager::performRequestAsync(AsyncRequest &asyncRequest)
+{
+    erpc_status_t err;
+    RequestContext &request = asyncRequest.getRequest();
+
+    asyncRequest.setCompleted(false);
+
+#if ERPC_STATS
+    request.markStatsSend();
+#endif
+
+    // Register the request before it is sent, so the reply cannot be missed by a receiving thread.
+    if (!request.isOneway() && (request.getCodec()->isStatusOk() == true))
+    {
+#if !ERPC_THREADS_IS(NONE)
+        Mutex::Guard lock(m_asyncListLock);
+#endif
+        asyncRequest.setNext(m_asyncRequests);
+        m_asyncRequests = &asyncRequest;
+    }
+
+#if ERPC_MESSAGE_LOGGING
+    if (request.getCodec()->isStatusOk() == true)
+    {
+        err = logMessage(&request.getCodec()->getBufferRef());
+        request.getCodec()->updateStatus(err);
+    }
+#endif
+
+    // Send invocation request to server.
+    if (request.getCodec()->isStatusOk() == true)
+    {
+        err = m_transport->send(&request.getCodec()->getBufferRef());
+        request.getCodec()->updateStatus(err);
+    }
+
+    if (request.isOneway() || (request.getCodec()->isStatusOk() == false))
+    {
+#if ERPC_STATS
+        request.markStatsReply();
+#endif
+        removeAsyncRequest(&asyncRequest);
+        asyncRequest.setCompleted(true);
+    }
+}
+
+void ClientManager::waitForReply(AsyncRequest &asyncRequest)
+{
+    erpc_status_t err;
+
+    while (!asyncRequest.isCompleted())
+    {
+#if !ERPC_THREADS_IS(NONE)
+        Mutex::Guard lock(m_asyncReceiveLock);
+#endif
+
+        // The reply may have been received by another thread while this one was waiting for the lock.
+        if (!asyncRequest.isCompleted())
+        {
+            err = receiveAsyncReply();
+            if ((err != kErpcStatus_Success) && !asyncRequest.isCompleted())
+            {
+                removeAsyncRequest(&asyncRequest);
+                asyncRequest.getRequest().getCodec()->updateStatus(err);
+                asyncRequest.setCompleted(true);
+            }
+        }
+    }
+
+#if ERPC_STATS
+    asyncRequest.getRequest().markStatsReply();
+#endif
+}
+
+erpc_status_t ClientManager::pollReplies(void)
+{
+    erpc_status_t err = kErpcStatus_Success;
+
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_asyncReceiveLock);
+#endif
+
+    while ((err == kErpcStatus_Success) && hasAsyncRequests() && m_transport->hasMessage())
+    {
+        err = receiveAsyncReply();
+    }
+
+    return err;
+}
+
+erpc_status_t ClientManager::receiveAsyncReply(void)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    MessageBuffer buff;
+    Codec *codec;
+    message_type_t msgType;
+    uint32_t service;
+    uint32_t requestNumber;
+    uint32_t sequence;
+    AsyncRequest *asyncRequest = NULL;
+    AsyncRequest *previous = NULL;
+
+    buff = m_messageFactory->create();
+    if (NULL == buff.get())
+    {
+        err = kErpcStatus_MemoryError;
+    }
+
+    if (err == kErpcStatus_Success)
+    {
+        err = m_transport->receive(&buff);
+    }
+
+#if ERPC_MESSAGE_LOGGING
+    if (err == kErpcStatus_Success)
+    {
+        err = logMessage(&buff);
+    }
+#endif
+
+    if (err == kErpcStatus_Success)
+    {
+        codec = m_codecFactory->create();
+        if (codec == NULL)
         {
-            codec->setBuffer(message, reservedMessageSpace);
+            err = kErpcStatus_MemoryError;
         }
         else
         {
-            // Dispose of buffers and codecs.
+            // Parse the message header.
+            codec->setBuffer(buff, m_transport->reserveHeaderSize());
+            codec->startReadMessage(msgType, service, requestNumber, sequence);
+
+            if ((codec->isStatusOk() == true) && (msgType == message_type_t::kReplyMessage))
+            {
+#if !ERPC_THREADS_IS(NONE)
+                Mutex::Guard lock(m_asyncListLock);
+#endif
+                // Find the request this message replies to and remove it from pending requests.
+                asyncRequest = m_asyncRequests;
+                while ((asyncRequest != NULL) && (asyncRequest->getRequest().getSequence() != sequence))
+                {
+                    previous = asyncRequest;
+                    asyncRequest = asyncRequest->getNext();
+                }
+
+                if (asyncRequest != NULL)
+                {
+                    if (previous == NULL)
+                    {
+                        m_asyncRequests = asyncRequest->getNext();
+                    }
+                    else
+                    {
+                        previous->setNext(asyncRequest->getNext());
+                    }
+                }
+            }
+
             m_codecFactory->dispose(codec);
-            codec = NULL;
         }
     }
 
-    return codec;
+    if (asyncRequest != NULL)
+    {
+        // Swap the received message buffer with the request's message buffer.
+        asyncRequest->getRequest().getCodec()->getBufferRef().swap(&buff);
+#if ERPC_STATS
+        asyncRequest->getRequest().markStatsReply();
+#endif
+        verifyReply(asyncRequest->getRequest());
+        asyncRequest->setCompleted(true);
+    }
+
+    // Dispose of the request buffer, or of the message nobody waits for.
+    if (buff.get() != NULL)
+    {
+        m_messageFactory->dispose(&buff);
+    }
+
+    if (err != kErpcStatus_Success)
+    {
+#if !ERPC_THREADS_IS(NONE)
+        Mutex::Guard lock(m_asyncListLock);
+#endif
+        // Receiving failed, no pending request can get its reply.
+        while (m_asyncRequests != NULL)
+        {
+            asyncRequest = m_asyncRequests;
+            m_asyncRequests = asyncRequest->getNext();
+            asyncRequest->getRequest().getCodec()->updateStatus(err);
+            asyncRequest->setCompleted(true);
+        }
+    }
+
+    return err;
 }
 
-void ClientManager::releaseRequest(RequestContext &request)
+void ClientManager::removeAsyncRequest(AsyncRequest *asyncRequest)
 {
-    if (request.getCodec() != NULL)
+    AsyncRequest *node;
+
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_asyncListLock);
+#endif
+
+    if (m_asyncRequests == asyncRequest)
+    {
+        m_asyncRequests = asyncRequest->getNext();
+    }
+    else
     {
-        m_messageFactory->dispose(&request.getCodec()->getBufferRef());
-        m_codecFactory->dispose(request.getCodec());
+        node = m_asyncRequests;
+        while (node != NULL)
+        {
+            if (node->getNext() == asyncRequest)
+            {
+                node->setNext(asyncRequest->getNext());
+                break;
+            }
+            node = node->getNext();
+        }
     }
+
+    asyncRequest->setNext(NULL);
+}
+
+bool ClientManager::hasAsyncRequests(void)
+{
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_asyncListLock);
+#endif
+
+    return (m_asyncRequests != NULL);
 }
+#endif
 
 void ClientManager::callErrorHandler(erpc_status_t err, uint32_t functionID)
 {
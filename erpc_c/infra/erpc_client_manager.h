@@ -13,10 +13,17 @@
 
 #ifdef __cplusplus
 #include "erpc_client_server_common.hpp"
+#include "erpc_stream.hpp"
 #if ERPC_NESTED_CALLS
 #include "erpc_server.hpp"
 #include "erpc_threading.h"
 #endif
+#if ERPC_ASYNC_CALLS || ERPC_CLIENT_REQUEST_CACHE
+#include "erpc_threading.h"
+#endif
+#if ERPC_ASYNC_CALLS && ERPC_HAS_ATOMICS
+#include <atomic>
+#endif
 
 /*!
  * @addtogroup infra_client
@@ -44,6 +51,9 @@ typedef struct ClientType *erpc_client_t;
 
 namespace erpc {
 class RequestContext;
+#if ERPC_ASYNC_CALLS
+class AsyncRequest;
+#endif
 #if ERPC_NESTED_CALLS
 class Server;
 #endif
@@ -66,8 +76,21 @@ public:
 #if ERPC_NESTED_CALLS
     ,
     m_server(NULL), m_serverThreadId(NULL)
+#endif
+#if ERPC_ASYNC_CALLS
+    ,
+    m_asyncRequests(NULL)
 #endif
     {
+#if ERPC_CLIENT_REQUEST_CACHE
+        for (uint32_t i = 0U; i < ERPC_CLIENT_REQUEST_CACHE_SIZE; ++i)
+        {
+#if !ERPC_THREADS_IS(NONE)
+            m_requestCache[i].owner = NULL;
+#endif
+            m_requestCache[i].codec = NULL;
+        }
+#endif
     }
 
     /*!
@@ -89,6 +112,34 @@ public:
      */
     virtual void performRequest(RequestContext &request);
 
+    /*!
+     * @brief This function sends request of function with streamed parameter or return value.
+     *
+     * Data of the stream are then exchanged by stream created by createStream() and the reply is received by
+     * receiveStreamReply(). Nested calls and arbitrated client are not supported for such functions.
+     *
+     * @param[in] request Request context to send.
+     */
+    void sendStreamRequest(RequestContext &request);
+
+    /*!
+     * @brief This function creates stream for data of request sent by sendStreamRequest().
+     *
+     * @param[in] request Request context of the stream.
+     * @param[in] service Service id of the called function.
+     * @param[in] method Id of the called function.
+     *
+     * @return Stream using codec of the request.
+     */
+    Stream createStream(RequestContext &request, uint32_t service, uint32_t method);
+
+    /*!
+     * @brief This function receives reply of request sent by sendStreamRequest().
+     *
+     * @param[in] request Request context to receive reply.
+     */
+    void receiveStreamReply(RequestContext &request);
+
     /*!
      * @brief This function releases request context.
      *
@@ -113,6 +164,57 @@ public:
      */
     void callErrorHandler(erpc_status_t err, uint32_t functionID);
 
+#if ERPC_ASYNC_CALLS
+    /*!
+     * @brief This function sends request without waiting for its reply.
+     *
+     * The request is remembered as pending until its reply is received by waitForReply() or
+     * pollReplies(). Any count of requests can be pending at once, replies are matched by
+     * sequence number, so they can arrive in any order. Synchronous requests must not be
+     * performed on the same client while asynchronous requests are pending.
+     *
+     * @param[in] asyncRequest Asynchronous request with encoded request context. It must stay
+     * valid until the request is completed.
+     */
+    virtual void performRequestAsync(AsyncRequest &asyncRequest);
+
+    /*!
+     * @brief This function blocks until reply of asynchronous request is received.
+     *
+     * Replies of other pending requests received meanwhile are stored to their requests.
+     * Returns immediately when request is already completed.
+     *
+     * @param[in] asyncRequest Asynchronous request to wait for.
+     */
+    virtual void waitForReply(AsyncRequest &asyncRequest);
+
+    /*!
+     * @brief This function receives replies of pending requests which are already available.
+     *
+     * Does not block when transport has no message, useful for bare-metal main loops.
+     *
+     * @return Status of receiving, #kErpcStatus_Success when no message was available.
+     */
+    virtual erpc_status_t pollReplies(void);
+#endif
+
+#if ERPC_CLIENT_REQUEST_CACHE
+    /*!
+     * @brief This function disposes codec and message buffer cached for the calling thread.
+     *
+     * Call it before a thread which performed requests exits, so its cache entry can be used by other threads.
+     */
+    void releaseThreadRequestCache(void);
+
+    /*!
+     * @brief This function disposes codecs and message buffers cached for all threads.
+     *
+     * Has to be called before codec factory or message buffer factory is changed or destroyed, while no request
+     * is in progress.
+     */
+    void flushRequestCache(void);
+#endif
+
 #if ERPC_NESTED_CALLS
     /*!
      * @brief This function sets server used for nested calls.
@@ -135,6 +237,27 @@ protected:
 #if ERPC_NESTED_CALLS
     Server *m_server;                     //!< Server used for nested calls.
     Thread::thread_id_t m_serverThreadId; //!< Thread in which server run function is called.
+#endif
+#if ERPC_ASYNC_CALLS
+    AsyncRequest *m_asyncRequests; //!< Asynchronous requests waiting for reply.
+#if !ERPC_THREADS_IS(NONE)
+    Mutex m_asyncListLock;    //!< Guards list of pending asynchronous requests.
+    Mutex m_asyncReceiveLock; //!< Only one thread receives replies of asynchronous requests.
+#endif
+#endif
+#if ERPC_CLIENT_REQUEST_CACHE
+    //! @brief Codec with message buffer kept for the next request of one thread.
+    struct CachedRequest
+    {
+#if !ERPC_THREADS_IS(NONE)
+        Thread::thread_id_t owner; //!< Thread owning this entry, NULL when the entry is free.
+#endif
+        Codec *codec; //!< Cached codec with its message buffer, NULL while used by a request.
+    };
+    CachedRequest m_requestCache[ERPC_CLIENT_REQUEST_CACHE_SIZE]; //!< Cached requests of calling threads.
+#if !ERPC_THREADS_IS(NONE)
+    Mutex m_requestCacheLock; //!< Guards cached requests.
+#endif
 #endif
 
     /*!
@@ -147,6 +270,29 @@ protected:
      */
     virtual void performClientRequest(RequestContext &request);
 
+    /*!
+     * @brief This function sends request message to server.
+     *
+     * @param[in] request Request context to send.
+     */
+    void sendRequest(RequestContext &request);
+
+    /*!
+     * @brief This function receives and validates reply message of request.
+     *
+     * @param[in] request Request context to receive reply.
+     */
+    void receiveReply(RequestContext &request);
+
+#if ERPC_STATS
+    /*!
+     * @brief This function records call statistics of finished request.
+     *
+     * @param[in] request Request context to record.
+     */
+    void recordClientCall(RequestContext &request);
+#endif
+
 #if ERPC_NESTED_CALLS
     /*!
      * @brief This function performs nested request.
@@ -171,6 +317,60 @@ protected:
      */
     Codec *createBufferAndCodec(void);
 
+    /*!
+     * @brief Dispose message buffer and codec created by createBufferAndCodec().
+     *
+     * @param[in] codec Codec with message buffer to dispose.
+     */
+    void disposeBufferAndCodec(Codec *codec);
+
+#if ERPC_CLIENT_REQUEST_CACHE
+    /*!
+     * @brief Take codec with message buffer cached for the calling thread.
+     *
+     * @param[in] reservedMessageSpace Size of transport header reserved at the beginning of message buffer.
+     *
+     * @return Cached codec prepared for writing new request, NULL when the thread has no cached codec.
+     */
+    Codec *takeCachedCodec(uint8_t reservedMessageSpace);
+
+    /*!
+     * @brief Keep codec with message buffer of released request for the next request of the calling thread.
+     *
+     * @param[in] codec Codec of released request.
+     *
+     * @retval true Codec was cached.
+     * @retval false Codec was not cached and has to be disposed.
+     */
+    bool cacheCodec(Codec *codec);
+#endif
+
+#if ERPC_ASYNC_CALLS
+    /*!
+     * @brief Receives one message and completes pending request it replies to.
+     *
+     * Unknown replies are dropped. When receiving fails, all pending requests are completed
+     * with the error.
+     *
+     * @return Status of receiving.
+     */
+    erpc_status_t receiveAsyncReply(void);
+
+    /*!
+     * @brief Removes asynchronous request from list of pending requests.
+     *
+     * @param[in] asyncRequest Asynchronous request to remove.
+     */
+    void removeAsyncRequest(AsyncRequest *asyncRequest);
+
+    /*!
+     * @brief Returns information if any asynchronous request waits for reply.
+     *
+     * @retval True when list of pending requests is not empty.
+     */
+    bool hasAsyncRequests(void);
+#endif
+
 private:
     ClientManager(const ClientManager &other);            //!< Disable copy ctor.
     ClientManager &operator=(const ClientManager &other); //!< Disable copy ctor.
@@ -195,6 +395,12 @@ public:
      */
     RequestContext(uint32_t sequence, Codec *codec, bool argIsOneway) :
     m_sequence(sequence), m_codec(codec), m_oneway(argIsOneway)
+#if ERPC_STATS
+    ,
+    m_statsServiceId(UINT32_MAX), m_statsMethodId(UINT32_MAX),
+    m_statsStart(CallStats::isSampled(sequence) ? erpc_call_stats_port_get_time() : 0U), m_statsSend(0),
+    m_statsReply(0), m_statsBytesOut(0)
+#endif
     {
     }
 
@@ -226,12 +432,170 @@ public:
      */
     void setIsOneway(bool oneway) { m_oneway = oneway; }
 
+#if ERPC_STATS
+    /*!
+     * @brief This function sets called method for call statistics.
+     *
+     * @param[in] serviceId Service ID.
+     * @param[in] methodId Method ID.
+     */
+    void setMethodId(uint32_t serviceId, uint32_t methodId)
+    {
+        m_statsServiceId = serviceId;
+        m_statsMethodId = methodId;
+    }
+
+    /*!
+     * @brief This function stores size and time of written request before it is sent.
+     */
+    void markStatsSend(void)
+    {
+        if (m_statsStart != 0U)
+        {
+            m_statsSend = erpc_call_stats_port_get_time();
+        }
+        m_statsBytesOut = m_codec->getBufferRef().getUsed();
+    }
+
+    /*!
+     * @brief This function stores time when reply was received, when not stored already.
+     */
+    void markStatsReply(void)
+    {
+        if ((m_statsStart != 0U) && (m_statsReply == 0U))
+        {
+            m_statsReply = erpc_call_stats_port_get_time();
+        }
+    }
+#endif
+
 protected:
     uint32_t m_sequence; //!< Sequence number. To be sure that reply belong to current request.
     Codec *m_codec;      //!< Inout codec. Codec for receiving and sending data.
     bool m_oneway;       //!< When true, request context will be oneway type (only send data).
+#if ERPC_STATS
+    uint32_t m_statsServiceId; //!< Service ID for call statistics.
+    uint32_t m_statsMethodId;  //!< Method ID for call statistics.
+    uint64_t m_statsStart;     //!< Time when request was created, zero when time is not measured.
+    uint64_t m_statsSend;      //!< Time when request was sent.
+    uint64_t m_statsReply;     //!< Time when reply was received.
+    uint32_t m_statsBytesOut;  //!< Size of sent request.
+
+    friend class ClientManager;
+#endif
 };
 
+#if ERPC_ASYNC_CALLS
+/*!
+ * @brief Completion handle of a request sent without waiting for its reply.
+ *
+ * Filled by generated client functions with _async suffix and consumed by functions with
+ * _async_result suffix, which wait for the reply, decode it and release the request. The
+ * result must be collected also when the _async function failed, the error is then reported
+ * by the _async_result function. The object must stay valid while the request is in flight.
+ * It can be reused after the result was collected.
+ *
+ * @ingroup infra_client
+ */
+class AsyncRequest
+{
+public:
+    /*!
+     * @brief Constructor.
+     */
+    AsyncRequest(void) : m_request(0, NULL, false), m_completed(true), m_token(0), m_next(NULL) {}
+
+    /*!
+     * @brief Get request context of this asynchronous request.
+     *
+     * @return Request context.
+     */
+    RequestContext &getRequest(void) { return m_request; }
+
+    /*!
+     * @brief Returns information if reply was already received or request failed.
+     *
+     * Replies are collected by ClientManager::waitForReply() or ClientManager::pollReplies().
+     *
+     * @retval True when request is completed, else false.
+     */
+    bool isCompleted(void) const
+    {
+#if ERPC_HAS_ATOMICS
+        // Pairs with setCompleted(), reply in the codec is visible once completion is seen.
+        return m_completed.load(std::memory_order_acquire);
+#else
+#if !ERPC_THREADS_IS(NONE)
+        Mutex::Guard lock(m_completedLock);
+#endif
+        return m_completed;
+#endif
+    }
+
+    /*!
+     * @brief Set request completion state.
+     *
+     * @param[in] completed True when request is completed.
+     */
+    void setCompleted(bool completed)
+    {
+#if ERPC_HAS_ATOMICS
+        m_completed.store(completed, std::memory_order_release);
+#else
+#if !ERPC_THREADS_IS(NONE)
+        Mutex::Guard lock(m_completedLock);
+#endif
+        m_completed = completed;
+#endif
+    }
+
+    /*!
+     * @brief Get token of transport arbitrator used for this request.
+     *
+     * @return Arbitrator token, 0 when not used.
+     */
+    uintptr_t getToken(void) const { return m_token; }
+
+    /*!
+     * @brief Set token of transport arbitrator used for this request.
+     *
+     * @param[in] token Arbitrator token.
+     */
+    void setToken(uintptr_t token) { m_token = token; }
+
+    /*!
+     * @brief Get next pending request.
+     *
+     * @return Next pending request.
+     */
+    AsyncRequest *getNext(void) { return m_next; }
+
+    /*!
+     * @brief Set next pending request.
+     *
+     * @param[in] next Next pending request.
+     */
+    void setNext(AsyncRequest *next) { m_next = next; }
+
+protected:
+    RequestContext m_request; //!< Request context with codec holding request, later reply.
+#if ERPC_HAS_ATOMICS
+    std::atomic<bool> m_completed; //!< True when reply was received or request failed.
+#else
+#if !ERPC_THREADS_IS(NONE)
+    mutable Mutex m_completedLock; //!< Guards m_completed.
+#endif
+    bool m_completed; //!< True when reply was received or request failed.
+#endif
+    uintptr_t m_token;    //!< Transport arbitrator token, used by ArbitratedClientManager.
+    AsyncRequest *m_next; //!< Next pending request.
+
+private:
+    AsyncRequest(const AsyncRequest &other);            //!< Disable copy ctor.
+    AsyncRequest &operator=(const AsyncRequest &other); //!< Disable copy ctor.
+};
+#endif
+
 } // namespace erpc
 
 /*! @} */
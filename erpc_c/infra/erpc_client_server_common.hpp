@@ -18,6 +18,9 @@
 #if ERPC_PRE_POST_ACTION
 #include "erpc_pre_post_action.h"
 #endif
+#if ERPC_STATS
+#include "erpc_call_stats.h"
+#endif
 
 /*!
  * @addtogroup infra_transport
@@ -55,6 +58,15 @@ class ClientServerCommon
 #endif
     public PrePostAction
 #endif
+#if ERPC_STATS
+#ifdef ERPC_OTHER_INHERITANCE
+    ,
+#else
+#define ERPC_OTHER_INHERITANCE 1
+:
+#endif
+    public CallStats
+#endif
 {
 public:
     /*!
@@ -82,6 +94,15 @@ public:
 #endif
         PrePostAction()
 #endif
+#if ERPC_STATS
+#ifdef ERPC_OTHER_INHERITANCE
+            ,
+#else
+#define ERPC_OTHER_INHERITANCE 1
+    :
+#endif
+        CallStats()
+#endif
 #ifdef ERPC_OTHER_INHERITANCE
             ,
 #else
@@ -12,8 +12,16 @@
 #define _EMBEDDED_RPC__CODEC_H_
 
 #include "erpc_common.h"
+#include "erpc_config_internal.h"
+#include ENDIANNESS_HEADER
 #include "erpc_message_buffer.hpp"
 #include "erpc_transport.hpp"
+#if ERPC_STATS
+#include "erpc_call_stats.h"
+#endif
+#if ERPC_SERVER_ARENA
+#include "erpc_arena.hpp"
+#endif
 
 #include <cstdint>
 #include <cstring>
@@ -37,7 +45,19 @@ enum class message_type_t
     kInvocationMessage = 0,
     kOnewayMessage,
     kReplyMessage,
-    kNotificationMessage
+    kNotificationMessage,
+    kStreamChunkMessage, /*!< Part of streamed parameter or return value. */
+    kStreamAckMessage    /*!< Count of stream chunks received, sent back to the sender of chunks. */
+};
+
+/*!
+ * @brief Kinds of scalar array and list elements, codecs with variable length encoding code them differently.
+ */
+enum class element_kind_t
+{
+    kUnsigned = 0, /*!< Unsigned integer or boolean. */
+    kSigned,       /*!< Signed integer or enumeration. */
+    kFloat         /*!< Floating point number. */
 };
 
 typedef void *funPtr;          // Pointer to functions
@@ -58,7 +78,18 @@ public:
      *
      * This function initializes object attributes.
      */
-    Codec(void) : m_cursor(), m_status(kErpcStatus_Success) {}
+    Codec(void) :
+    m_cursor(), m_status(kErpcStatus_Success)
+#if ERPC_STATS
+    ,
+    m_handlerTimed(false), m_handlerStart(0), m_handlerEnd(0)
+#endif
+#if ERPC_SERVER_ARENA
+    ,
+    m_arena(NULL)
+#endif
+    {
+    }
 
     /*!
      * @brief Codec destructor
@@ -126,6 +157,72 @@ public:
         }
     }
 
+#if ERPC_STATS
+    /*!
+     * @brief This function stores time when server shim calls the served function, when enabled.
+     */
+    void markHandlerStart(void)
+    {
+        if (m_handlerTimed)
+        {
+            m_handlerStart = erpc_call_stats_port_get_time();
+        }
+    }
+
+    /*!
+     * @brief This function stores time when served function returned to server shim, when enabled.
+     */
+    void markHandlerEnd(void)
+    {
+        if (m_handlerTimed)
+        {
+            m_handlerEnd = erpc_call_stats_port_get_time();
+        }
+    }
+
+    /*!
+     * @brief This function clears stored served function times.
+     *
+     * @param[in] timed True when markHandlerStart() and markHandlerEnd() should store time.
+     */
+    void clearHandlerMarks(bool timed)
+    {
+        m_handlerTimed = timed;
+        m_handlerStart = 0;
+        m_handlerEnd = 0;
+    }
+
+    /*!
+     * @brief This function returns time when served function was called, zero when not called.
+     *
+     * @return Time in nanoseconds.
+     */
+    uint64_t getHandlerStart(void) const { return m_handlerStart; }
+
+    /*!
+     * @brief This function returns time when served function returned, zero when not returned.
+     *
+     * @return Time in nanoseconds.
+     */
+    uint64_t getHandlerEnd(void) const { return m_handlerEnd; }
+#endif
+
+#if ERPC_SERVER_ARENA
+    /*!
+     * @brief Set arena for parameters decoded by server shim.
+     *
+     * @param[in] arena Arena of the server thread, NULL when parameters are allocated by erpc_malloc().
+     */
+    void setArena(Arena *arena) { m_arena = arena; }
+
+    /*!
+     * @brief Return arena for parameters decoded by server shim.
+     *
+     * @return Arena or NULL.
+     */
+    Arena *getArena(void) const { return m_arena; }
+#endif
+
     //! @name Encoding
     //@{
     /*!
@@ -239,6 +336,48 @@ public:
      */
     virtual void writeBinary(uint32_t length, const uint8_t *value) = 0;
 
+    /*!
+     * @brief Prototype for write array of scalar values.
+     *
+     * Writes elements of an array or a list at once. Elements are encoded the same way as by writing them one by one.
+     *
+     * @param[in] length Count of elements.
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     * @param[in] value Elements to write.
+     */
+    virtual void writeArray(uint32_t length, uint8_t elementSize, element_kind_t kind, const void *value) = 0;
+
+    /*!
+     * @brief Return the most bytes one element written by writeArray() can take.
+     *
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     *
+     * @return Maximal size of encoded element.
+     */
+    virtual uint32_t getArrayElementMaxSize(uint8_t elementSize, element_kind_t kind) const
+    {
+        (void)kind;
+        return elementSize;
+    }
+
+    /*!
+     * @brief Reserve message data of fixed size to write values directly.
+     *
+     * Generated code fills the returned memory with writeFixed() functions, which encode values as BasicCodec does.
+     * Codecs with other encoding return null and the values are written one by one.
+     *
+     * @param[in] length Count of bytes to reserve.
+     *
+     * @return Reserved memory in the message buffer. Null when not supported or in case of error.
+     */
+    virtual uint8_t *reserveWrite(uint32_t length)
+    {
+        (void)length;
+        return NULL;
+    }
+
     /*!
      * @brief Prototype for start write list.
      *
@@ -374,6 +513,57 @@ public:
      */
     virtual void readBinary(uint32_t &length, uint8_t **value) = 0;
 
+    /*!
+     * @brief Prototype for read string value in place.
+     *
+     * The string is not copied out of the message buffer. It stays valid while the buffer is not reused.
+     *
+     * @param[out] length of string.
+     * @param[out] value Zero terminated string inside of the message buffer. Null in case of error.
+     */
+    virtual void readBorrowedString(uint32_t &length, char **value) = 0;
+
+    /*!
+     * @brief Prototype for read list of scalar values in place.
+     *
+     * Called after startReadList(). The elements are not copied out of the message buffer, they are aligned
+     * and converted to processor endianness in place. They stay valid while the buffer is not reused.
+     *
+     * @param[in] length Count of list elements.
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     * @param[out] value Elements inside of the message buffer. Null in case of error.
+     */
+    virtual void readBorrowedList(uint32_t length, uint8_t elementSize, element_kind_t kind, void **value) = 0;
+
+    /*!
+     * @brief Prototype for read array of scalar values.
+     *
+     * Reads elements of an array or a list written by writeArray() at once.
+     *
+     * @param[in] length Count of elements.
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     * @param[out] value Memory for elements.
+     */
+    virtual void readArray(uint32_t length, uint8_t elementSize, element_kind_t kind, void *value) = 0;
+
+    /*!
+     * @brief Reserve message data of fixed size to read values directly.
+     *
+     * Generated code reads the returned memory with readFixed() functions. Codecs with encoding other than BasicCodec
+     * return null and the values are read one by one.
+     *
+     * @param[in] length Count of bytes to reserve.
+     *
+     * @return Reserved memory in the message buffer. Null when not supported or in case of error.
+     */
+    virtual const uint8_t *reserveRead(uint32_t length)
+    {
+        (void)length;
+        return NULL;
+    }
+
     /*!
      * @brief Prototype for start read list.
      *
@@ -398,6 +588,14 @@ public:
 protected:
     Cursor m_cursor;        /*!< Copy data to message buffers. */
     erpc_status_t m_status; /*!< Status of serialized data. */
+#if ERPC_STATS
+    bool m_handlerTimed;     /*!< True when served function times are stored. */
+    uint64_t m_handlerStart; /*!< Time when served function was called. */
+    uint64_t m_handlerEnd;   /*!< Time when served function returned. */
+#endif
+#if ERPC_SERVER_ARENA
+    Arena *m_arena; /*!< Arena for parameters decoded by server shim. */
+#endif
 };
 
 /*!
@@ -433,6 +631,140 @@ public:
     virtual void dispose(Codec *codec) = 0;
 };
 
+//! @name Fixed size coders
+//! Write and read values as BasicCodec does, in memory reserved by Codec::reserveWrite() and Codec::reserveRead().
+//! Memory does not need to be aligned.
+//@{
+inline void writeFixed(uint8_t *data, uint8_t value)
+{
+    data[0] = value;
+}
+
+inline void writeFixed(uint8_t *data, uint16_t value)
+{
+    ERPC_WRITE_AGNOSTIC_16(value);
+    (void)memcpy(data, &value, sizeof(value));
+}
+
+inline void writeFixed(uint8_t *data, uint32_t value)
+{
+    ERPC_WRITE_AGNOSTIC_32(value);
+    (void)memcpy(data, &value, sizeof(value));
+}
+
+inline void writeFixed(uint8_t *data, uint64_t value)
+{
+    ERPC_WRITE_AGNOSTIC_64(value);
+    (void)memcpy(data, &value, sizeof(value));
+}
+
+inline void writeFixed(uint8_t *data, bool value)
+{
+    data[0] = value ? 1U : 0U;
+}
+
+inline void writeFixed(uint8_t *data, int8_t value)
+{
+    writeFixed(data, (uint8_t)value);
+}
+
+inline void writeFixed(uint8_t *data, int16_t value)
+{
+    writeFixed(data, (uint16_t)value);
+}
+
+inline void writeFixed(uint8_t *data, int32_t value)
+{
+    writeFixed(data, (uint32_t)value);
+}
+
+inline void writeFixed(uint8_t *data, int64_t value)
+{
+    writeFixed(data, (uint64_t)value);
+}
+
+inline void writeFixed(uint8_t *data, float value)
+{
+    ERPC_WRITE_AGNOSTIC_FLOAT(value);
+    (void)memcpy(data, &value, sizeof(value));
+}
+
+inline void writeFixed(uint8_t *data, double value)
+{
+    ERPC_WRITE_AGNOSTIC_DOUBLE(value);
+    (void)memcpy(data, &value, sizeof(value));
+}
+
+inline void readFixed(const uint8_t *data, uint8_t &value)
+{
+    value = data[0];
+}
+
+inline void readFixed(const uint8_t *data, uint16_t &value)
+{
+    (void)memcpy(&value, data, sizeof(value));
+    ERPC_READ_AGNOSTIC_16(value);
+}
+
+inline void readFixed(const uint8_t *data, uint32_t &value)
+{
+    (void)memcpy(&value, data, sizeof(value));
+    ERPC_READ_AGNOSTIC_32(value);
+}
+
+inline void readFixed(const uint8_t *data, uint64_t &value)
+{
+    (void)memcpy(&value, data, sizeof(value));
+    ERPC_READ_AGNOSTIC_64(value);
+}
+
+inline void readFixed(const uint8_t *data, bool &value)
+{
+    value = (data[0] != 0U);
+}
+
+inline void readFixed(const uint8_t *data, int8_t &value)
+{
+    value = (int8_t)data[0];
+}
+
+inline void readFixed(const uint8_t *data, int16_t &value)
+{
+    uint16_t v;
+
+    readFixed(data, v);
+    value = (int16_t)v;
+}
+
+inline void readFixed(const uint8_t *data, int32_t &value)
+{
+    uint32_t v;
+
+    readFixed(data, v);
+    value = (int32_t)v;
+}
+
+inline void readFixed(const uint8_t *data, int64_t &value)
+{
+    uint64_t v;
+
+    readFixed(data, v);
+    value = (int64_t)v;
+}
+
+inline void readFixed(const uint8_t *data, float &value)
+{
+    (void)memcpy(&value, data, sizeof(value));
+    ERPC_READ_AGNOSTIC_FLOAT(value);
+}
+
+inline void readFixed(const uint8_t *data, double &value)
+{
+    (void)memcpy(&value, data, sizeof(value));
+    ERPC_READ_AGNOSTIC_DOUBLE(value);
+}
+//@}
+
 } // namespace erpc
 
 /*! @} */
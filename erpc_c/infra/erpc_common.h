@@ -84,6 +84,19 @@ enum _erpc_status
 /*! @brief Type used for all status and error return values. */
 typedef enum _erpc_status erpc_status_t;
 
+/*! @brief Message formats selectable by setup functions. */
+enum _erpc_codec
+{
+    //! Fixed size little endian values, BasicCodec. Default.
+    kErpcCodec_Basic = 0,
+
+    //! Variable length integers, CompactCodec.
+    kErpcCodec_Compact
+};
+
+/*! @brief Type used for selecting message format. */
+typedef enum _erpc_codec erpc_codec_t;
+
 /*! @} */
 
 #endif /* _EMBEDDED_RPC__ERPC_COMMON_H_ */
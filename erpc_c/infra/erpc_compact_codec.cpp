@@ -0,0 +1,505 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_compact_codec.hpp"
+
+#include "erpc_config_internal.h"
+#include "erpc_manually_constructed.hpp"
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+#include <new>
+#endif
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+const uint32_t CompactCodec::kCompactCodecVersion = 1UL;
+
+/*!
+ * @brief Map signed value to unsigned one, small absolute values to small numbers.
+ */
+static inline uint64_t zigzagEncode(int64_t value)
+{
+    return (value < 0) ? ~((uint64_t)value << 1U) : ((uint64_t)value << 1U);
+}
+
+/*!
+ * @brief Map unsigned value back to signed one.
+ */
+static inline int64_t zigzagDecode(uint64_t value)
+{
+    return (int64_t)(((value & 1U) != 0U) ? ~(value >> 1U) : (value >> 1U));
+}
+
+/*!
+ * @brief Decode varint from memory.
+ *
+ * @param[in] data Encoded varint.
+ * @param[in] available Count of bytes which can be read.
+ * @param[out] value Decoded value.
+ *
+ * @return Count of read bytes, 0 for truncated varint or varint over 64 bits.
+ */
+static uint32_t decodeVarint(const uint8_t *data, uint32_t available, uint64_t &value)
+{
+    uint64_t result = 0U;
+    uint32_t shift = 0U;
+    uint32_t count = 0U;
+    uint8_t byte = 0x80U;
+
+    while (((byte & 0x80U) != 0U) && (count < available))
+    {
+        byte = data[count];
+        ++count;
+        if ((shift > 63U) || ((shift == 63U) && ((byte & 0x7eU) != 0U)))
+        {
+            // Value does not fit into 64 bits.
+            count = available;
+            byte = 0x80U;
+        }
+        else
+        {
+            result |= ((uint64_t)byte & 0x7fU) << shift;
+            shift += 7U;
+        }
+    }
+
+    if ((byte & 0x80U) != 0U)
+    {
+        count = 0U;
+    }
+    else
+    {
+        value = result;
+    }
+
+    return count;
+}
+
+CompactCodec::CompactCodec(void) : BasicCodec() {}
+
+CompactCodec::~CompactCodec(void) {}
+
+void CompactCodec::startWriteMessage(message_type_t type, uint32_t service, uint32_t request, uint32_t sequence)
+{
+    uint8_t header = (uint8_t)((kCompactCodecVersion << 4U) | ((uint32_t)type & 0x0fU));
+
+    write(header);
+    write(service);
+    write(request);
+    write(sequence);
+}
+
+void CompactCodec::writeVarint(uint64_t value)
+{
+    uint8_t data[10];
+    uint32_t length = 0U;
+
+    while (value >= 0x80U)
+    {
+        data[length] = (uint8_t)(value | 0x80U);
+        ++length;
+        value >>= 7U;
+    }
+    data[length] = (uint8_t)value;
+    ++length;
+
+    writeData(length, data);
+}
+
+void CompactCodec::write(int16_t value)
+{
+    writeVarint(zigzagEncode(value));
+}
+
+void CompactCodec::write(int32_t value)
+{
+    writeVarint(zigzagEncode(value));
+}
+
+void CompactCodec::write(int64_t value)
+{
+    writeVarint(zigzagEncode(value));
+}
+
+void CompactCodec::write(uint16_t value)
+{
+    writeVarint(value);
+}
+
+void CompactCodec::write(uint32_t value)
+{
+    writeVarint(value);
+}
+
+void CompactCodec::write(uint64_t value)
+{
+    writeVarint(value);
+}
+
+void CompactCodec::writeArray(uint32_t length, uint8_t elementSize, element_kind_t kind, const void *value)
+{
+    bool isSigned = (kind == element_kind_t::kSigned);
+    uint32_t i;
+
+    if ((elementSize == 1U) || (kind == element_kind_t::kFloat))
+    {
+        // Fixed size encoding.
+        BasicCodec::writeArray(length, elementSize, kind, value);
+    }
+    else
+    {
+        erpc_assert((elementSize == 2U) || (elementSize == 4U) || (elementSize == 8U));
+
+        for (i = 0U; (i < length) && isStatusOk(); ++i)
+        {
+            switch (elementSize)
+            {
+                case 2U:
+                    writeVarint(isSigned ? zigzagEncode(static_cast<const int16_t *>(value)[i]) :
+                                           static_cast<const uint16_t *>(value)[i]);
+                    break;
+                case 4U:
+                    writeVarint(isSigned ? zigzagEncode(static_cast<const int32_t *>(value)[i]) :
+                                           static_cast<const uint32_t *>(value)[i]);
+                    break;
+                default:
+                    writeVarint(isSigned ? zigzagEncode(static_cast<const int64_t *>(value)[i]) :
+                                           static_cast<const uint64_t *>(value)[i]);
+                    break;
+            }
+        }
+    }
+}
+
+uint32_t CompactCodec::getArrayElementMaxSize(uint8_t elementSize, element_kind_t kind) const
+{
+    uint32_t size = elementSize;
+
+    if ((elementSize != 1U) && (kind != element_kind_t::kFloat))
+    {
+        size = ((uint32_t)elementSize * 8U + 6U) / 7U;
+    }
+
+    return size;
+}
+
+uint8_t *CompactCodec::reserveWrite(uint32_t length)
+{
+    (void)length;
+
+    return NULL;
+}
+
+void CompactCodec::startReadMessage(message_type_t &type, uint32_t &service, uint32_t &request, uint32_t &sequence)
+{
+    uint8_t header = 0U;
+
+    read(header);
+
+    if (isStatusOk() && ((uint32_t)(header >> 4U) != kCompactCodecVersion))
+    {
+        updateStatus(kErpcStatus_InvalidMessageVersion);
+    }
+
+    if (isStatusOk())
+    {
+        type = static_cast<message_type_t>(header & 0x0fU);
+
+        read(service);
+        read(request);
+        read(sequence);
+    }
+}
+
+void CompactCodec::readVarint(uint64_t &value, uint64_t maxValue)
+{
+    uint64_t result = 0U;
+    uint32_t count;
+
+    if (isStatusOk())
+    {
+        count = decodeVarint(m_cursor.get(), m_cursor.getRemainingUsed(), result);
+        if ((count == 0U) || (result > maxValue))
+        {
+            m_status = kErpcStatus_Fail;
+        }
+        else
+        {
+            (void)(m_cursor += (message_size_t)count);
+            value = result;
+        }
+    }
+}
+
+void CompactCodec::read(int16_t &value)
+{
+    uint64_t v = 0U;
+
+    readVarint(v, UINT16_MAX);
+    if (isStatusOk())
+    {
+        value = (int16_t)zigzagDecode(v);
+    }
+}
+
+void CompactCodec::read(int32_t &value)
+{
+    uint64_t v = 0U;
+
+    readVarint(v, UINT32_MAX);
+    if (isStatusOk())
+    {
+        value = (int32_t)zigzagDecode(v);
+    }
+}
+
+void CompactCodec::read(int64_t &value)
+{
+    uint64_t v = 0U;
+
+    readVarint(v, UINT64_MAX);
+    if (isStatusOk())
+    {
+        value = zigzagDecode(v);
+    }
+}
+
+void CompactCodec::read(uint16_t &value)
+{
+    uint64_t v = 0U;
+
+    readVarint(v, UINT16_MAX);
+    if (isStatusOk())
+    {
+        value = (uint16_t)v;
+    }
+}
+
+void CompactCodec::read(uint32_t &value)
+{
+    uint64_t v = 0U;
+
+    readVarint(v, UINT32_MAX);
+    if (isStatusOk())
+    {
+        value = (uint32_t)v;
+    }
+}
+
+void CompactCodec::read(uint64_t &value)
+{
+    readVarint(value, UINT64_MAX);
+}
+
+void CompactCodec::readBorrowedList(uint32_t length, uint8_t elementSize, element_kind_t kind, void **value)
+{
+    MessageBuffer &buffer = m_cursor.getBufferRef();
+    uint8_t *start = m_cursor.get();
+    uint8_t *data = NULL;
+    uint32_t available = 0U;
+    uint32_t encodedSize = 0U;
+    uint32_t decodedEnd = 0U;
+    uint32_t lead = 0U;
+    uint32_t count;
+    uint32_t first;
+    uint32_t i;
+    uint64_t v = 0U;
+
+    if ((elementSize == 1U) || (kind == element_kind_t::kFloat))
+    {
+        // Fixed size encoding.
+        BasicCodec::readBorrowedList(length, elementSize, kind, value);
+    }
+    else
+    {
+        erpc_assert((elementSize == 2U) || (elementSize == 4U) || (elementSize == 8U));
+
+        if (isStatusOk())
+        {
+            if (length > (UINT32_MAX / elementSize))
+            {
+                m_status = kErpcStatus_Fail;
+            }
+            else
+            {
+                available = m_cursor.getRemainingUsed();
+
+                // Find end of encoded elements and how far they reach behind start of their decoded positions.
+                for (i = 0U; (i < length) && isStatusOk(); ++i)
+                {
+                    if ((encodedSize > (i * elementSize)) && ((encodedSize - (i * elementSize)) > lead))
+                    {
+                        lead = encodedSize - (i * elementSize);
+                    }
+
+                    count = decodeVarint(&start[encodedSize], available - encodedSize, v);
+                    if ((count == 0U) || ((elementSize < 8U) && ((v >> (elementSize * 8U)) != 0U)))
+                    {
+                        m_status = kErpcStatus_Fail;
+                    }
+                    else
+                    {
+                        encodedSize += count;
+                    }
+                }
+            }
+        }
+
+        if (isStatusOk())
+        {
+            // Decoded element can overwrite only its own and following encoded elements.
+            data = start + lead;
+            if (((uintptr_t)data % elementSize) != 0U)
+            {
+                data += elementSize - ((uintptr_t)data % elementSize);
+            }
+
+            if (((uint32_t)(data - start) > m_cursor.getRemaining()) ||
+                ((length * elementSize) > (m_cursor.getRemaining() - (uint32_t)(data - start))))
+            {
+                m_status = kErpcStatus_BufferOverrun;
+            }
+            else
+            {
+                decodedEnd = (uint32_t)(data - start) + (length * elementSize);
+                if (decodedEnd > encodedSize)
+                {
+                    // Make space for decoded elements longer than encoded ones.
+                    if ((decodedEnd - encodedSize) > (m_cursor.getRemaining() - available))
+                    {
+                        m_status = kErpcStatus_BufferOverrun;
+                    }
+                    else
+                    {
+                        (void)memmove(&start[decodedEnd], &start[encodedSize], available - encodedSize);
+                        buffer.setUsed(buffer.getUsed() + (decodedEnd - encodedSize));
+                    }
+                }
+                else
+                {
+                    decodedEnd = encodedSize;
+                }
+            }
+        }
+
+        if (isStatusOk())
+        {
+            // Skip over data.
+            (void)(m_cursor += (message_size_t)decodedEnd);
+
+            // Decode from the last element, each varint ends with byte without continuation bit.
+            for (i = length; i > 0U; --i)
+            {
+                first = encodedSize - 1U;
+                while ((first > 0U) && ((start[first - 1U] & 0x80U) != 0U))
+                {
+                    --first;
+                }
+                (void)decodeVarint(&start[first], encodedSize - first, v);
+                encodedSize = first;
+
+                if (kind == element_kind_t::kSigned)
+                {
+                    v = (uint64_t)zigzagDecode(v);
+                }
+
+                switch (elementSize)
+                {
+                    case 2U:
+                        reinterpret_cast<uint16_t *>(data)[i - 1U] = (uint16_t)v;
+                        break;
+                    case 4U:
+                        reinterpret_cast<uint32_t *>(data)[i - 1U] = (uint32_t)v;
+                        break;
+                    default:
+                        reinterpret_cast<uint64_t *>(data)[i - 1U] = v;
+                        break;
+                }
+            }
+
+            markBorrowed();
+        }
+        else
+        {
+            data = NULL;
+        }
+
+        *value = data;
+    }
+}
+
+void CompactCodec::readArray(uint32_t length, uint8_t elementSize, element_kind_t kind, void *value)
+{
+    uint64_t maxValue = (elementSize < 8U) ? ((1ULL << (elementSize * 8U)) - 1U) : UINT64_MAX;
+    uint64_t v = 0U;
+    uint32_t i;
+
+    if ((elementSize == 1U) || (kind == element_kind_t::kFloat))
+    {
+        // Fixed size encoding.
+        BasicCodec::readArray(length, elementSize, kind, value);
+    }
+    else
+    {
+        erpc_assert((elementSize == 2U) || (elementSize == 4U) || (elementSize == 8U));
+
+        if (isStatusOk() && (length > 0U) && (value == NULL))
+        {
+            m_status = kErpcStatus_MemoryError;
+        }
+
+        for (i = 0U; (i < length) && isStatusOk(); ++i)
+        {
+            readVarint(v, maxValue);
+            if (kind == element_kind_t::kSigned)
+            {
+                v = (uint64_t)zigzagDecode(v);
+            }
+
+            switch (elementSize)
+            {
+                case 2U:
+                    static_cast<uint16_t *>(value)[i] = (uint16_t)v;
+                    break;
+                case 4U:
+                    static_cast<uint32_t *>(value)[i] = (uint32_t)v;
+                    break;
+                default:
+                    static_cast<uint64_t *>(value)[i] = v;
+                    break;
+            }
+        }
+    }
+}
+
+const uint8_t *CompactCodec::reserveRead(uint32_t length)
+{
+    (void)length;
+
+    return NULL;
+}
+
+ERPC_MANUALLY_CONSTRUCTED_ARRAY_STATIC(CompactCodec, s_compactCodecManual, ERPC_CODEC_COUNT);
+
+CompactCodecFactory::CompactCodecFactory(void) : CodecFactory() {}
+
+CompactCodecFactory::~CompactCodecFactory(void) {}
+
+Codec *CompactCodecFactory::create(void)
+{
+    ERPC_CREATE_NEW_OBJECT(CompactCodec, s_compactCodecManual, ERPC_CODEC_COUNT)
+}
+
+void CompactCodecFactory::dispose(Codec *codec)
+{
+    ERPC_DESTROY_OBJECT(codec, s_compactCodecManual, ERPC_CODEC_COUNT)
+}
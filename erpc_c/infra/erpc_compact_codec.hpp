@@ -0,0 +1,294 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _EMBEDDED_RPC__COMPACT_SERIALIZATION_H_
+#define _EMBEDDED_RPC__COMPACT_SERIALIZATION_H_
+
+#include "erpc_basic_codec.hpp"
+
+/*!
+ * @addtogroup infra_codec
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Binary serialization format with variable length integers.
+ *
+ * Integers wider than one byte are LEB128 varints, 7 bits per byte starting with the lowest ones and the highest
+ * bit set in all bytes but the last one. Signed integers are zigzag mapped first (0, -1, 1, -2 -> 0, 1, 2, 3), so
+ * small negative numbers stay short. Lengths of strings, binaries and lists and union discriminators are varints too.
+ * Bytes, booleans, floating point numbers and pointers are written as by BasicCodec.
+ *
+ * The message header is one byte with codec version in the upper and message type in the lower four bits, followed
+ * by varints of service, request and sequence. Short messages so shrink considerably, for example a call without
+ * arguments takes 4 bytes instead of 8.
+ *
+ * Both sides of the link have to use this codec.
+ *
+ * @ingroup infra_codec
+ */
+class CompactCodec : public BasicCodec
+{
+public:
+    static const uint32_t kCompactCodecVersion; /*!< Codec version. */
+
+    /*!
+     * @brief Constructor.
+     */
+    CompactCodec(void);
+
+    /*!
+     * @brief CompactCodec destructor
+     */
+    virtual ~CompactCodec(void);
+
+    //! @name Encoding
+    //@{
+    /*!
+     * @brief Prototype for write header of message.
+     *
+     * @param[in] type Type of message.
+     * @param[in] service Which interface is requested.
+     * @param[in] request Which function need be called.
+     * @param[in] sequence Send sequence number to be sure that
+     *                    received message is reply for current request. or write function.
+     */
+    virtual void startWriteMessage(message_type_t type, uint32_t service, uint32_t request, uint32_t sequence) override;
+
+    /*!
+     * @brief Prototype for write int16_t value.
+     *
+     * @param[in] value int16_t typed value to write.
+     */
+    virtual void write(int16_t value) override;
+
+    /*!
+     * @brief Prototype for write int32_t value.
+     *
+     * @param[in] value int32_t typed value to write.
+     */
+    virtual void write(int32_t value) override;
+
+    /*!
+     * @brief Prototype for write int64_t value.
+     *
+     * @param[in] value int64_t typed value to write.
+     */
+    virtual void write(int64_t value) override;
+
+    /*!
+     * @brief Prototype for write uint16_t value.
+     *
+     * @param[in] value uint16_t typed value to write.
+     */
+    virtual void write(uint16_t value) override;
+
+    /*!
+     * @brief Prototype for write uint32_t value.
+     *
+     * @param[in] value uint32_t typed value to write.
+     */
+    virtual void write(uint32_t value) override;
+
+    /*!
+     * @brief Prototype for write uint64_t value.
+     *
+     * @param[in] value uint64_t typed value to write.
+     */
+    virtual void write(uint64_t value) override;
+
+    /*!
+     * @brief Prototype for write array of scalar values.
+     *
+     * Integers wider than one byte are written as varints, other elements at once as by BasicCodec.
+     *
+     * @param[in] length Count of elements.
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     * @param[in] value Elements to write.
+     */
+    virtual void writeArray(uint32_t length, uint8_t elementSize, element_kind_t kind, const void *value) override;
+
+    /*!
+     * @brief Return the most bytes one element written by writeArray() can take.
+     *
+     * Varint of integer element takes up to one byte for each started group of seven bits.
+     *
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     *
+     * @return Maximal size of encoded element.
+     */
+    virtual uint32_t getArrayElementMaxSize(uint8_t elementSize, element_kind_t kind) const override;
+
+    /*!
+     * @brief Values of fixed size structures are not fixed size in this codec.
+     *
+     * @param[in] length Count of bytes to reserve.
+     *
+     * @return Always null, values are written one by one.
+     */
+    virtual uint8_t *reserveWrite(uint32_t length) override;
+
+    using BasicCodec::write;
+    //@}
+
+    //! @name Decoding
+    //@{
+    /*!
+     * @brief Prototype for read header of message.
+     *
+     * @param[out] type Type of message.
+     * @param[out] service Which interface was used.
+     * @param[out] request Which function was called.
+     * @param[out] sequence Returned sequence number to be sure that
+     *                     received message is reply for current request.
+     */
+    virtual void startReadMessage(message_type_t &type, uint32_t &service, uint32_t &request,
+                                  uint32_t &sequence) override;
+
+    /*!
+     * @brief Prototype for read int16_t value.
+     *
+     * @param[out] value int16_t typed value to read.
+     */
+    virtual void read(int16_t &value) override;
+
+    /*!
+     * @brief Prototype for read int32_t value.
+     *
+     * @param[out] value int32_t typed value to read.
+     */
+    virtual void read(int32_t &value) override;
+
+    /*!
+     * @brief Prototype for read int64_t value.
+     *
+     * @param[out] value int64_t typed value to read.
+     */
+    virtual void read(int64_t &value) override;
+
+    /*!
+     * @brief Prototype for read uint16_t value.
+     *
+     * @param[out] value uint16_t typed value to read.
+     */
+    virtual void read(uint16_t &value) override;
+
+    /*!
+     * @brief Prototype for read uint32_t value.
+     *
+     * @param[out] value uint32_t typed value to read.
+     */
+    virtual void read(uint32_t &value) override;
+
+    /*!
+     * @brief Prototype for read uint64_t value.
+     *
+     * @param[out] value uint64_t typed value to read.
+     */
+    virtual void read(uint64_t &value) override;
+
+    using BasicCodec::read;
+
+    /*!
+     * @brief Prototype for read list of scalar values in place.
+     *
+     * Varints are decoded backwards into an aligned array, which can be longer than the encoded elements. Rest of
+     * the message is then moved forward into free space of the message buffer.
+     *
+     * @param[in] length Count of list elements.
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements, only integers wider than one byte are varints.
+     * @param[out] value Elements inside of the message buffer. Null in case of error.
+     */
+    virtual void readBorrowedList(uint32_t length, uint8_t elementSize, element_kind_t kind, void **value) override;
+
+    /*!
+     * @brief Prototype for read array of scalar values.
+     *
+     * @param[in] length Count of elements.
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     * @param[out] value Memory for elements.
+     */
+    virtual void readArray(uint32_t length, uint8_t elementSize, element_kind_t kind, void *value) override;
+
+    /*!
+     * @brief Values of fixed size structures are not fixed size in this codec.
+     *
+     * @param[in] length Count of bytes to reserve.
+     *
+     * @return Always null, values are read one by one.
+     */
+    virtual const uint8_t *reserveRead(uint32_t length) override;
+    //@}
+
+protected:
+    /*!
+     * @brief This function writes unsigned varint.
+     *
+     * @param[in] value Value to write.
+     */
+    void writeVarint(uint64_t value);
+
+    /*!
+     * @brief This function reads unsigned varint.
+     *
+     * Signed values are checked against maximum of their zigzag mapping, which is the unsigned maximum.
+     *
+     * @param[out] value Read value, unchanged in case of error.
+     * @param[in] maxValue Highest value fitting into the target type.
+     */
+    void readVarint(uint64_t &value, uint64_t maxValue);
+};
+
+/*!
+ * @brief Compact codec factory implements functions from codec factory.
+ *
+ * @ingroup infra_codec
+ */
+class CompactCodecFactory : public CodecFactory
+{
+public:
+    /*!
+     * @brief Constructor.
+     */
+    CompactCodecFactory(void);
+
+    /*!
+     * @brief CodecFactory destructor
+     */
+    virtual ~CompactCodecFactory(void);
+
+    /*!
+     * @brief Return created codec.
+     *
+     * @return Pointer to created codec.
+     */
+    virtual Codec *create(void) override;
+
+    /*!
+     * @brief Dispose codec.
+     *
+     * @param[in] codec Codec to dispose.
+     */
+    virtual void dispose(Codec *codec) override;
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__COMPACT_SERIALIZATION_H_
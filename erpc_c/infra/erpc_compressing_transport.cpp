@@ -0,0 +1,491 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_compressing_transport.hpp"
+
+#include <cstring>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Minimal length of match.
+#define MIN_MATCH (4U)
+
+//! @brief Count of bytes at the end of data which are always literals.
+#define LAST_LITERALS (5U)
+
+//! @brief Matches do not start in this count of bytes at the end of data.
+#define MATCH_FIND_LIMIT (12U)
+
+//! @brief Maximal distance of match.
+#define MAX_DISTANCE (65535U)
+
+//! @brief Value of length nibble followed by additional length bytes.
+#define RUN_MASK (15U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Read four bytes as little endian number, independently on processor endianness.
+ */
+static inline uint32_t readSequence(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8U) | ((uint32_t)data[2] << 16U) | ((uint32_t)data[3] << 24U);
+}
+
+/*!
+ * @brief Index of sequence in hash table.
+ */
+static inline uint32_t hashSequence(uint32_t sequence)
+{
+    return (sequence * 2654435761U) >> (32U - ERPC_COMPRESSING_TRANSPORT_HASH_BITS);
+}
+
+/*!
+ * @brief Write length remaining after nibble of token as bytes of 255 and last smaller byte.
+ */
+static bool writeLength(uint8_t *dst, uint32_t dstLength, uint32_t &pos, uint32_t length)
+{
+    bool fits = true;
+
+    while (fits && (length >= 255U))
+    {
+        if (pos < dstLength)
+        {
+            dst[pos++] = 255U;
+            length -= 255U;
+        }
+        else
+        {
+            fits = false;
+        }
+    }
+
+    if (fits && (pos < dstLength))
+    {
+        dst[pos++] = (uint8_t)length;
+    }
+    else
+    {
+        fits = false;
+    }
+
+    return fits;
+}
+
+/*!
+ * @brief Read length remaining after nibble of token and add it to length.
+ */
+static bool readLength(const uint8_t *src, uint32_t srcLength, uint32_t &pos, uint32_t maxLength, uint32_t &length)
+{
+    bool valid = true;
+    uint8_t byte = 255U;
+
+    while (valid && (byte == 255U))
+    {
+        if (pos < srcLength)
+        {
+            byte = src[pos++];
+            length += byte;
+            // Stop on lengths which can not fit, before they overflow.
+            valid = (length <= maxLength);
+        }
+        else
+        {
+            valid = false;
+        }
+    }
+
+    return valid;
+}
+
+/*!
+ * @brief Write sequence of literals optionally followed by match.
+ *
+ * @param[in] matchLength Length of match, 0 for last literals.
+ */
+static bool writeSequence(uint8_t *dst, uint32_t dstLength, uint32_t &pos, const uint8_t *literals,
+                          uint32_t literalLength, uint32_t offset, uint32_t matchLength)
+{
+    bool fits = (pos < dstLength);
+    uint32_t token = 0;
+    uint32_t tokenPos = pos;
+
+    if (fits)
+    {
+        pos++;
+        token = ((literalLength < RUN_MASK) ? literalLength : RUN_MASK) << 4U;
+        if (literalLength >= RUN_MASK)
+        {
+            fits = writeLength(dst, dstLength, pos, literalLength - RUN_MASK);
+        }
+    }
+
+    if (fits)
+    {
+        fits = (literalLength <= (dstLength - pos));
+    }
+
+    if (fits)
+    {
+        (void)memcpy(&dst[pos], literals, literalLength);
+        pos += literalLength;
+
+        if (matchLength != 0U)
+        {
+            matchLength -= MIN_MATCH;
+            token |= (matchLength < RUN_MASK) ? matchLength : RUN_MASK;
+            fits = (2U <= (dstLength - pos));
+            if (fits)
+            {
+                dst[pos++] = (uint8_t)offset;
+                dst[pos++] = (uint8_t)(offset >> 8U);
+                if (matchLength >= RUN_MASK)
+                {
+                    fits = writeLength(dst, dstLength, pos, matchLength - RUN_MASK);
+                }
+            }
+        }
+    }
+
+    if (fits)
+    {
+        dst[tokenPos] = (uint8_t)token;
+    }
+
+    return fits;
+}
+
+CompressingTransport::CompressingTransport(void) :
+Transport(), m_transport(NULL), m_messageFactory(NULL), m_sendBuffer(), m_receiveBuffer(), m_threshold(0)
+#if !ERPC_THREADS_IS(NONE)
+,
+m_sendLock(), m_receiveLock()
+#endif
+{
+}
+
+CompressingTransport::~CompressingTransport(void)
+{
+    if (m_messageFactory != NULL)
+    {
+        if (m_sendBuffer.get() != NULL)
+        {
+            m_messageFactory->dispose(&m_sendBuffer);
+        }
+        if (m_receiveBuffer.get() != NULL)
+        {
+            m_messageFactory->dispose(&m_receiveBuffer);
+        }
+    }
+}
+
+erpc_status_t CompressingTransport::init(Transport *transport, MessageBufferFactory *messageFactory,
+                                         uint32_t threshold)
+{
+    erpc_status_t err = kErpcStatus_Success;
+
+    erpc_assert(transport != NULL);
+    erpc_assert(messageFactory != NULL);
+
+    m_transport = transport;
+    m_messageFactory = messageFactory;
+    m_threshold = threshold;
+
+    m_sendBuffer = m_messageFactory->create();
+    m_receiveBuffer = m_messageFactory->create();
+    if ((m_sendBuffer.get() == NULL) || (m_receiveBuffer.get() == NULL) ||
+        (m_sendBuffer.getLength() <= reserveHeaderSize()))
+    {
+        err = kErpcStatus_MemoryError;
+    }
+
+    return err;
+}
+
+uint8_t CompressingTransport::reserveHeaderSize(void)
+{
+    return m_transport->reserveHeaderSize() + 1U;
+}
+
+erpc_status_t CompressingTransport::receive(MessageBuffer *message)
+{
+    erpc_status_t err;
+    uint8_t reserve = reserveHeaderSize();
+    uint8_t flags;
+    uint32_t length;
+
+    err = m_transport->receive(message);
+    if ((err == kErpcStatus_Success) && (message->getUsed() < reserve))
+    {
+        err = kErpcStatus_ReceiveFailed;
+    }
+
+    if (err == kErpcStatus_Success)
+    {
+        flags = message->get()[m_transport->reserveHeaderSize()];
+        if (flags == kCompressedFlag)
+        {
+#if !ERPC_THREADS_IS(NONE)
+            Mutex::Guard lock(m_receiveLock);
+#endif
+            length = message->getUsed() - reserve;
+            if (length > m_receiveBuffer.getLength())
+            {
+                err = kErpcStatus_ReceiveFailed;
+            }
+            else
+            {
+                // Data can not be decompressed in place, compressed copy is usually the smaller one.
+                (void)memcpy(m_receiveBuffer.get(), &message->get()[reserve], length);
+                err = decompress(m_receiveBuffer.get(), length, &message->get()[reserve],
+                                 message->getLength() - reserve, length);
+            }
+
+            if (err == kErpcStatus_Success)
+            {
+                message->setUsed(reserve + length);
+            }
+        }
+        else if (flags != 0U)
+        {
+            err = kErpcStatus_ReceiveFailed;
+        }
+        else
+        {
+            // Message is not compressed.
+        }
+    }
+
+    return err;
+}
+
+erpc_status_t CompressingTransport::send(MessageBuffer *message)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    uint8_t transportReserve = m_transport->reserveHeaderSize();
+    uint8_t reserve = reserveHeaderSize();
+    uint32_t length;
+    uint32_t compressedLength = 0;
+
+    erpc_assert(message->getUsed() >= reserve);
+
+    length = message->getUsed() - reserve;
+    if ((length != 0U) && (length >= m_threshold))
+    {
+#if !ERPC_THREADS_IS(NONE)
+        Mutex::Guard lock(m_sendLock);
+#endif
+        // Compressed data are accepted only when shorter than original ones.
+        compressedLength = compress(&message->get()[reserve], length, &m_sendBuffer.get()[reserve],
+                                    ((length - 1U) < (uint32_t)(m_sendBuffer.getLength() - reserve)) ?
+                                        (length - 1U) :
+                                        (uint32_t)(m_sendBuffer.getLength() - reserve));
+        if (compressedLength != 0U)
+        {
+            m_sendBuffer.get()[transportReserve] = kCompressedFlag;
+            m_sendBuffer.setUsed(reserve + compressedLength);
+            err = m_transport->send(&m_sendBuffer);
+        }
+    }
+
+    if (compressedLength == 0U)
+    {
+        message->get()[transportReserve] = 0U;
+        err = m_transport->send(message);
+    }
+
+    return err;
+}
+
+bool CompressingTransport::hasMessage(void)
+{
+    return m_transport->hasMessage();
+}
+
+void CompressingTransport::setCrc16(Crc16 *crcImpl)
+{
+    erpc_assert(crcImpl != NULL);
+    erpc_assert(m_transport != NULL);
+    m_transport->setCrc16(crcImpl);
+}
+
+Crc16 *CompressingTransport::getCrc16(void)
+{
+    erpc_assert(m_transport != NULL);
+    return m_transport->getCrc16();
+}
+
+uint32_t CompressingTransport::compress(const uint8_t *src, uint32_t srcLength, uint8_t *dst, uint32_t dstLength)
+{
+    bool fits = true;
+    uint32_t pos = 0;
+    uint32_t anchor = 0;
+    uint32_t ip;
+    uint32_t candidate;
+    uint32_t hash;
+    uint32_t matchLength;
+    uint32_t matchLimit;
+    uint32_t matchFindLimit;
+    bool found;
+
+    if (srcLength > MATCH_FIND_LIMIT)
+    {
+        matchLimit = srcLength - LAST_LITERALS;
+        matchFindLimit = srcLength - MATCH_FIND_LIMIT;
+        (void)memset(m_hashTable, 0, sizeof(m_hashTable));
+
+        m_hashTable[hashSequence(readSequence(src))] = 0;
+        ip = 1;
+        while (fits && (ip <= matchFindLimit))
+        {
+            // Find match, step over data faster the longer no match was found.
+            found = false;
+            candidate = 0;
+            while (!found && (ip <= matchFindLimit))
+            {
+                hash = hashSequence(readSequence(&src[ip]));
+                candidate = m_hashTable[hash];
+                m_hashTable[hash] = (message_size_t)ip;
+                if ((candidate < ip) && ((ip - candidate) <= MAX_DISTANCE) &&
+                    (readSequence(&src[candidate]) == readSequence(&src[ip])))
+                {
+                    found = true;
+                }
+                else
+                {
+                    ip += 1U + ((ip - anchor) >> 6U);
+                }
+            }
+
+            if (found)
+            {
+                // Extend match backward and forward.
+                while ((ip > anchor) && (candidate > 0U) && (src[ip - 1U] == src[candidate - 1U]))
+                {
+                    --ip;
+                    --candidate;
+                }
+                matchLength = MIN_MATCH;
+                while (((ip + matchLength) < matchLimit) && (src[candidate + matchLength] == src[ip + matchLength]))
+                {
+                    ++matchLength;
+                }
+
+                fits = writeSequence(dst, dstLength, pos, &src[anchor], ip - anchor, ip - candidate, matchLength);
+                ip += matchLength;
+                anchor = ip;
+
+                if (ip <= matchFindLimit)
+                {
+                    m_hashTable[hashSequence(readSequence(&src[ip - 2U]))] = (message_size_t)(ip - 2U);
+                }
+            }
+        }
+    }
+
+    if (fits)
+    {
+        fits = writeSequence(dst, dstLength, pos, &src[anchor], srcLength - anchor, 0, 0);
+    }
+
+    return fits ? pos : 0U;
+}
+
+erpc_status_t CompressingTransport::decompress(const uint8_t *src, uint32_t srcLength, uint8_t *dst,
+                                               uint32_t dstLength, uint32_t &length)
+{
+    bool valid = true;
+    bool done = false;
+    uint32_t ip = 0;
+    uint32_t op = 0;
+    uint32_t token = 0;
+    uint32_t literalLength = 0;
+    uint32_t matchLength = 0;
+    uint32_t offset = 0;
+    uint32_t i;
+
+    while (valid && !done)
+    {
+        valid = (ip < srcLength);
+        if (valid)
+        {
+            token = src[ip++];
+            literalLength = token >> 4U;
+            if (literalLength == RUN_MASK)
+            {
+                valid = readLength(src, srcLength, ip, dstLength - op, literalLength);
+            }
+        }
+
+        if (valid)
+        {
+            valid = ((literalLength <= (srcLength - ip)) && (literalLength <= (dstLength - op)));
+        }
+
+        if (valid)
+        {
+            (void)memcpy(&dst[op], &src[ip], literalLength);
+            ip += literalLength;
+            op += literalLength;
+
+            // Last sequence has literals only.
+            done = (ip == srcLength);
+        }
+
+        if (valid && !done)
+        {
+            valid = ((srcLength - ip) >= 2U);
+            if (valid)
+            {
+                offset = (uint32_t)src[ip] | ((uint32_t)src[ip + 1U] << 8U);
+                ip += 2U;
+                matchLength = token & RUN_MASK;
+                if (matchLength == RUN_MASK)
+                {
+                    valid = readLength(src, srcLength, ip, dstLength - op, matchLength);
+                }
+            }
+
+            if (valid)
+            {
+                matchLength += MIN_MATCH;
+                valid = ((offset != 0U) && (offset <= op) && (matchLength <= (dstLength - op)));
+            }
+
+            if (valid)
+            {
+                // Match can overlap with its own output.
+                if (offset >= matchLength)
+                {
+                    (void)memcpy(&dst[op], &dst[op - offset], matchLength);
+                }
+                else
+                {
+                    for (i = 0; i < matchLength; ++i)
+                    {
+                        dst[op + i] = dst[op - offset + i];
+                    }
+                }
+                op += matchLength;
+            }
+        }
+    }
+
+    if (valid)
+    {
+        length = op;
+    }
+
+    return valid ? kErpcStatus_Success : kErpcStatus_ReceiveFailed;
+}
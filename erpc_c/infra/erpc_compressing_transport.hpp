@@ -0,0 +1,176 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _EMBEDDED_RPC__COMPRESSING_TRANSPORT_H_
+#define _EMBEDDED_RPC__COMPRESSING_TRANSPORT_H_
+
+#include "erpc_config_internal.h"
+#include "erpc_message_buffer.hpp"
+#include "erpc_transport.hpp"
+
+#if !ERPC_THREADS_IS(NONE)
+#include "erpc_threading.h"
+#endif
+
+#if (ERPC_COMPRESSING_TRANSPORT_HASH_BITS < 1U) || (ERPC_COMPRESSING_TRANSPORT_HASH_BITS > 16U)
+#error "ERPC_COMPRESSING_TRANSPORT_HASH_BITS has to be in range 1 to 16!"
+#endif
+
+/*!
+ * @addtogroup infra_transport
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+
+/*!
+ * @brief Transport compressing messages sent over the wrapped transport.
+ *
+ * One flags byte is placed in front of each message. Messages of at least threshold bytes are
+ * compressed in the LZ4 block format and sent with kCompressedFlag set when they shrink, other
+ * messages are sent unchanged with the flag cleared. The compressor is a small greedy LZ77 matcher
+ * with one hash table of ERPC_COMPRESSING_TRANSPORT_HASH_BITS bits, good for repetitive data like
+ * arrays of structures or text.
+ *
+ * Both sides of the communication have to use this transport.
+ *
+ * @ingroup infra_transport
+ */
+class CompressingTransport : public Transport
+{
+public:
+    static const uint8_t kCompressedFlag = 0x01U; /*!< Flag of compressed message. */
+
+    /*!
+     * @brief Constructor.
+     */
+    CompressingTransport(void);
+
+    /*!
+     * @brief Destructor.
+     */
+    virtual ~CompressingTransport(void);
+
+    /*!
+     * @brief This function initializes the transport.
+     *
+     * Two buffers are taken from the message buffer factory, one for compressed sent messages and
+     * one for compressed received messages.
+     *
+     * @param[in] transport Wrapped transport.
+     * @param[in] messageFactory Message buffer factory for compression buffers.
+     * @param[in] threshold Minimal size of message data in bytes to try compression.
+     *
+     * @retval kErpcStatus_Success When transport was initialized.
+     * @retval kErpcStatus_MemoryError When compression buffers were not created.
+     */
+    erpc_status_t init(Transport *transport, MessageBufferFactory *messageFactory, uint32_t threshold);
+
+    /**
+     * @brief Size of data placed in MessageBuffer before serializing eRPC data.
+     *
+     * @return uint8_t Amount of bytes, reserved before serialized data.
+     */
+    virtual uint8_t reserveHeaderSize(void) override;
+
+    /*!
+     * @brief Receive message and decompress it when needed.
+     *
+     * @param[out] message Will return pointer to received message buffer.
+     *
+     * @return kErpcStatus_ReceiveFailed when message is malformed, otherwise based on wrapped transport.
+     */
+    virtual erpc_status_t receive(MessageBuffer *message) override;
+
+    /*!
+     * @brief Compress message when it is worth it and send it.
+     *
+     * @param[in] message Pass message buffer to send.
+     *
+     * @return based on wrapped transport send.
+     */
+    virtual erpc_status_t send(MessageBuffer *message) override;
+
+    /*!
+     * @brief Check if a message is available.
+     *
+     * @retval True when wrapped transport has a message.
+     */
+    virtual bool hasMessage(void) override;
+
+    /*!
+     * @brief This functions sets the CRC-16 implementation.
+     *
+     * @param[in] crcImpl Object containing crc-16 compute function.
+     */
+    virtual void setCrc16(Crc16 *crcImpl) override;
+
+    /*!
+     * @brief This functions gets the CRC-16 object.
+     *
+     * @return Crc16* Pointer to CRC-16 object containing crc-16 compute function.
+     */
+    virtual Crc16 *getCrc16(void) override;
+
+    /*!
+     * @brief This function compresses data in the LZ4 block format.
+     *
+     * Send lock has to be locked, hash table of the transport is used.
+     *
+     * @param[in] src Data to compress.
+     * @param[in] srcLength Size of data to compress.
+     * @param[out] dst Buffer for compressed data.
+     * @param[in] dstLength Size of buffer for compressed data.
+     *
+     * @return Size of compressed data, 0 when they do not fit into the buffer.
+     */
+    uint32_t compress(const uint8_t *src, uint32_t srcLength, uint8_t *dst, uint32_t dstLength);
+
+    /*!
+     * @brief This function decompresses data in the LZ4 block format.
+     *
+     * @param[in] src Compressed data.
+     * @param[in] srcLength Size of compressed data.
+     * @param[out] dst Buffer for decompressed data.
+     * @param[in] dstLength Size of buffer for decompressed data.
+     * @param[out] length Size of decompressed data.
+     *
+     * @retval kErpcStatus_Success When data were decompressed.
+     * @retval kErpcStatus_ReceiveFailed When data are malformed or do not fit into the buffer.
+     */
+    static erpc_status_t decompress(const uint8_t *src, uint32_t srcLength, uint8_t *dst, uint32_t dstLength,
+                                    uint32_t &length);
+
+protected:
+    Transport *m_transport;                 //!< Wrapped transport.
+    MessageBufferFactory *m_messageFactory; //!< Factory of compression buffers.
+    MessageBuffer m_sendBuffer;             //!< Compressed sent message.
+    MessageBuffer m_receiveBuffer;          //!< Compressed received message.
+    uint32_t m_threshold;                   //!< Minimal size of message data to try compression.
+    message_size_t m_hashTable[1UL << ERPC_COMPRESSING_TRANSPORT_HASH_BITS]; //!< Last positions of hashed data.
+#if !ERPC_THREADS_IS(NONE)
+    Mutex m_sendLock;    //!< Mutex guarding the send buffer and the hash table.
+    Mutex m_receiveLock; //!< Mutex guarding the receive buffer.
+#endif
+
+private:
+    // Disable copy ctor.
+    CompressingTransport(const CompressingTransport &other);            /*!< Disable copy ctor. */
+    CompressingTransport &operator=(const CompressingTransport &other); /*!< Disable copy ctor. */
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__COMPRESSING_TRANSPORT_H_
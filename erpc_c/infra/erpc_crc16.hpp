@@ -49,7 +49,7 @@ public:
     /*!
      * @brief Compute a ITU-CCITT CRC-16 over the provided data.
      *
-     * This implementation is slow but small in size.
+     * Implementation is selected by ERPC_CRC16_IMPLEMENTATION, all of them return the same value.
      *
      * @param[in] data Pointer to data used for crc16.
      * @param[in] lengthInBytes Data length.
@@ -69,6 +69,28 @@ protected:
 
 } // namespace erpc
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Compute a ITU-CCITT CRC-16 (polynomial 0x1021, not reflected, no final xor) over the provided data.
+ *
+ * Implemented by the port when ERPC_CRC16_IMPLEMENTATION is set to ERPC_CRC16_IMPLEMENTATION_PORT, for example
+ * with a hardware CRC engine.
+ *
+ * @param[in] crcStart Initial value of CRC register.
+ * @param[in] data Pointer to data used for crc16.
+ * @param[in] lengthInBytes Data length.
+ *
+ * @return Computed CRC-16.
+ */
+uint16_t erpc_crc16_port_compute(uint16_t crcStart, const uint8_t *data, uint32_t lengthInBytes);
+
+#ifdef __cplusplus
+}
+#endif
+
 /*! @} */
 
 #endif // _EMBEDDED_RPC__CRC16_H_
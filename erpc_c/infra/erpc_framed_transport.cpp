@@ -23,7 +23,7 @@ using namespace erpc;
 ////////////////////////////////////////////////////////////////////////////////
 
 FramedTransport::FramedTransport(void) :
-Transport(), m_crcImpl(NULL)
+Transport(), m_crcImpl(NULL), m_readAheadBuffer(NULL), m_readAheadSize(0), m_readAheadHead(0), m_readAheadTail(0)
 #if !ERPC_THREADS_IS(NONE)
 ,
 m_sendLock(), m_receiveLock()
@@ -50,6 +50,32 @@ Crc16 *FramedTransport::getCrc16(void)
     return m_crcImpl;
 }
 
+bool FramedTransport::hasMessage(void)
+{
+    bool retVal = false;
+    message_size_t messageSize;
+    uint32_t available = m_readAheadTail - m_readAheadHead;
+
+    if (available >= reserveHeaderSize())
+    {
+        static_cast<void>(memcpy(&messageSize, &m_readAheadBuffer[m_readAheadHead + sizeof(Header::m_crcHeader)],
+                                 sizeof(messageSize)));
+#if ERPC_LARGE_MESSAGES
+        ERPC_READ_AGNOSTIC_32(messageSize);
+#else
+        ERPC_READ_AGNOSTIC_16(messageSize);
+#endif
+        retVal = ((available - reserveHeaderSize()) >= messageSize);
+    }
+
+    if (!retVal)
+    {
+        retVal = Transport::hasMessage();
+    }
+
+    return retVal;
+}
+
 erpc_status_t FramedTransport::receive(MessageBuffer *message)
 {
     Header h = { 0, 0, 0 };
@@ -87,7 +113,11 @@ erpc_status_t FramedTransport::receive(MessageBuffer *message)
             offset += sizeof(h.m_crcBody);
 
             ERPC_READ_AGNOSTIC_16(h.m_crcHeader);
+#if ERPC_LARGE_MESSAGES
+            ERPC_READ_AGNOSTIC_32(h.m_messageSize);
+#else
             ERPC_READ_AGNOSTIC_16(h.m_messageSize);
+#endif
             ERPC_READ_AGNOSTIC_16(h.m_crcBody);
 
             computedCrc =
@@ -102,7 +132,7 @@ erpc_status_t FramedTransport::receive(MessageBuffer *message)
         if (retVal == kErpcStatus_Success)
         {
             // received size can't be larger then buffer length.
-            if ((h.m_messageSize + reserveHeaderSize()) > message->getLength())
+            if (h.m_messageSize > (message->getLength() - reserveHeaderSize()))
             {
                 retVal = kErpcStatus_ReceiveFailed;
             }
@@ -135,7 +165,21 @@ erpc_status_t FramedTransport::receive(MessageBuffer *message)
 erpc_status_t FramedTransport::send(MessageBuffer *message)
 {
     erpc_status_t ret;
-    uint16_t messageLength;
+
+    writeHeader(message);
+
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_sendLock);
+#endif
+
+    ret = underlyingSend(message, message->getUsed(), 0);
+
+    return ret;
+}
+
+void FramedTransport::writeHeader(MessageBuffer *message)
+{
+    message_size_t messageLength;
     Header h;
     uint8_t offset;
 
@@ -143,7 +187,6 @@ erpc_status_t FramedTransport::send(MessageBuffer *message)
 
     messageLength = message->getUsed() - reserveHeaderSize();
 
-    // Send header first.
     h.m_messageSize = messageLength;
     h.m_crcBody = m_crcImpl->computeCRC16(&message->get()[reserveHeaderSize()], messageLength);
     h.m_crcHeader =
@@ -151,7 +194,11 @@ erpc_status_t FramedTransport::send(MessageBuffer *message)
         m_crcImpl->computeCRC16(reinterpret_cast<const uint8_t *>(&h.m_crcBody), sizeof(h.m_crcBody));
 
     ERPC_WRITE_AGNOSTIC_16(h.m_crcHeader);
+#if ERPC_LARGE_MESSAGES
+    ERPC_WRITE_AGNOSTIC_32(h.m_messageSize);
+#else
     ERPC_WRITE_AGNOSTIC_16(h.m_messageSize);
+#endif
     ERPC_WRITE_AGNOSTIC_16(h.m_crcBody);
 
     static_cast<void>(memcpy(message->get(), reinterpret_cast<const uint8_t *>(&h.m_crcHeader), sizeof(h.m_crcHeader)));
@@ -161,10 +208,6 @@ erpc_status_t FramedTransport::send(MessageBuffer *message)
     offset += sizeof(h.m_messageSize);
     static_cast<void>(
         memcpy(&message->get()[offset], reinterpret_cast<const uint8_t *>(&h.m_crcBody), sizeof(h.m_crcBody)));
-
-    ret = underlyingSend(message, message->getUsed(), 0);
-
-    return ret;
 }
 
 erpc_status_t FramedTransport::underlyingSend(MessageBuffer *message, uint32_t size, uint32_t offset)
@@ -176,7 +219,7 @@ erpc_status_t FramedTransport::underlyingSend(MessageBuffer *message, uint32_t s
 
 erpc_status_t FramedTransport::underlyingReceive(MessageBuffer *message, uint32_t size, uint32_t offset)
 {
-    erpc_status_t retVal = underlyingReceive(&message->get()[offset], size);
+    erpc_status_t retVal = bufferedReceive(&message->get()[offset], size);
 
     if (retVal == kErpcStatus_Success)
     {
@@ -185,3 +228,69 @@ erpc_status_t FramedTransport::underlyingReceive(MessageBuffer *message, uint32_
 
     return retVal;
 }
+
+erpc_status_t FramedTransport::underlyingReceiveAvailable(uint8_t *data, uint32_t minSize, uint32_t maxSize,
+                                                          uint32_t &received)
+{
+    erpc_status_t retVal;
+
+    (void)maxSize;
+    retVal = underlyingReceive(data, minSize);
+    received = (retVal == kErpcStatus_Success) ? minSize : 0U;
+
+    return retVal;
+}
+
+void FramedTransport::setReadAheadBuffer(uint8_t *buffer, uint32_t size)
+{
+    m_readAheadBuffer = buffer;
+    m_readAheadSize = (buffer != NULL) ? size : 0U;
+    resetReadAhead();
+}
+
+void FramedTransport::resetReadAhead(void)
+{
+    m_readAheadHead = 0;
+    m_readAheadTail = 0;
+}
+
+erpc_status_t FramedTransport::bufferedReceive(uint8_t *data, uint32_t size)
+{
+    erpc_status_t retVal = kErpcStatus_Success;
+    uint32_t length;
+    uint32_t received;
+
+    while ((retVal == kErpcStatus_Success) && (size > 0U))
+    {
+        length = m_readAheadTail - m_readAheadHead;
+        if (length > 0U)
+        {
+            // Use data which were read ahead.
+            if (length > size)
+            {
+                length = size;
+            }
+            static_cast<void>(memcpy(data, &m_readAheadBuffer[m_readAheadHead], length));
+            m_readAheadHead += length;
+            data += length;
+            size -= length;
+        }
+        else if (size >= m_readAheadSize)
+        {
+            // Data which do not fit into read-ahead buffer are received directly.
+            retVal = underlyingReceive(data, size);
+            size = 0;
+        }
+        else
+        {
+            resetReadAhead();
+            retVal = underlyingReceiveAvailable(m_readAheadBuffer, size, m_readAheadSize, received);
+            if (retVal == kErpcStatus_Success)
+            {
+                m_readAheadTail = received;
+            }
+        }
+    }
+
+    return retVal;
+}
@@ -41,7 +41,10 @@ namespace erpc {
  * of a size known in advance. Subclasses must implement the underlyingSend() and
  * underlyingReceive() methods to actually transmit and receive data.
  *
- * Frames have a maximum size of 64kB, as a 16-bit frame size is used.
+ * Frames have a maximum size of 64kB, as a 16-bit frame size is used. When ERPC_LARGE_MESSAGES
+ * is enabled, the frame size is 32-bit and the header grows from 6 to 8 bytes. Both sides must
+ * use the same header format. A frame of the other format usually fails the header CRC check, but
+ * the header carries no format marker, so the mismatch is missed when the 16-bit CRC matches by chance.
  *
  * @note This implementation currently assumes both sides of the communications channel
  *  are the same endianness.
@@ -51,6 +54,11 @@ namespace erpc {
  * relatively slow. If a faster implementation is desired, you can pass the new CRC
  * function to setCRCFunction().
  *
+ * Stream transports can provide a read-ahead buffer by setReadAheadBuffer() and implement
+ * underlyingReceiveAvailable(). Then all bytes available on the channel are read at once, up to
+ * the buffer size, and following headers and small messages are taken from the buffer without
+ * another read of the channel.
+ *
  * @ingroup infra_transport
  */
 class FramedTransport : public Transport
@@ -59,9 +67,9 @@ public:
     /*! @brief Contents of the header that prefixes each message. */
     struct Header
     {
-        uint16_t m_crcHeader;   //!< CRC-16 over this header structure data
-        uint16_t m_messageSize; //!< Size in bytes of the message, excluding the header.
-        uint16_t m_crcBody;     //!< CRC-16 over the message data.
+        uint16_t m_crcHeader;         //!< CRC-16 over this header structure data
+        message_size_t m_messageSize; //!< Size in bytes of the message, excluding the header.
+        uint16_t m_crcBody;           //!< CRC-16 over the message data.
     };
 
     /*!
@@ -124,14 +132,33 @@ public:
      */
     virtual Crc16 *getCrc16(void) override;
 
+    /*!
+     * @brief Check if a message is available.
+     *
+     * @retval True when a whole frame is in the read-ahead buffer, otherwise based on Transport::hasMessage().
+     */
+    virtual bool hasMessage(void) override;
+
 protected:
     Crc16 *m_crcImpl; /*!< CRC object. */
 
+    uint8_t *m_readAheadBuffer; /*!< Buffer of received data which were not processed yet, NULL when not used. */
+    uint32_t m_readAheadSize;   /*!< Size of read-ahead buffer. */
+    uint32_t m_readAheadHead;   /*!< Offset of first unprocessed byte in read-ahead buffer. */
+    uint32_t m_readAheadTail;   /*!< Offset behind last received byte in read-ahead buffer. */
+
 #if !ERPC_THREADS_IS(NONE)
     Mutex m_sendLock;    //!< Mutex protecting send.
     Mutex m_receiveLock; //!< Mutex protecting receive.
 #endif
 
+    /*!
+     * @brief Writes frame header into the space reserved at the start of the message.
+     *
+     * @param[in] message Message buffer with message data behind the reserved header.
+     */
+    void writeHeader(MessageBuffer *message);
+
     /*!
      * @brief Adds ability to framed transport to overwrite MessageBuffer when sending data.
      *
@@ -179,6 +206,47 @@ protected:
      * @retval kErpcStatus_Fail When reading data ends with error.
      */
     virtual erpc_status_t underlyingReceive(uint8_t *data, uint32_t size) = 0;
+
+    /*!
+     * @brief Receive data which are available on the channel.
+     *
+     * Blocks until at least @a minSize bytes are received. Stream transports using read-ahead buffer
+     * override this function to return also data which are already available, up to @a maxSize bytes.
+     * Default implementation receives exactly @a minSize bytes.
+     *
+     * @param[inout] data Preallocated buffer for receiving data.
+     * @param[in] minSize Size of data to wait for.
+     * @param[in] maxSize Size of buffer.
+     * @param[out] received Size of received data.
+     *
+     * @retval kErpcStatus_Success When data was read successfully.
+     * @retval other Errors of underlyingReceive().
+     */
+    virtual erpc_status_t underlyingReceiveAvailable(uint8_t *data, uint32_t minSize, uint32_t maxSize,
+                                                     uint32_t &received);
+
+    /*!
+     * @brief This function sets buffer used for reading ahead.
+     *
+     * @param[in] buffer Read-ahead buffer, NULL to read only requested data.
+     * @param[in] size Size of read-ahead buffer.
+     */
+    void setReadAheadBuffer(uint8_t *buffer, uint32_t size);
+
+    /*!
+     * @brief This function drops data in read-ahead buffer, e.g. when connection is closed.
+     */
+    void resetReadAhead(void);
+
+    /*!
+     * @brief Receive data through read-ahead buffer.
+     *
+     * @param[inout] data Preallocated buffer for receiving data.
+     * @param[in] size Size of data to read.
+     *
+     * @return Status of underlyingReceive() or underlyingReceiveAvailable().
+     */
+    erpc_status_t bufferedReceive(uint8_t *data, uint32_t size);
 };
 
 } // namespace erpc
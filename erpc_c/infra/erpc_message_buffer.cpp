@@ -28,14 +28,14 @@ MessageBuffer::MessageBuffer(const MessageBuffer &buffer)
     m_used = buffer.m_used;
 }
 
-void MessageBuffer::setUsed(uint16_t used)
+void MessageBuffer::setUsed(message_size_t used)
 {
     erpc_assert(used <= m_len);
 
     m_used = used;
 }
 
-erpc_status_t MessageBuffer::read(uint16_t offset, void *data, uint32_t length)
+erpc_status_t MessageBuffer::read(message_size_t offset, void *data, uint32_t length)
 {
     erpc_status_t err = kErpcStatus_Success;
 
@@ -58,7 +58,7 @@ erpc_status_t MessageBuffer::read(uint16_t offset, void *data, uint32_t length)
     return err;
 }
 
-erpc_status_t MessageBuffer::write(uint16_t offset, const void *data, uint32_t length)
+erpc_status_t MessageBuffer::write(message_size_t offset, const void *data, uint32_t length)
 {
     erpc_status_t err = kErpcStatus_Success;
 
@@ -149,7 +149,7 @@ const uint8_t &Cursor::operator[](int index) const
     return m_pos[index];
 }
 
-Cursor &Cursor::operator+=(uint16_t n)
+Cursor &Cursor::operator+=(message_size_t n)
 {
     erpc_assert((int32_t)(m_pos - m_buffer.get()) + (int32_t)n <= (int32_t)m_buffer.getLength());
 
@@ -158,7 +158,7 @@ Cursor &Cursor::operator+=(uint16_t n)
     return *this;
 }
 
-Cursor &Cursor::operator-=(uint16_t n)
+Cursor &Cursor::operator-=(message_size_t n)
 {
     erpc_assert(((uintptr_t)m_pos >= n) && (m_pos - n) >= m_buffer.get());
 
@@ -251,7 +251,10 @@ MessageBuffer MessageBufferFactory::create(uint8_t reserveHeaderSize)
 {
     MessageBuffer messageBuffer = create();
 
-    messageBuffer.setUsed(reserveHeaderSize);
+    if (messageBuffer.get() != NULL)
+    {
+        messageBuffer.setUsed(reserveHeaderSize);
+    }
 
     return messageBuffer;
 }
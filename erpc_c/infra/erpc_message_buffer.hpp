@@ -27,6 +27,17 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace erpc {
+/*!
+ * @brief Type of message buffer lengths and offsets.
+ *
+ * 16-bit by default to save memory on small devices, 32-bit when ERPC_LARGE_MESSAGES is enabled.
+ */
+#if ERPC_LARGE_MESSAGES
+typedef uint32_t message_size_t;
+#else
+typedef uint16_t message_size_t;
+#endif
+
 /*!
  * @brief Represents a memory buffer containing a message.
  *
@@ -53,7 +64,7 @@ public:
      * @param[in] buffer Pointer to buffer.
      * @param[in] length Length of buffer.
      */
-    MessageBuffer(uint8_t *buffer, uint16_t length) : m_buf(buffer), m_len(length), m_used(0) {}
+    MessageBuffer(uint8_t *buffer, message_size_t length) : m_buf(buffer), m_len(length), m_used(0) {}
 
     MessageBuffer(const MessageBuffer &buffer);
 
@@ -65,7 +76,7 @@ public:
      * @param[in] buffer Pointer to another buffer to read/write data.
      * @param[in] length Length of buffer.
      */
-    void set(uint8_t *buffer, uint16_t length)
+    void set(uint8_t *buffer, message_size_t length)
     {
         m_buf = buffer;
         m_len = length;
@@ -91,21 +102,21 @@ public:
      *
      * @return Length of buffer.
      */
-    uint16_t getLength(void) const { return m_len; }
+    message_size_t getLength(void) const { return m_len; }
 
     /*!
      * @brief This function returns length of used space of buffer.
      *
      * @return Length of used space of buffer.
      */
-    uint16_t getUsed(void) const { return m_used; }
+    message_size_t getUsed(void) const { return m_used; }
 
     /*!
      * @brief This function returns length of free space of buffer.
      *
      * @return Length of free space of buffer.
      */
-    uint16_t getFree(void) const
+    message_size_t getFree(void) const
     {
         erpc_assert(m_used <= m_len);
         return m_len - m_used;
@@ -116,7 +127,7 @@ public:
      *
      * @param[in] used Length of used space of buffer.
      */
-    void setUsed(uint16_t used);
+    void setUsed(message_size_t used);
 
     /*!
      * @brief This function read data from local buffer.
@@ -127,7 +138,7 @@ public:
      *
      * @return Status from reading data.
      */
-    erpc_status_t read(uint16_t offset, void *data, uint32_t length);
+    erpc_status_t read(message_size_t offset, void *data, uint32_t length);
 
     /*!
      * @brief This function write data to local buffer.
@@ -138,7 +149,7 @@ public:
      *
      * @return Status from reading data.
      */
-    erpc_status_t write(uint16_t offset, const void *data, uint32_t length);
+    erpc_status_t write(message_size_t offset, const void *data, uint32_t length);
 
     /*!
      * @brief This function copy given message buffer to local instance.
@@ -182,8 +193,8 @@ public:
 
 private:
     uint8_t *volatile m_buf;  /*!< Buffer used to read write data. */
-    uint16_t volatile m_len;  /*!< Length of buffer. */
-    uint16_t volatile m_used; /*!< Used buffer bytes. */
+    message_size_t volatile m_len;  /*!< Length of buffer. */
+    message_size_t volatile m_used; /*!< Used buffer bytes. */
 };
 
 /*!
@@ -249,10 +260,10 @@ public:
      *
      * @return Remaining free space in current buffer.
      */
-    uint16_t getRemaining(void) const
+    message_size_t getRemaining(void) const
     {
         erpc_assert(m_pos >= m_buffer.get() && m_pos <= m_buffer.get() + m_buffer.getLength());
-        return m_buffer.getLength() - (uint16_t)((uintptr_t)m_pos - (uintptr_t)m_buffer.get());
+        return m_buffer.getLength() - (message_size_t)((uintptr_t)m_pos - (uintptr_t)m_buffer.get());
     }
 
     /*!
@@ -260,10 +271,10 @@ public:
      *
      * @return Remaining space from used of current buffer.
      */
-    uint16_t getRemainingUsed(void) const
+    message_size_t getRemainingUsed(void) const
     {
         erpc_assert(m_pos >= m_buffer.get() && m_pos <= m_buffer.get() + m_buffer.getLength());
-        return m_buffer.getUsed() - (uint16_t)((uintptr_t)m_pos - (uintptr_t)m_buffer.get());
+        return m_buffer.getUsed() - (message_size_t)((uintptr_t)m_pos - (uintptr_t)m_buffer.get());
     }
 
     /*!
@@ -319,7 +330,7 @@ public:
      *
      * @return Current cursor instance.
      */
-    Cursor &operator+=(uint16_t n);
+    Cursor &operator+=(message_size_t n);
 
     /*!
      * @brief Subtract operator return local buffer.
@@ -328,7 +339,7 @@ public:
      *
      * @return Current cursor instance.
      */
-    Cursor &operator-=(uint16_t n);
+    Cursor &operator-=(message_size_t n);
 
     /*!
      * @brief Sum +1 operator.
@@ -38,6 +38,14 @@ void Server::addService(Service *service)
 
         link->setNext(service);
     }
+
+#if ERPC_SERVICE_DISPATCH_TABLE
+    // Keep the first added service with the ID, as list search does.
+    if ((service->getServiceId() < kServiceTableSize) && (m_serviceTable[service->getServiceId()] == NULL))
+    {
+        m_serviceTable[service->getServiceId()] = service;
+    }
+#endif
 }
 
 void Server::removeService(Service *service)
@@ -60,6 +68,13 @@ void Server::removeService(Service *service)
             link = link->getNext();
         }
     }
+
+#if ERPC_SERVICE_DISPATCH_TABLE
+    if ((service->getServiceId() < kServiceTableSize) && (m_serviceTable[service->getServiceId()] == service))
+    {
+        m_serviceTable[service->getServiceId()] = searchServiceList(service->getServiceId());
+    }
+#endif
 }
 
 erpc_status_t Server::readHeadOfMessage(Codec *codec, message_type_t &msgType, uint32_t &serviceId, uint32_t &methodId,
@@ -98,6 +113,26 @@ erpc_status_t Server::processMessage(Codec *codec, message_type_t msgType, uint3
 }
 
 Service *Server::findServiceWithId(uint32_t serviceId)
+{
+    Service *service;
+
+#if ERPC_SERVICE_DISPATCH_TABLE
+    if (serviceId < kServiceTableSize)
+    {
+        service = m_serviceTable[serviceId];
+    }
+    else
+    {
+        service = searchServiceList(serviceId);
+    }
+#else
+    service = searchServiceList(serviceId);
+#endif
+
+    return service;
+}
+
+Service *Server::searchServiceList(uint32_t serviceId)
 {
     Service *service = m_firstService;
     while (service != NULL)
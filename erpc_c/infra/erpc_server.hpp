@@ -103,7 +103,17 @@ public:
      *
      * This function initializes object attributes.
      */
-    Server(void) : ClientServerCommon(), m_firstService(NULL) {}
+    Server(void) : ClientServerCommon(), m_firstService(NULL)
+    {
+#if ERPC_SERVICE_DISPATCH_TABLE
+        uint32_t i;
+
+        for (i = 0U; i < kServiceTableSize; ++i)
+        {
+            m_serviceTable[i] = NULL;
+        }
+#endif
+    }
 
     /*!
      * @brief Server destructor
@@ -136,6 +146,10 @@ public:
 
 protected:
     Service *m_firstService; /*!< Contains pointer to first service. */
+#if ERPC_SERVICE_DISPATCH_TABLE
+    static const uint32_t kServiceTableSize = 256U; //!< Number of service IDs looked up in table.
+    Service *m_serviceTable[kServiceTableSize];     /*!< Services indexed by service ID. */
+#endif
 
     /*!
      * @brief Process message.
@@ -174,6 +188,15 @@ protected:
      */
     virtual Service *findServiceWithId(uint32_t serviceId);
 
+    /*!
+     * @brief This function searches the list of added services for service ID.
+     *
+     * @param[in] serviceId Service id number.
+     *
+     * @return Pointer to first added service with the ID or NULL.
+     */
+    Service *searchServiceList(uint32_t serviceId);
+
 #if ERPC_NESTED_CALLS
     friend class ClientManager;
     friend class ArbitratedClientManager;
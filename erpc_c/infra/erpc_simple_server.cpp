@@ -71,6 +71,9 @@ erpc_status_t SimpleServer::runInternal(void)
     erpc_status_t err = runInternalBegin(&codec, buff, msgType, serviceId, methodId, sequence);
     if (err == kErpcStatus_Success)
     {
+#if ERPC_SERVER_ARENA
+        codec->setArena(&m_arena);
+#endif
         err = runInternalEnd(codec, msgType, serviceId, methodId, sequence);
     }
 
@@ -148,12 +151,46 @@ erpc_status_t SimpleServer::runInternalBegin(Codec **codec, MessageBuffer &buff,
 erpc_status_t SimpleServer::runInternalEnd(Codec *codec, message_type_t msgType, uint32_t serviceId, uint32_t methodId,
                                            uint32_t sequence)
 {
-    erpc_status_t err = processMessage(codec, msgType, serviceId, methodId, sequence);
+    erpc_status_t err;
+#if ERPC_SERVER_ARENA
+    Arena *arena = codec->getArena();
+    uint32_t arenaMark = 0;
+
+    if (arena != NULL)
+    {
+        arenaMark = arena->open(codec->getBufferRef().getUsed());
+    }
+#endif
+#if ERPC_STATS
+    bool statsSampled = isSampled(sequence);
+    uint64_t statsStart = 0;
+    uint64_t statsEncodeEnd = 0;
+    uint32_t statsBytesIn = codec->getBufferRef().getUsed();
+    uint32_t statsBytesOut = 0;
+
+    if (statsSampled)
+    {
+        statsStart = erpc_call_stats_port_get_time();
+    }
+    codec->clearHandlerMarks(statsSampled);
+#endif
+
+    err = processMessage(codec, msgType, serviceId, methodId, sequence);
+
+#if ERPC_STATS
+    if (statsSampled)
+    {
+        statsEncodeEnd = erpc_call_stats_port_get_time();
+    }
+#endif
 
     if (err == kErpcStatus_Success)
     {
         if (msgType != message_type_t::kOnewayMessage)
         {
+#if ERPC_STATS
+            statsBytesOut = codec->getBufferRef().getUsed();
+#endif
 #if ERPC_MESSAGE_LOGGING
             err = logMessage(codec->getBuffer());
             if (err == kErpcStatus_Success)
@@ -174,12 +211,65 @@ erpc_status_t SimpleServer::runInternalEnd(Codec *codec, message_type_t msgType,
 #endif
     }
 
+#if ERPC_STATS
+    recordServerCall(codec, serviceId, methodId, err, statsBytesIn, statsBytesOut, statsStart, statsEncodeEnd);
+#endif
+
+#if ERPC_SERVER_ARENA
+    // Decoded parameters were freed, release their arena memory at once.
+    codec->setArena(NULL);
+    if (arena != NULL)
+    {
+        arena->close(arenaMark);
+    }
+#endif
+
     // Dispose of buffers and codecs.
     disposeBufferAndCodec(codec);
 
     return err;
 }
 
+#if ERPC_STATS
+void SimpleServer::recordServerCall(Codec *codec, uint32_t serviceId, uint32_t methodId, erpc_status_t err,
+                                    uint32_t bytesIn, uint32_t bytesOut, uint64_t start, uint64_t encodeEnd)
+{
+    uint64_t time[kErpcCallPhase_Count];
+    uint64_t handlerStart = codec->getHandlerStart();
+    uint64_t handlerEnd = codec->getHandlerEnd();
+    bool error = (err != kErpcStatus_Success);
+
+    if (start == 0U)
+    {
+        // Time of this call is not measured.
+        recordCall(serviceId, methodId, error, bytesIn, bytesOut, NULL);
+    }
+    else
+    {
+        if (handlerStart == 0U)
+        {
+            // Request was not decoded up to the served function call.
+            time[kErpcCallPhase_Decode] = encodeEnd - start;
+            time[kErpcCallPhase_Handler] = 0;
+            time[kErpcCallPhase_Encode] = 0;
+        }
+        else
+        {
+            if (handlerEnd < handlerStart)
+            {
+                handlerEnd = handlerStart;
+            }
+            time[kErpcCallPhase_Decode] = handlerStart - start;
+            time[kErpcCallPhase_Handler] = handlerEnd - handlerStart;
+            time[kErpcCallPhase_Encode] = encodeEnd - handlerEnd;
+        }
+        time[kErpcCallPhase_Transport] = erpc_call_stats_port_get_time() - encodeEnd;
+
+        recordCall(serviceId, methodId, error, bytesIn, bytesOut, time);
+    }
+}
+#endif
+
 #if ERPC_NESTED_CALLS
 erpc_status_t SimpleServer::run(RequestContext &request)
 {
@@ -224,6 +314,9 @@ erpc_status_t SimpleServer::run(RequestContext &request)
         }
         else
         {
+#if ERPC_SERVER_ARENA
+            codec->setArena(&m_arena);
+#endif
             err = runInternalEnd(codec, msgType, serviceId, methodId, sequence);
         }
     }
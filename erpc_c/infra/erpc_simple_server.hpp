@@ -66,6 +66,9 @@ public:
 
 protected:
     bool m_isServerOn; /*!< Information if server is ON or OFF. */
+#if ERPC_SERVER_ARENA
+    Arena m_arena; /*!< Arena for parameters of requests processed by run() or poll(). */
+#endif
 
     /*!
      * @brief Run server implementation.
@@ -93,6 +96,9 @@ protected:
     /*!
      * @brief This function process message and handle sending respond.
      *
+     * When the codec has an arena, the arena is opened for the request before processing and closed after the reply
+     * is sent.
+     *
      * @param[in] codec Inout codec to use.
      * @param[in] msgType Type of received message. Based on message type will be (will be not) sent respond.
      * @param[in] serviceId To identify interface.
@@ -113,6 +119,23 @@ protected:
     virtual erpc_status_t run(RequestContext &request) override;
 #endif
 
+#if ERPC_STATS
+    /*!
+     * @brief This function records call statistics of processed request.
+     *
+     * @param[in] codec Codec with served function times.
+     * @param[in] serviceId Service ID of request.
+     * @param[in] methodId Method ID of request.
+     * @param[in] err Result of processing.
+     * @param[in] bytesIn Size of request.
+     * @param[in] bytesOut Size of reply, zero when not sent.
+     * @param[in] start Time when processing started, zero when time of the call is not measured.
+     * @param[in] encodeEnd Time when reply was written.
+     */
+    void recordServerCall(Codec *codec, uint32_t serviceId, uint32_t methodId, erpc_status_t err, uint32_t bytesIn,
+                          uint32_t bytesOut, uint64_t start, uint64_t encodeEnd);
+#endif
+
     /*!
      * @brief Disposing message buffers and codecs.
      *
@@ -0,0 +1,235 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_stream.hpp"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! Count of chunks acknowledged at once by the receiver.
+#define ERPC_STREAM_ACK_STEP ((ERPC_STREAM_WINDOW > 1U) ? (ERPC_STREAM_WINDOW / 2U) : 1U)
+
+//! Most bytes taken by the last chunk flag and the length of the element list in a chunk message.
+#define ERPC_STREAM_CHUNK_OVERHEAD (sizeof(bool) + sizeof(uint32_t) + 1U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+Stream::Stream(Codec *codec, Transport *transport, MessageBufferFactory *messageFactory, uint32_t service,
+               uint32_t method, uint32_t sequence) :
+m_codec(codec), m_transport(transport), m_messageFactory(messageFactory), m_service(service), m_method(method),
+m_sequence(sequence), m_length(0), m_chunks(0)
+{
+}
+
+void Stream::send(const void *data, uint32_t length, uint8_t elementSize, element_kind_t kind)
+{
+    const uint8_t *elements = reinterpret_cast<const uint8_t *>(data);
+    uint32_t sent = 0U;
+    uint32_t chunks = 0U;
+    uint32_t acked = 0U;
+    uint32_t count = 0U;
+    uint32_t space;
+    bool last = false;
+
+    if (m_codec->isStatusOk() && (length > 0U) && (data == NULL))
+    {
+        m_codec->updateStatus(kErpcStatus_MemoryError);
+    }
+
+    while (m_codec->isStatusOk() && !last)
+    {
+        // Wait until the receiver has room for next chunk.
+        while (m_codec->isStatusOk() && ((chunks - acked) >= ERPC_STREAM_WINDOW))
+        {
+            receiveAck(acked);
+            if (acked > chunks)
+            {
+                m_codec->updateStatus(kErpcStatus_InvalidArgument);
+            }
+        }
+
+        startMessage(message_type_t::kStreamChunkMessage);
+        m_codec->write(length);
+
+        if (m_codec->isStatusOk())
+        {
+            // Elements fill the rest of the message buffer.
+            space = m_codec->getBufferRef().getLength() - m_codec->getBufferRef().getUsed();
+            space = (space > ERPC_STREAM_CHUNK_OVERHEAD) ? (space - ERPC_STREAM_CHUNK_OVERHEAD) : 0U;
+            count = space / m_codec->getArrayElementMaxSize(elementSize, kind);
+
+            if (count >= (length - sent))
+            {
+                count = length - sent;
+                last = true;
+            }
+            else if (count == 0U)
+            {
+                m_codec->updateStatus(kErpcStatus_BufferOverrun);
+            }
+            else
+            {
+                // Not the last chunk.
+            }
+        }
+
+        m_codec->write(last);
+        m_codec->startWriteList(count);
+        m_codec->writeArray(count, elementSize, kind, (count > 0U) ? &elements[(size_t)sent * elementSize] : NULL);
+        sendMessage();
+
+        sent += count;
+        ++chunks;
+    }
+
+    // Receiver acknowledges the last chunk when it has all elements.
+    while (m_codec->isStatusOk() && (acked != chunks))
+    {
+        receiveAck(acked);
+        if (acked > chunks)
+        {
+            m_codec->updateStatus(kErpcStatus_InvalidArgument);
+        }
+    }
+}
+
+void Stream::receiveLength(uint32_t &length)
+{
+    m_chunks = 0U;
+    m_length = 0U;
+
+    receiveMessage(message_type_t::kStreamChunkMessage);
+    m_codec->read(m_length);
+
+    length = m_length;
+}
+
+void Stream::receive(void *data, uint32_t length, uint8_t elementSize, element_kind_t kind)
+{
+    uint8_t *elements = reinterpret_cast<uint8_t *>(data);
+    uint32_t received = 0U;
+    uint32_t chunkLength;
+    uint32_t count;
+    bool last = false;
+
+    if (m_codec->isStatusOk() && (length != m_length))
+    {
+        m_codec->updateStatus(kErpcStatus_InvalidArgument);
+    }
+
+    // Header and length of the first chunk were read by receiveLength().
+    while (m_codec->isStatusOk())
+    {
+        count = 0U;
+        m_codec->read(last);
+        m_codec->startReadList(count);
+
+        if (m_codec->isStatusOk() && ((count > (length - received)) || (last && (count != (length - received)))))
+        {
+            m_codec->updateStatus(kErpcStatus_InvalidArgument);
+        }
+
+        m_codec->readArray(count, elementSize, kind, (count > 0U) ? &elements[(size_t)received * elementSize] : NULL);
+
+        received += count;
+        ++m_chunks;
+
+        if (m_codec->isStatusOk() && (last || ((m_chunks % ERPC_STREAM_ACK_STEP) == 0U)))
+        {
+            sendAck();
+        }
+
+        if (last)
+        {
+            break;
+        }
+
+        receiveMessage(message_type_t::kStreamChunkMessage);
+
+        chunkLength = 0U;
+        m_codec->read(chunkLength);
+        if (m_codec->isStatusOk() && (chunkLength != m_length))
+        {
+            m_codec->updateStatus(kErpcStatus_InvalidArgument);
+        }
+    }
+}
+
+void Stream::startMessage(message_type_t type)
+{
+    erpc_status_t err;
+
+    if (m_codec->isStatusOk())
+    {
+        err = m_messageFactory->prepareServerBufferForSend(m_codec->getBufferRef(), m_transport->reserveHeaderSize());
+        m_codec->updateStatus(err);
+    }
+
+    if (m_codec->isStatusOk())
+    {
+        m_codec->reset(m_transport->reserveHeaderSize());
+        m_codec->startWriteMessage(type, m_service, m_method, m_sequence);
+    }
+}
+
+void Stream::sendMessage(void)
+{
+    erpc_status_t err;
+
+    if (m_codec->isStatusOk())
+    {
+        err = m_transport->send(&m_codec->getBufferRef());
+        m_codec->updateStatus(err);
+    }
+}
+
+void Stream::receiveMessage(message_type_t type)
+{
+    erpc_status_t err;
+    message_type_t msgType;
+    uint32_t service;
+    uint32_t method;
+    uint32_t sequence;
+
+    if (m_codec->isStatusOk())
+    {
+        err = m_transport->receive(&m_codec->getBufferRef());
+        m_codec->updateStatus(err);
+    }
+
+    if (m_codec->isStatusOk())
+    {
+        // Some transport layers change the message buffer pointer (for things like zero copy support),
+        // so codec must be reset to work with correct buffer.
+        m_codec->reset(m_transport->reserveHeaderSize());
+        m_codec->startReadMessage(msgType, service, method, sequence);
+    }
+
+    if (m_codec->isStatusOk() && ((msgType != type) || (sequence != m_sequence)))
+    {
+        m_codec->updateStatus(kErpcStatus_ExpectedReply);
+    }
+}
+
+void Stream::receiveAck(uint32_t &chunks)
+{
+    receiveMessage(message_type_t::kStreamAckMessage);
+    m_codec->read(chunks);
+}
+
+void Stream::sendAck(void)
+{
+    startMessage(message_type_t::kStreamAckMessage);
+    m_codec->write(m_chunks);
+    sendMessage();
+}
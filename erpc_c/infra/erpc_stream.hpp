@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _EMBEDDED_RPC__STREAM_H_
+#define _EMBEDDED_RPC__STREAM_H_
+
+#include "erpc_codec.hpp"
+#include "erpc_config_internal.h"
+#include "erpc_message_buffer.hpp"
+#include "erpc_transport.hpp"
+
+/*!
+ * @addtogroup infra_utility
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Transfers streamed parameter or return value of a function in chunk messages.
+ *
+ * Streamed value is a list or binary of scalar elements. Sender splits the elements into chunk messages, each filling
+ * one message buffer, so the value may be larger than a message buffer. Every chunk carries the count of all elements
+ * of the stream, flag of the last chunk and a list of elements. Receiver acknowledges every half of ERPC_STREAM_WINDOW
+ * chunks and the last chunk by an ack message with the count of chunks received. Sender does not send next chunk while
+ * ERPC_STREAM_WINDOW chunks are not acknowledged.
+ *
+ * Streamed parameter follows the invocation message, streamed return value precedes the reply message. All messages of
+ * the stream use the sequence of the call. Stream uses the codec, transport and message buffer factory of the call, so
+ * the transport must not be shared with other clients or servers (TransportArbitrator is not supported) and the
+ * server has to receive messages in the thread processing the request (SimpleServer, not ThreadPoolServer).
+ *
+ * Errors are reported by status of the codec.
+ *
+ * @ingroup infra_utility
+ */
+class Stream
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * @param[in] codec Codec of the call.
+     * @param[in] transport Transport of the call.
+     * @param[in] messageFactory Message buffer factory of the call.
+     * @param[in] service Service id of the called function.
+     * @param[in] method Id of the called function.
+     * @param[in] sequence Sequence of the call.
+     */
+    Stream(Codec *codec, Transport *transport, MessageBufferFactory *messageFactory, uint32_t service, uint32_t method,
+           uint32_t sequence);
+
+    /*!
+     * @brief Sends elements in chunk messages and receives their acknowledgements.
+     *
+     * @param[in] data Elements to send.
+     * @param[in] length Count of elements.
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     */
+    void send(const void *data, uint32_t length, uint8_t elementSize, element_kind_t kind);
+
+    /*!
+     * @brief Receives first chunk message and reads count of elements of the stream.
+     *
+     * Caller allocates memory for the elements and passes it to receive().
+     *
+     * @param[out] length Count of elements.
+     */
+    void receiveLength(uint32_t &length);
+
+    /*!
+     * @brief Reads elements of the first chunk and receives the rest of chunk messages.
+     *
+     * @param[out] data Memory for elements.
+     * @param[in] length Count of elements read by receiveLength().
+     * @param[in] elementSize Size of one element in bytes: 1, 2, 4 or 8.
+     * @param[in] kind Kind of elements.
+     */
+    void receive(void *data, uint32_t length, uint8_t elementSize, element_kind_t kind);
+
+protected:
+    /*!
+     * @brief Prepares the message buffer and writes header of a message of the stream.
+     *
+     * @param[in] type Type of the message.
+     */
+    void startMessage(message_type_t type);
+
+    /*!
+     * @brief Sends message written to the codec.
+     */
+    void sendMessage(void);
+
+    /*!
+     * @brief Receives message of the stream and reads its header.
+     *
+     * @param[in] type Expected type of the message.
+     */
+    void receiveMessage(message_type_t type);
+
+    /*!
+     * @brief Receives acknowledgement of chunks.
+     *
+     * @param[out] chunks Count of chunks received by the receiver.
+     */
+    void receiveAck(uint32_t &chunks);
+
+    /*!
+     * @brief Sends acknowledgement of received chunks.
+     */
+    void sendAck(void);
+
+    Codec *m_codec;                         /*!< Codec of the call. */
+    Transport *m_transport;                 /*!< Transport of the call. */
+    MessageBufferFactory *m_messageFactory; /*!< Message buffer factory of the call. */
+    uint32_t m_service;                     /*!< Service id of the called function. */
+    uint32_t m_method;                      /*!< Id of the called function. */
+    uint32_t m_sequence;                    /*!< Sequence of the call. */
+    uint32_t m_length;                      /*!< Count of elements announced by the first received chunk. */
+    uint32_t m_chunks;                      /*!< Count of received chunks. */
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__STREAM_H_
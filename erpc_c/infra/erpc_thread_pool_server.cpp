@@ -0,0 +1,257 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_thread_pool_server.hpp"
+
+#if ERPC_THREADS_IS(NONE)
+#error "Thread pool server does not work in no-threading configuration."
+#endif
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Each request in flight holds a message buffer and a codec, with static allocation they come from fixed pools.
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+#define ERPC_THREAD_POOL_SERVER_REQUESTS_LIMIT \
+    ((ERPC_DEFAULT_BUFFERS_COUNT < ERPC_CODEC_COUNT) ? ERPC_DEFAULT_BUFFERS_COUNT : ERPC_CODEC_COUNT)
+#else
+#define ERPC_THREAD_POOL_SERVER_REQUESTS_LIMIT \
+    (ERPC_THREAD_POOL_SERVER_MAX_WORKERS + ERPC_THREAD_POOL_SERVER_QUEUE_SIZE + 1U)
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+ThreadPoolServer::ThreadPoolServer(uint32_t workerCount, uint32_t priority, uint32_t stackSize) :
+SimpleServer(), m_workerCount(workerCount), m_priority(priority), m_stackSize(stackSize), m_workersRunning(false),
+m_workerStatus(kErpcStatus_Success), m_jobs(), m_jobsLock(), m_jobsPending(0),
+m_jobsFree(ERPC_THREAD_POOL_SERVER_QUEUE_SIZE), m_requestsFree(ERPC_THREAD_POOL_SERVER_REQUESTS_LIMIT),
+m_workersStopped(0)
+{
+    if (m_workerCount > ERPC_THREAD_POOL_SERVER_MAX_WORKERS)
+    {
+        m_workerCount = ERPC_THREAD_POOL_SERVER_MAX_WORKERS;
+    }
+    else if (m_workerCount == 0U)
+    {
+        m_workerCount = 1U;
+    }
+}
+
+ThreadPoolServer::~ThreadPoolServer(void)
+{
+    stopWorkers();
+}
+
+erpc_status_t ThreadPoolServer::run(void)
+{
+    erpc_status_t err = kErpcStatus_Success;
+
+    startWorkers();
+
+    while ((err == kErpcStatus_Success) && m_isServerOn)
+    {
+        err = dispatch();
+    }
+
+    stopWorkers();
+
+    // Service can stop the server while this thread waits for the next request, which then fails.
+    if (!m_isServerOn)
+    {
+        err = kErpcStatus_Success;
+    }
+
+    if (err == kErpcStatus_Success)
+    {
+        err = getWorkerStatus();
+    }
+
+    return err;
+}
+
+erpc_status_t ThreadPoolServer::poll(void)
+{
+    erpc_status_t err;
+
+    if (m_isServerOn)
+    {
+        startWorkers();
+
+        if (m_transport->hasMessage() == true)
+        {
+            err = dispatch();
+        }
+        else
+        {
+            err = getWorkerStatus();
+        }
+    }
+    else
+    {
+        stopWorkers();
+        err = kErpcStatus_ServerIsDown;
+    }
+
+    return err;
+}
+
+void ThreadPoolServer::startWorkers(void)
+{
+    uint32_t i;
+
+    if (!m_workersRunning)
+    {
+        m_workersRunning = true;
+
+        {
+            Mutex::Guard lock(m_jobsLock);
+            m_workerStatus = kErpcStatus_Success;
+        }
+
+        for (i = 0U; i < m_workerCount; i++)
+        {
+            m_workers[i].init(workerThreadStub, m_priority, m_stackSize);
+            m_workers[i].start(this);
+        }
+    }
+}
+
+void ThreadPoolServer::stopWorkers(void)
+{
+    Job job;
+    uint32_t i;
+
+    if (m_workersRunning)
+    {
+        job.m_codec = NULL;
+        job.m_msgType = message_type_t::kOnewayMessage;
+        job.m_serviceId = 0U;
+        job.m_methodId = 0U;
+        job.m_sequence = 0U;
+
+        // Queue is processed in order, so every job received before is finished first.
+        for (i = 0U; i < m_workerCount; i++)
+        {
+            pushJob(job);
+        }
+
+        for (i = 0U; i < m_workerCount; i++)
+        {
+            (void)m_workersStopped.get();
+        }
+
+        m_workersRunning = false;
+    }
+}
+
+erpc_status_t ThreadPoolServer::dispatch(void)
+{
+    MessageBuffer buff;
+    Job job;
+
+    job.m_codec = NULL;
+
+    // Wait until a worker finishes a request when all buffers and codecs for requests are taken.
+    (void)m_requestsFree.get();
+
+    erpc_status_t err =
+        runInternalBegin(&job.m_codec, buff, job.m_msgType, job.m_serviceId, job.m_methodId, job.m_sequence);
+    if (err == kErpcStatus_Success)
+    {
+        pushJob(job);
+
+        // Report failure of any worker the same way SimpleServer reports failure of request processing.
+        err = getWorkerStatus();
+    }
+    else
+    {
+        m_requestsFree.put();
+    }
+
+    return err;
+}
+
+erpc_status_t ThreadPoolServer::getWorkerStatus(void)
+{
+    Mutex::Guard lock(m_jobsLock);
+
+    return m_workerStatus;
+}
+
+void ThreadPoolServer::setWorkerStatus(erpc_status_t err)
+{
+    Mutex::Guard lock(m_jobsLock);
+
+    if ((err != kErpcStatus_Success) && (m_workerStatus == kErpcStatus_Success))
+    {
+        m_workerStatus = err;
+    }
+}
+
+void ThreadPoolServer::pushJob(const Job &job)
+{
+    (void)m_jobsFree.get();
+
+    {
+        Mutex::Guard lock(m_jobsLock);
+        (void)m_jobs.add(job);
+    }
+
+    m_jobsPending.put();
+}
+
+void ThreadPoolServer::workerThread(void)
+{
+    Job job;
+    erpc_status_t err;
+#if ERPC_SERVER_ARENA
+    // Requests are processed concurrently, so each worker has its own arena.
+    Arena arena;
+#endif
+
+    for (;;)
+    {
+        (void)m_jobsPending.get();
+
+        {
+            Mutex::Guard lock(m_jobsLock);
+            (void)m_jobs.get(&job);
+        }
+
+        m_jobsFree.put();
+
+        if (job.m_codec == NULL)
+        {
+            break;
+        }
+
+#if ERPC_SERVER_ARENA
+        job.m_codec->setArena(&arena);
+#endif
+        err = runInternalEnd(job.m_codec, job.m_msgType, job.m_serviceId, job.m_methodId, job.m_sequence);
+        m_requestsFree.put();
+        setWorkerStatus(err);
+    }
+
+    m_workersStopped.put();
+}
+
+void ThreadPoolServer::workerThreadStub(void *arg)
+{
+    ThreadPoolServer *server = reinterpret_cast<ThreadPoolServer *>(arg);
+
+    if (server != NULL)
+    {
+        server->workerThread();
+    }
+}
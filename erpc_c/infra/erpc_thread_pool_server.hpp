@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _EMBEDDED_RPC__THREAD_POOL_SERVER_H_
+#define _EMBEDDED_RPC__THREAD_POOL_SERVER_H_
+
+#include "erpc_simple_server.hpp"
+#include "erpc_static_queue.hpp"
+#include "erpc_threading.h"
+
+/*!
+ * @addtogroup infra_server
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Server processing requests on a pool of worker threads.
+ *
+ * The thread calling run() only receives messages and decodes their header. Each decoded
+ * request (codec together with its message buffer) is queued and picked up by one of the
+ * worker threads, which calls the service, sends the reply and disposes the codec. Requests
+ * are therefore executed concurrently, so service implementations must be thread safe.
+ *
+ * The transport must allow send() to be called from several threads at once. FramedTransport
+ * based transports serialize send() calls with their send lock. Replies can be sent in a
+ * different order than requests were received, which is fine for transports that route the
+ * reply back by the request (e.g. TCPEpollServerTransport) and for clients matching replies
+ * by sequence number.
+ *
+ * Each request in flight holds one message buffer and one codec: up to worker count requests being
+ * processed, ERPC_THREAD_POOL_SERVER_QUEUE_SIZE queued ones and one being received. With static
+ * allocation policy, requests in flight are also limited to ERPC_DEFAULT_BUFFERS_COUNT and
+ * ERPC_CODEC_COUNT, so the receiving thread waits for a worker instead of failing on exhausted
+ * static pools. Raise both to at least worker count + 1 to let all workers run at once.
+ *
+ * Nested calls are not supported from worker threads.
+ *
+ * @ingroup infra_server
+ */
+class ThreadPoolServer : public SimpleServer
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * This function initializes object attributes. Worker threads are started by run() or poll().
+     *
+     * @param[in] workerCount Count of worker threads, limited by ERPC_THREAD_POOL_SERVER_MAX_WORKERS.
+     * @param[in] priority Priority of worker threads.
+     * @param[in] stackSize Stack size of worker threads.
+     */
+    ThreadPoolServer(uint32_t workerCount, uint32_t priority = 0, uint32_t stackSize = 0);
+
+    /*!
+     * @brief ThreadPoolServer destructor.
+     *
+     * Stops worker threads when they are still running.
+     */
+    virtual ~ThreadPoolServer(void);
+
+    /*!
+     * @brief Run server until it is stopped or an error occurs.
+     *
+     * Receives requests on the calling thread and dispatches them to worker threads. Before
+     * returning, all queued requests are finished and worker threads are stopped. Error of
+     * receiving after stop() is not reported, e.g. when a service stopped the server and the
+     * client closed the connection.
+     *
+     * @return Error of receiving, or first error reported by a worker thread.
+     */
+    virtual erpc_status_t run(void) override;
+
+    /*!
+     * @brief Receive and dispatch one request only if there is a message to process.
+     *
+     * Worker threads are kept running between poll() calls. They are stopped by the first
+     * poll() call after stop(), or by the destructor.
+     *
+     * @return Error of receiving, or first error reported by a worker thread.
+     */
+    virtual erpc_status_t poll(void) override;
+
+    /*!
+     * @brief Returns count of worker threads.
+     *
+     * @return Count of worker threads.
+     */
+    uint32_t getWorkerCount(void) const { return m_workerCount; }
+
+protected:
+    /*! @brief Decoded request waiting for a worker thread. */
+    struct Job
+    {
+        Codec *m_codec;           //!< Codec with request message buffer, NULL to stop worker.
+        message_type_t m_msgType; //!< Type of request.
+        uint32_t m_serviceId;     //!< Service identifier.
+        uint32_t m_methodId;      //!< Method identifier.
+        uint32_t m_sequence;      //!< Sequence number of request.
+    };
+
+    Thread m_workers[ERPC_THREAD_POOL_SERVER_MAX_WORKERS]; /*!< Worker threads. */
+    uint32_t m_workerCount;                                 /*!< Count of used worker threads. */
+    uint32_t m_priority;                                    /*!< Priority of worker threads. */
+    uint32_t m_stackSize;                                   /*!< Stack size of worker threads. */
+    bool m_workersRunning;                                  /*!< Worker threads were started. */
+    erpc_status_t m_workerStatus;                           /*!< First error reported by worker thread. */
+
+    StaticQueue<Job, ERPC_THREAD_POOL_SERVER_QUEUE_SIZE + 1U> m_jobs; /*!< Queue of decoded requests. */
+    Mutex m_jobsLock;                                                 /*!< Guards m_jobs and m_workerStatus. */
+    Semaphore m_jobsPending;    /*!< Count of jobs in m_jobs. */
+    Semaphore m_jobsFree;       /*!< Count of free slots in m_jobs. */
+    Semaphore m_requestsFree;   /*!< Count of requests which can be received before workers finish some. */
+    Semaphore m_workersStopped; /*!< Put by each worker thread when it exits. */
+
+    /*!
+     * @brief Starts worker threads if they are not running yet.
+     */
+    void startWorkers(void);
+
+    /*!
+     * @brief Lets worker threads finish queued jobs and waits until they exit.
+     */
+    void stopWorkers(void);
+
+    /*!
+     * @brief Receives one request and queues it for worker threads.
+     *
+     * @return Status of receiving and decoding request header.
+     */
+    erpc_status_t dispatch(void);
+
+    /*!
+     * @brief Returns first error reported by a worker thread.
+     *
+     * @return First error of worker threads, #kErpcStatus_Success when there was none.
+     */
+    erpc_status_t getWorkerStatus(void);
+
+    /*!
+     * @brief Stores error of a worker thread, unless an earlier error is stored.
+     *
+     * @param[in] err Status of processed request.
+     */
+    void setWorkerStatus(erpc_status_t err);
+
+    /*!
+     * @brief Adds job to the queue, blocks while queue is full.
+     *
+     * @param[in] job Job to add.
+     */
+    void pushJob(const Job &job);
+
+    /*!
+     * @brief Main loop of worker thread.
+     */
+    void workerThread(void);
+
+    /*!
+     * @brief Worker thread entry point.
+     *
+     * @param[in] arg Pointer to ThreadPoolServer instance.
+     */
+    static void workerThreadStub(void *arg);
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__THREAD_POOL_SERVER_H_
@@ -11,6 +11,7 @@
 
 #include "erpc_config_internal.h"
 #include "erpc_manually_constructed.hpp"
+#include "erpc_port.h"
 
 #include <cstdio>
 #include <string>
@@ -29,15 +30,39 @@ ERPC_MANUALLY_CONSTRUCTED_ARRAY_STATIC(TransportArbitrator::PendingClientInfo, s
                                        ERPC_CLIENTS_THREADS_AMOUNT);
 
 TransportArbitrator::TransportArbitrator(void) :
-Transport(), m_sharedTransport(NULL), m_codec(NULL), m_clientList(NULL), m_clientFreeList(NULL), m_clientListMutex()
+Transport(), m_sharedTransport(NULL), m_codec(NULL), m_clientTable(m_clientTableStorage),
+m_clientTableSize(ERPC_PENDING_CLIENTS_TABLE_SIZE), m_clientCount(0U), m_clientFreeList(NULL), m_clientListMutex()
 {
+    uint32_t i;
+
+    for (i = 0U; i < m_clientTableSize; ++i)
+    {
+        m_clientTable[i] = NULL;
+    }
 }
 
 TransportArbitrator::~TransportArbitrator(void)
 {
+    uint32_t i;
+
     // Dispose of client info objects.
-    freeClientList(m_clientList);
+    for (i = 0U; i < m_clientTableSize; ++i)
+    {
+        if (m_clientTable[i] != NULL)
+        {
+            m_clientTable[i]->m_next = m_clientFreeList;
+            m_clientFreeList = m_clientTable[i];
+            m_clientTable[i] = NULL;
+        }
+    }
     freeClientList(m_clientFreeList);
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    if (m_clientTable != m_clientTableStorage)
+    {
+        erpc_free(m_clientTable);
+    }
+#endif
 }
 
 uint8_t TransportArbitrator::reserveHeaderSize(void)
@@ -54,6 +79,7 @@ erpc_status_t TransportArbitrator::receive(MessageBuffer *message)
     uint32_t service;
     uint32_t requestNumber;
     uint32_t sequence;
+    uint32_t slot;
     PendingClientInfo *client;
 
     while (true)
@@ -65,10 +91,12 @@ erpc_status_t TransportArbitrator::receive(MessageBuffer *message)
             // if we timeout, we must unblock all pending client(s)
             if (err == kErpcStatus_Timeout || err == kErpcStatus_ReceiveFailed)
             {
-                client = m_clientList;
-                for (; client != NULL; client = client->m_next)
+                Mutex::Guard lock(m_clientListMutex);
+
+                for (slot = 0U; slot < m_clientTableSize; ++slot)
                 {
-                    if (client->m_isValid)
+                    client = m_clientTable[slot];
+                    if ((client != NULL) && client->m_isValid)
                     {
                         client->m_request->getCodec()->updateStatus(err);
                         client->m_sem.put();
@@ -101,18 +129,21 @@ erpc_status_t TransportArbitrator::receive(MessageBuffer *message)
         }
 
         // Check if there is a client waiting for this message.
-        client = m_clientList;
-        for (; client != NULL; client = client->m_next)
+        client = NULL;
         {
-            if (client->m_isValid && (sequence == client->m_request->getSequence()))
+            Mutex::Guard lock(m_clientListMutex);
+
+            slot = findPendingClient(sequence);
+            if (slot < m_clientTableSize)
             {
+                client = m_clientTable[slot];
+
                 // Swap the received message buffer with the client's message buffer.
                 client->m_request->getCodec()->getBufferRef().swap(message);
                 client->m_request->getCodec()->updateStatus(kErpcStatus_Success);
 
                 // Wake up the client receive thread.
                 client->m_sem.put();
-                break;
             }
         }
 
@@ -176,15 +207,84 @@ Codec *TransportArbitrator::getCodec(void)
 
 TransportArbitrator::client_token_t TransportArbitrator::prepareClientReceive(RequestContext &request)
 {
-    PendingClientInfo *info = addPendingClient();
+    PendingClientInfo *info;
+    Mutex::Guard lock(m_clientListMutex);
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    // Keep probed runs short. When bigger table cannot be allocated, the current one is used until it is full.
+    if (((m_clientCount + 1U) * 4U) > (m_clientTableSize * 3U))
+    {
+        (void)growClientTable();
+    }
+#endif
+
+    info = (m_clientCount < m_clientTableSize) ? addPendingClient() : NULL;
     if (NULL != info)
     {
         info->m_request = &request;
+        info->m_sequence = request.getSequence();
         info->m_isValid = true;
+
+        insertPendingClient(info);
+        ++m_clientCount;
     }
     return reinterpret_cast<client_token_t>(info);
 }
 
+void TransportArbitrator::insertPendingClient(PendingClientInfo *info)
+{
+    uint32_t slot;
+
+    // Linear probing from the sequence slot.
+    slot = getClientSlot(info->m_sequence);
+    while (m_clientTable[slot] != NULL)
+    {
+        slot = (slot + 1U) % m_clientTableSize;
+    }
+    m_clientTable[slot] = info;
+}
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+bool TransportArbitrator::growClientTable(void)
+{
+    PendingClientInfo **oldTable = m_clientTable;
+    uint32_t oldSize = m_clientTableSize;
+    PendingClientInfo **table = NULL;
+    uint32_t i;
+
+    if (oldSize <= (UINT32_MAX / 2U / sizeof(PendingClientInfo *)))
+    {
+        table = reinterpret_cast<PendingClientInfo **>(erpc_malloc(2U * oldSize * sizeof(PendingClientInfo *)));
+    }
+
+    if (table != NULL)
+    {
+        m_clientTable = table;
+        m_clientTableSize = 2U * oldSize;
+        for (i = 0U; i < m_clientTableSize; ++i)
+        {
+            m_clientTable[i] = NULL;
+        }
+
+        // Slots depend on table size, insert clients again.
+        for (i = 0U; i < oldSize; ++i)
+        {
+            if (oldTable[i] != NULL)
+            {
+                insertPendingClient(oldTable[i]);
+            }
+        }
+
+        if (oldTable != m_clientTableStorage)
+        {
+            erpc_free(oldTable);
+        }
+    }
+
+    return (table != NULL);
+}
+#endif
+
 void TransportArbitrator::clientReceive(client_token_t token)
 {
     erpc_assert((token != 0U) && ("invalid client token" != NULL));
@@ -199,10 +299,32 @@ void TransportArbitrator::clientReceive(client_token_t token)
 TransportArbitrator::PendingClientInfo *TransportArbitrator::createPendingClient(void){ ERPC_CREATE_NEW_OBJECT(
     TransportArbitrator::PendingClientInfo, s_pendingClientInfoArray, ERPC_CLIENTS_THREADS_AMOUNT) }
 
-TransportArbitrator::PendingClientInfo *TransportArbitrator::addPendingClient(void)
+uint32_t TransportArbitrator::findPendingClient(uint32_t sequence)
 {
-    Mutex::Guard lock(m_clientListMutex);
+    uint32_t slot = getClientSlot(sequence);
+    uint32_t probes = 0U;
+    uint32_t found = m_clientTableSize;
 
+    // Clients are stored in a run of occupied slots starting at their sequence slot.
+    while ((found == m_clientTableSize) && (probes < m_clientTableSize) &&
+           (m_clientTable[slot] != NULL))
+    {
+        if (m_clientTable[slot]->m_isValid && (m_clientTable[slot]->m_sequence == sequence))
+        {
+            found = slot;
+        }
+        else
+        {
+            slot = (slot + 1U) % m_clientTableSize;
+            ++probes;
+        }
+    }
+
+    return found;
+}
+
+TransportArbitrator::PendingClientInfo *TransportArbitrator::addPendingClient(void)
+{
     // Get a free client info node, or allocate one.
     PendingClientInfo *info = NULL;
     if (m_clientFreeList == NULL)
@@ -217,9 +339,7 @@ TransportArbitrator::PendingClientInfo *TransportArbitrator::addPendingClient(vo
 
     if (info != NULL)
     {
-        // Add to active list.
-        info->m_next = m_clientList;
-        m_clientList = info;
+        info->m_next = NULL;
     }
 
     return info;
@@ -230,32 +350,49 @@ void TransportArbitrator::removePendingClient(client_token_t token)
     // Convert token to pointer to info struct.
     PendingClientInfo *info = reinterpret_cast<PendingClientInfo *>(token);
     Mutex::Guard lock(m_clientListMutex);
-    PendingClientInfo *node;
+    uint32_t slot;
+    uint32_t next;
+    uint32_t home;
+    bool shift;
 
     erpc_assert((token != 0U) && ("invalid client token" != NULL));
     erpc_assert((info->m_sem.getCount() == 0) && ("Semaphore should be clean" != NULL));
 
+    // Find the client in active table.
+    slot = getClientSlot(info->m_sequence);
+    while (m_clientTable[slot] != info)
+    {
+        slot = (slot + 1U) % m_clientTableSize;
+    }
+
     // Clear fields.
     info->m_request = NULL;
     info->m_isValid = false;
 
-    // Remove from active list.
-    if (m_clientList == info)
-    {
-        m_clientList = info->m_next;
-    }
-    else
+    // Remove from active table. Following clients of the probed run are moved back into the freed slot when their
+    // sequence slot is not between the freed slot and their current slot, so no tombstones are needed.
+    m_clientTable[slot] = NULL;
+    --m_clientCount;
+    next = (slot + 1U) % m_clientTableSize;
+    while (m_clientTable[next] != NULL)
     {
-        node = m_clientList;
-        while (node != NULL)
+        home = getClientSlot(m_clientTable[next]->m_sequence);
+        if (slot <= next)
         {
-            if (node->m_next == info)
-            {
-                node->m_next = info->m_next;
-                break;
-            }
-            node = node->m_next;
+            shift = ((home <= slot) || (home > next));
+        }
+        else
+        {
+            shift = ((home <= slot) && (home > next));
+        }
+
+        if (shift)
+        {
+            m_clientTable[slot] = m_clientTable[next];
+            m_clientTable[next] = NULL;
+            slot = next;
         }
+        next = (next + 1U) % m_clientTableSize;
     }
 
     // Add to free list.
@@ -277,7 +414,7 @@ void TransportArbitrator::freeClientList(PendingClientInfo *list)
 }
 
 TransportArbitrator::PendingClientInfo::PendingClientInfo(void) :
-m_request(NULL), m_sem(0), m_isValid(false), m_next(NULL)
+m_request(NULL), m_sem(0), m_isValid(false), m_sequence(0U), m_next(NULL)
 {
 }
 
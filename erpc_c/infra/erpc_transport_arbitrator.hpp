@@ -35,6 +35,11 @@ class Codec;
  * receive info structs as the maximum number of simultaneous client receive requests from different
  * threads.
  *
+ * Pending client receive requests are kept in an open addressed table indexed by sequence number, so
+ * matching a reply to its client does not depend on the number of waiting clients. The table starts with
+ * ERPC_PENDING_CLIENTS_TABLE_SIZE slots. With dynamic allocation it is doubled when it gets three quarters
+ * full, with static allocation it holds at most ERPC_PENDING_CLIENTS_TABLE_SIZE requests.
+ *
  * @ingroup infra_transport
  */
 class TransportArbitrator : public Transport
@@ -170,6 +175,7 @@ public:
         RequestContext *m_request; /*!< Client request context. */
         Semaphore m_sem;           /*!< Client semaphore. */
         bool m_isValid;            /*!< This struct validation. */
+        uint32_t m_sequence;       /*!< Sequence number of expected reply. */
         PendingClientInfo *m_next; /*!< Next client pending information. */
 
         /*!
@@ -187,9 +193,53 @@ protected:
     Transport *m_sharedTransport; //!< Transport being shared through this arbitrator.
     Codec *m_codec;               //!< Codec used to read incoming message headers.
 
-    PendingClientInfo *m_clientList;     //!< Active client receive requests.
+    PendingClientInfo *m_clientTableStorage[ERPC_PENDING_CLIENTS_TABLE_SIZE]; //!< Initial client table.
+    PendingClientInfo **m_clientTable;   //!< Active client receive requests, initial or grown table.
+    uint32_t m_clientTableSize;          //!< Number of slots of client table.
+    uint32_t m_clientCount;              //!< Number of active client receive requests.
     PendingClientInfo *m_clientFreeList; //!< Unused client receive info structs.
-    Mutex m_clientListMutex;             //!< Mutex guarding the client active and free lists.
+    Mutex m_clientListMutex;             //!< Mutex guarding the client active table and free list.
+
+    /*!
+     * @brief This function returns table slot where search for sequence number starts.
+     *
+     * @param[in] sequence Sequence number of reply.
+     *
+     * @return Index to client table.
+     */
+    uint32_t getClientSlot(uint32_t sequence) const { return sequence % m_clientTableSize; }
+
+    /*!
+     * @brief This function inserts active client receive request into client table.
+     *
+     * Client table mutex has to be locked and the table has to have a free slot.
+     *
+     * @param[in] info Client receive request.
+     */
+    void insertPendingClient(PendingClientInfo *info);
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    /*!
+     * @brief This function moves active client receive requests into table of double size.
+     *
+     * Client table mutex has to be locked.
+     *
+     * @retval true Table was grown.
+     * @retval false Memory for bigger table was not allocated, current table is kept.
+     */
+    bool growClientTable(void);
+#endif
+
+    /*!
+     * @brief This function finds active client receive request waiting for sequence number.
+     *
+     * Client table mutex has to be locked.
+     *
+     * @param[in] sequence Sequence number of reply.
+     *
+     * @return Index to client table or size of client table when not found.
+     */
+    uint32_t findPendingClient(uint32_t sequence);
 
     /*!
      * @brief Create a Pending Client object.
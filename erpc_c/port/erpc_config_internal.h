@@ -39,6 +39,17 @@
     #endif
 #endif
 
+// Determine if lock-free atomic operations on 32-bit values are available.
+#if !defined(ERPC_HAS_ATOMICS)
+    #if defined(__GCC_ATOMIC_INT_LOCK_FREE) && (__GCC_ATOMIC_INT_LOCK_FREE == 2)
+        #define ERPC_HAS_ATOMICS (1)
+    #elif defined(_MSC_VER)
+        #define ERPC_HAS_ATOMICS (1)
+    #else
+        #define ERPC_HAS_ATOMICS (0)
+    #endif
+#endif
+
 // Safely detect FreeRTOSConfig.h.
 #define ERPC_HAS_FREERTOSCONFIG_H (0)
 #if defined(__has_include)
@@ -80,6 +91,15 @@
     #endif
 #endif
 
+// Initial size of transport arbitrator table of clients waiting for reply, grown with dynamic allocation.
+#if !defined(ERPC_PENDING_CLIENTS_TABLE_SIZE)
+    #if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+        #define ERPC_PENDING_CLIENTS_TABLE_SIZE (2U * ERPC_CLIENTS_THREADS_AMOUNT)
+    #else
+        #define ERPC_PENDING_CLIENTS_TABLE_SIZE (64U)
+    #endif
+#endif
+
 // Safely detect tx_api.h.
 #define ERPC_HAS_THREADX_API_H (0)
 #if defined(__has_include)
@@ -123,6 +143,37 @@
     #define ERPC_DEFAULT_BUFFERS_COUNT (2U)
 #endif
 
+// Set default thread pool server limits.
+#if !defined(ERPC_THREAD_POOL_SERVER_MAX_WORKERS)
+    //! @brief Maximal count of worker threads of ThreadPoolServer.
+    #define ERPC_THREAD_POOL_SERVER_MAX_WORKERS (8U)
+#endif
+
+#if !defined(ERPC_THREAD_POOL_SERVER_QUEUE_SIZE)
+    //! @brief Count of received requests ThreadPoolServer can hold before workers pick them up.
+    #define ERPC_THREAD_POOL_SERVER_QUEUE_SIZE (8U)
+#endif
+
+// Set default inter thread transport queue.
+#if !defined(ERPC_INTER_THREAD_QUEUE_SIZE)
+    //! @brief Count of messages InterThreadBufferTransport can hold for receiver.
+    #define ERPC_INTER_THREAD_QUEUE_SIZE (8U)
+#endif
+
+#if !defined(ERPC_INTER_THREAD_SPIN_COUNT)
+    //! @brief Maximal spin iterations of InterThreadBufferTransport before blocking.
+    #if ERPC_THREADS_IS(PTHREADS) || ERPC_THREADS_IS(WIN32)
+        #define ERPC_INTER_THREAD_SPIN_COUNT (1024U)
+    #else
+        #define ERPC_INTER_THREAD_SPIN_COUNT (0U)
+    #endif
+#endif
+
+#if !defined(ERPC_COMPRESSING_TRANSPORT_HASH_BITS)
+    //! @brief Size of CompressingTransport hash table as power of two.
+    #define ERPC_COMPRESSING_TRANSPORT_HASH_BITS (10U)
+#endif
+
 // Disable/enable noexcept.
 #if !defined(ERPC_NOEXCEPT)
     #if ERPC_HAS_POSIX
@@ -157,6 +208,44 @@
     #endif
 #endif
 
+// Disabling asynchronous calls support as default.
+#if !defined(ERPC_ASYNC_CALLS)
+    #define ERPC_ASYNC_CALLS (ERPC_ASYNC_CALLS_DISABLED)
+#endif
+
+// Use table driven CRC16 as default, larger tables on POSIX systems.
+#if !defined(ERPC_CRC16_IMPLEMENTATION)
+    #if ERPC_HAS_POSIX
+        #define ERPC_CRC16_IMPLEMENTATION (ERPC_CRC16_IMPLEMENTATION_SLICING_BY_8)
+    #else
+        #define ERPC_CRC16_IMPLEMENTATION (ERPC_CRC16_IMPLEMENTATION_TABLE)
+    #endif
+#endif
+
+// Keeping 16-bit message sizes as default.
+#if !defined(ERPC_LARGE_MESSAGES)
+    #define ERPC_LARGE_MESSAGES (ERPC_LARGE_MESSAGES_DISABLED)
+#endif
+
+// Searching services in linked list as default.
+#if !defined(ERPC_SERVICE_DISPATCH_TABLE)
+    #define ERPC_SERVICE_DISPATCH_TABLE (ERPC_SERVICE_DISPATCH_TABLE_DISABLED)
+#endif
+
+// Read-ahead buffer size of stream transports.
+#if !defined(ERPC_TRANSPORT_READ_AHEAD_SIZE)
+    #define ERPC_TRANSPORT_READ_AHEAD_SIZE (1024U)
+#endif
+
+// Slots and spinning of shared memory transport.
+#if !defined(ERPC_TRANSPORT_SHM_SLOTS_COUNT)
+    #define ERPC_TRANSPORT_SHM_SLOTS_COUNT (8U)
+#endif
+
+#if !defined(ERPC_TRANSPORT_SHM_SPIN_COUNT)
+    #define ERPC_TRANSPORT_SHM_SPIN_COUNT (1024U)
+#endif
+
 // Disabling tracing the eRPC.
 #if !defined(ERPC_MESSAGE_LOGGING)
     #define ERPC_MESSAGE_LOGGING (ERPC_MESSAGE_LOGGING_DISABLED)
@@ -196,6 +285,48 @@
     #define ERPC_PRE_POST_ACTION_DEFAULT (ERPC_PRE_POST_ACTION_DEFAULT_DISABLED)
 #endif
 
+// Disabling call statistics.
+#if !defined(ERPC_STATS)
+    #define ERPC_STATS (ERPC_STATS_DISABLED)
+#endif
+
+// Set default number of methods recorded by call statistics.
+#if !defined(ERPC_STATS_METHODS_COUNT)
+    #define ERPC_STATS_METHODS_COUNT (16U)
+#endif
+
+// Set default ratio of calls with measured time.
+#if !defined(ERPC_STATS_SAMPLE_SHIFT)
+    #define ERPC_STATS_SAMPLE_SHIFT (4U)
+#endif
+
+// Disabling client request cache.
+#if !defined(ERPC_CLIENT_REQUEST_CACHE)
+    #define ERPC_CLIENT_REQUEST_CACHE (ERPC_CLIENT_REQUEST_CACHE_DISABLED)
+#endif
+
+// Set default number of threads with cached client request.
+#if !defined(ERPC_CLIENT_REQUEST_CACHE_SIZE)
+    #define ERPC_CLIENT_REQUEST_CACHE_SIZE (4U)
+#endif
+
+// Disabling server request arena.
+#if !defined(ERPC_SERVER_ARENA)
+    #define ERPC_SERVER_ARENA (ERPC_SERVER_ARENA_DISABLED)
+#endif
+
+// Set default server arena size as multiple of message length.
+#if !defined(ERPC_SERVER_ARENA_SIZE_FACTOR)
+    #define ERPC_SERVER_ARENA_SIZE_FACTOR (2U)
+#endif
+
+// Set default count of stream chunks sent before acknowledgement.
+#if !defined(ERPC_STREAM_WINDOW)
+    #define ERPC_STREAM_WINDOW (4U)
+#elif ERPC_STREAM_WINDOW == 0
+    #error "ERPC_STREAM_WINDOW shall be at least 1."
+#endif
+
 #if !defined(erpc_assert)
     #if ERPC_HAS_FREERTOSCONFIG_H
         #ifdef __cplusplus
@@ -303,6 +303,43 @@ int serial_read(int fd, char *buf, int size)
 #endif
 }
 
+int serial_read_available(int fd, char *buf, int minSize, int maxSize)
+{
+#ifdef _WIN32
+    (void)maxSize;
+    return serial_read(fd, buf, minSize);
+#else
+    int len = 0;
+    int ret;
+    int timeout = 0;
+
+    while (len < minSize)
+    {
+        ret = read(fd, buf + len, maxSize - len);
+        if (ret == -1)
+        {
+            return -1;
+        }
+
+        if (ret == 0)
+        {
+            timeout++;
+
+            if (timeout >= 10)
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        len += ret;
+    }
+
+    return len;
+#endif
+}
+
 int serial_open(const char *port)
 {
     int fd;
@@ -164,10 +164,8 @@ Semaphore::~Semaphore(void)
 void Semaphore::put(void)
 {
     Mutex::Guard guard(m_mutex);
-    if (m_count == 0)
-    {
-        pthread_cond_signal(&m_cond);
-    }
+    // Signal on every put, several threads may be waiting while count is already non-zero.
+    pthread_cond_signal(&m_cond);
     ++m_count;
 }
 
@@ -59,6 +59,26 @@
 #define ERPC_MESSAGE_LOGGING_ENABLED (1)  //!< Enabled message logging
 //@}
 
+//! @name CRC16 implementation constants
+//@{
+#define ERPC_CRC16_IMPLEMENTATION_BITWISE (0)      //!< CRC16 computed bit by bit, smallest code.
+#define ERPC_CRC16_IMPLEMENTATION_TABLE (1)        //!< CRC16 computed with 512 B lookup table.
+#define ERPC_CRC16_IMPLEMENTATION_SLICING_BY_8 (2) //!< CRC16 computed 8 bytes at once with 4 KB lookup tables.
+#define ERPC_CRC16_IMPLEMENTATION_PORT (3)         //!< CRC16 computed by erpc_crc16_port_compute() of the port.
+//@}
+
+//! @name Large messages constants
+//@{
+#define ERPC_LARGE_MESSAGES_DISABLED (0) //!< 16-bit message sizes
+#define ERPC_LARGE_MESSAGES_ENABLED (1)  //!< 32-bit message sizes
+//@}
+
+//! @name Service dispatch table constants
+//@{
+#define ERPC_SERVICE_DISPATCH_TABLE_DISABLED (0) //!< Services searched in list
+#define ERPC_SERVICE_DISPATCH_TABLE_ENABLED (1)  //!< Services indexed by ID
+//@}
+
 //! @name Transport MU MCMGR constants
 //@{
 #define ERPC_TRANSPORT_MU_USE_MCMGR_DISABLED (0) //!< Disabled MCMGR
@@ -71,6 +91,12 @@
 #define ERPC_PRE_POST_ACTION_ENABLED (1)          //!< Enabled pre/post callbacks
 #define ERPC_PRE_POST_ACTION_DEFAULT_DISABLED (0) //!< Disabled default callbacks
 #define ERPC_PRE_POST_ACTION_DEFAULT_ENABLED (1)  //!< Enabled default callbacks
+#define ERPC_STATS_DISABLED (0)                   //!< Disabled call statistics
+#define ERPC_STATS_ENABLED (1)                    //!< Enabled call statistics
+#define ERPC_CLIENT_REQUEST_CACHE_DISABLED (0)    //!< Disabled client request cache
+#define ERPC_CLIENT_REQUEST_CACHE_ENABLED (1)     //!< Enabled client request cache
+#define ERPC_SERVER_ARENA_DISABLED (0)            //!< Disabled server request arena
+#define ERPC_SERVER_ARENA_ENABLED (1)             //!< Enabled server request arena
 //@}
 
 // ============================================================================
@@ -181,6 +207,37 @@
 #define ERPC_MESSAGE_LOGGING (ERPC_MESSAGE_LOGGING_DISABLED)
 #endif
 
+//! @def ERPC_CRC16_IMPLEMENTATION
+//!
+//! Select how CRC16 of messages is computed.
+#if defined(CONFIG_ERPC_CRC16_IMPLEMENTATION_BITWISE)
+#define ERPC_CRC16_IMPLEMENTATION (ERPC_CRC16_IMPLEMENTATION_BITWISE)
+#elif defined(CONFIG_ERPC_CRC16_IMPLEMENTATION_SLICING_BY_8)
+#define ERPC_CRC16_IMPLEMENTATION (ERPC_CRC16_IMPLEMENTATION_SLICING_BY_8)
+#elif defined(CONFIG_ERPC_CRC16_IMPLEMENTATION_PORT)
+#define ERPC_CRC16_IMPLEMENTATION (ERPC_CRC16_IMPLEMENTATION_PORT)
+#else
+#define ERPC_CRC16_IMPLEMENTATION (ERPC_CRC16_IMPLEMENTATION_TABLE)
+#endif
+
+//! @def ERPC_LARGE_MESSAGES
+//!
+//! Use 32-bit message sizes in message buffers and framed transport header.
+#ifdef CONFIG_ERPC_LARGE_MESSAGES
+#define ERPC_LARGE_MESSAGES (ERPC_LARGE_MESSAGES_ENABLED)
+#else
+#define ERPC_LARGE_MESSAGES (ERPC_LARGE_MESSAGES_DISABLED)
+#endif
+
+//! @def ERPC_SERVICE_DISPATCH_TABLE
+//!
+//! Look up services in array indexed by service ID.
+#ifdef CONFIG_ERPC_SERVICE_DISPATCH_TABLE
+#define ERPC_SERVICE_DISPATCH_TABLE (ERPC_SERVICE_DISPATCH_TABLE_ENABLED)
+#else
+#define ERPC_SERVICE_DISPATCH_TABLE (ERPC_SERVICE_DISPATCH_TABLE_DISABLED)
+#endif
+
 // ============================================================================
 // Transport-specific Configuration
 // ============================================================================
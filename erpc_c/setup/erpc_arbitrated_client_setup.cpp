@@ -12,6 +12,7 @@
 
 #include "erpc_arbitrated_client_manager.hpp"
 #include "erpc_basic_codec.hpp"
+#include "erpc_compact_codec.hpp"
 #include "erpc_manually_constructed.hpp"
 #include "erpc_message_buffer.hpp"
 #include "erpc_transport_arbitrator.hpp"
@@ -40,8 +41,10 @@ __declspec(selectany)
 #endif
 
 ERPC_MANUALLY_CONSTRUCTED_STATIC(BasicCodecFactory, s_codecFactory);
+ERPC_MANUALLY_CONSTRUCTED_STATIC(CompactCodecFactory, s_compactCodecFactory);
 ERPC_MANUALLY_CONSTRUCTED_STATIC(TransportArbitrator, s_arbitrator);
 ERPC_MANUALLY_CONSTRUCTED_STATIC(BasicCodec, s_codec);
+ERPC_MANUALLY_CONSTRUCTED_STATIC(CompactCodec, s_compactCodec);
 ERPC_MANUALLY_CONSTRUCTED_STATIC(Crc16, s_crc16);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -174,6 +177,83 @@ void erpc_arbitrated_client_set_crc(erpc_client_t client, uint32_t crcStart)
     clientManager->getArbitrator()->getSharedTransport()->getCrc16()->setCrcStart(crcStart);
 }
 
+erpc_status_t erpc_arbitrated_client_set_codec(erpc_client_t client, erpc_codec_t codec)
+{
+    erpc_assert(client != NULL);
+
+    ArbitratedClientManager *clientManager = reinterpret_cast<ArbitratedClientManager *>(client);
+    TransportArbitrator *transportArbitrator = clientManager->getArbitrator();
+    CodecFactory *codecFactory;
+    Codec *arbitratorCodec;
+    erpc_status_t status = kErpcStatus_Success;
+
+#if ERPC_CLIENT_REQUEST_CACHE
+    // Cached codecs were created by the current codec factory.
+    clientManager->flushRequestCache();
+#endif
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (codec == kErpcCodec_Compact)
+    {
+        if (!s_compactCodecFactory.isUsed())
+        {
+            s_compactCodecFactory.construct();
+        }
+        codecFactory = s_compactCodecFactory.get();
+
+        if (!s_compactCodec.isUsed())
+        {
+            s_compactCodec.construct();
+        }
+        arbitratorCodec = s_compactCodec.get();
+    }
+    else
+    {
+        codecFactory = s_codecFactory.get();
+        arbitratorCodec = s_codec.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    if (codec == kErpcCodec_Compact)
+    {
+        codecFactory = new CompactCodecFactory();
+        arbitratorCodec = new CompactCodec();
+    }
+    else
+    {
+        codecFactory = new BasicCodecFactory();
+        arbitratorCodec = new BasicCodec();
+    }
+
+    if ((codecFactory == NULL) || (arbitratorCodec == NULL))
+    {
+        if (codecFactory != NULL)
+        {
+            delete codecFactory;
+        }
+        if (arbitratorCodec != NULL)
+        {
+            delete arbitratorCodec;
+        }
+        status = kErpcStatus_MemoryError;
+    }
+    else
+    {
+        delete clientManager->getCodecFactory();
+        delete transportArbitrator->getCodec();
+    }
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    if (status == kErpcStatus_Success)
+    {
+        clientManager->setCodecFactory(codecFactory);
+        transportArbitrator->setCodec(arbitratorCodec);
+    }
+
+    return status;
+}
+
 #if ERPC_NESTED_CALLS
 void erpc_arbitrated_client_set_server(erpc_client_t client, erpc_server_t server)
 {
@@ -227,12 +307,19 @@ void erpc_arbitrated_client_add_post_cb_action(erpc_client_t client, pre_post_ac
 
 void erpc_arbitrated_client_deinit(erpc_client_t client)
 {
+#if ERPC_CLIENT_REQUEST_CACHE
+    erpc_assert(client != NULL);
+    reinterpret_cast<ArbitratedClientManager *>(client)->flushRequestCache();
+#endif
+
 #if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
     (void)client;
     erpc_assert(reinterpret_cast<ArbitratedClientManager *>(client) == s_client.get());
     s_codecFactory.destroy();
+    s_compactCodecFactory.destroy();
     s_crc16.destroy();
     s_codec.destroy();
+    s_compactCodec.destroy();
     s_arbitrator.destroy();
     s_client.destroy();
 #elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
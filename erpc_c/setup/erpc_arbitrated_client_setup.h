@@ -91,6 +91,20 @@ void erpc_arbitrated_client_set_error_handler(erpc_client_t client, client_error
  */
 void erpc_arbitrated_client_set_crc(erpc_client_t client, uint32_t crcStart);
 
+/*!
+ * @brief This function selects message format of the client and of the arbitrator.
+ *
+ * Server sharing the arbitrator and the other side have to use the same format. Call it before the first eRPC call
+ * and before the server starts running.
+ *
+ * @param[in] client Pointer to client structure.
+ * @param[in] codec Message format, kErpcCodec_Basic is used by default.
+ *
+ * @retval #kErpcStatus_Success Format was selected.
+ * @retval #kErpcStatus_MemoryError Codec factory or codec could not be allocated.
+ */
+erpc_status_t erpc_arbitrated_client_set_codec(erpc_client_t client, erpc_codec_t codec);
+
 #if ERPC_NESTED_CALLS
 /*!
  * @brief This function sets server object for handling nested eRPC calls.
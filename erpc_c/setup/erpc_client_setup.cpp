@@ -12,6 +12,7 @@
 
 #include "erpc_basic_codec.hpp"
 #include "erpc_client_manager.h"
+#include "erpc_compact_codec.hpp"
 #include "erpc_crc16.hpp"
 #include "erpc_manually_constructed.hpp"
 #include "erpc_message_buffer.hpp"
@@ -37,6 +38,7 @@ __declspec(selectany)
 #pragma weak g_client
 #endif
 ERPC_MANUALLY_CONSTRUCTED_STATIC(BasicCodecFactory, s_codecFactory);
+ERPC_MANUALLY_CONSTRUCTED_STATIC(CompactCodecFactory, s_compactCodecFactory);
 ERPC_MANUALLY_CONSTRUCTED_STATIC(Crc16, s_crc16);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -133,6 +135,62 @@ void erpc_client_set_crc(erpc_client_t client, uint32_t crcStart)
     clientManager->getTransport()->getCrc16()->setCrcStart(crcStart);
 }
 
+erpc_status_t erpc_client_set_codec(erpc_client_t client, erpc_codec_t codec)
+{
+    erpc_assert(client != NULL);
+
+    ClientManager *clientManager = reinterpret_cast<ClientManager *>(client);
+    CodecFactory *codecFactory;
+    erpc_status_t status = kErpcStatus_Success;
+
+#if ERPC_CLIENT_REQUEST_CACHE
+    // Cached codecs were created by the current codec factory.
+    clientManager->flushRequestCache();
+#endif
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (codec == kErpcCodec_Compact)
+    {
+        if (!s_compactCodecFactory.isUsed())
+        {
+            s_compactCodecFactory.construct();
+        }
+        codecFactory = s_compactCodecFactory.get();
+    }
+    else
+    {
+        codecFactory = s_codecFactory.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    if (codec == kErpcCodec_Compact)
+    {
+        codecFactory = new CompactCodecFactory();
+    }
+    else
+    {
+        codecFactory = new BasicCodecFactory();
+    }
+
+    if (codecFactory == NULL)
+    {
+        status = kErpcStatus_MemoryError;
+    }
+    else
+    {
+        delete clientManager->getCodecFactory();
+    }
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    if (status == kErpcStatus_Success)
+    {
+        clientManager->setCodecFactory(codecFactory);
+    }
+
+    return status;
+}
+
 #if ERPC_NESTED_CALLS
 void erpc_client_set_server(erpc_client_t client, erpc_server_t server)
 {
@@ -184,12 +242,40 @@ void erpc_client_add_post_cb_action(erpc_client_t client, pre_post_action_cb pos
 }
 #endif
 
+#if ERPC_CLIENT_REQUEST_CACHE
+void erpc_client_release_thread_cache(erpc_client_t client)
+{
+    erpc_assert(client != NULL);
+
+    ClientManager *clientManager = reinterpret_cast<ClientManager *>(client);
+
+    clientManager->releaseThreadRequestCache();
+}
+#endif
+
+#if ERPC_STATS
+uint32_t erpc_client_get_stats(erpc_client_t client, erpc_call_stats_t *stats, uint32_t maxCount, bool reset)
+{
+    erpc_assert(client != NULL);
+
+    ClientManager *clientManager = reinterpret_cast<ClientManager *>(client);
+
+    return clientManager->getCallStats(stats, maxCount, reset);
+}
+#endif
+
 void erpc_client_deinit(erpc_client_t client)
 {
+#if ERPC_CLIENT_REQUEST_CACHE
+    erpc_assert(client != NULL);
+    reinterpret_cast<ClientManager *>(client)->flushRequestCache();
+#endif
+
 #if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
     (void)client;
     erpc_assert(reinterpret_cast<ClientManager *>(client) == s_client.get());
     s_codecFactory.destroy();
+    s_compactCodecFactory.destroy();
     s_crc16.destroy();
     s_client.destroy();
 #elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
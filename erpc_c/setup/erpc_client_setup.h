@@ -17,6 +17,9 @@
 #if ERPC_PRE_POST_ACTION
 #include "erpc_pre_post_action.h"
 #endif
+#if ERPC_STATS
+#include "erpc_call_stats.h"
+#endif
 #if ERPC_NESTED_CALLS
 #include "erpc_server_setup.h"
 #endif
@@ -77,6 +80,19 @@ void erpc_client_set_error_handler(erpc_client_t client, client_error_handler_t
  */
 void erpc_client_set_crc(erpc_client_t client, uint32_t crcStart);
 
+/*!
+ * @brief This function selects message format.
+ *
+ * Server has to use the same format. Call it before the first eRPC call.
+ *
+ * @param[in] client Pointer to client structure.
+ * @param[in] codec Message format, kErpcCodec_Basic is used by default.
+ *
+ * @retval #kErpcStatus_Success Format was selected.
+ * @retval #kErpcStatus_MemoryError Codec factory could not be allocated.
+ */
+erpc_status_t erpc_client_set_codec(erpc_client_t client, erpc_codec_t codec);
+
 #if ERPC_NESTED_CALLS
 /*!
  * @brief This function sets server object for handling nested eRPC calls.
@@ -128,6 +144,32 @@ void erpc_client_add_pre_cb_action(erpc_client_t client, pre_post_action_cb preC
 void erpc_client_add_post_cb_action(erpc_client_t client, pre_post_action_cb postCB);
 #endif
 
+#if ERPC_CLIENT_REQUEST_CACHE
+/*!
+ * @brief This function disposes codec and message buffer cached for the calling thread.
+ *
+ * Call it before a thread which performed eRPC calls exits, so its cache entry can be used by other threads.
+ * Works for clients created by erpc_client_init() and erpc_arbitrated_client_init().
+ *
+ * @param[in] client Pointer to client structure.
+ */
+void erpc_client_release_thread_cache(erpc_client_t client);
+#endif
+
+#if ERPC_STATS
+/*!
+ * @brief This function copies per method call statistics of client.
+ *
+ * @param[in] client Pointer to client structure.
+ * @param[out] stats Array for statistics of methods, can be NULL when maxCount is 0.
+ * @param[in] maxCount Size of stats array.
+ * @param[in] reset True to clear statistics after they are copied.
+ *
+ * @return Number of recorded methods, can be higher than maxCount.
+ */
+uint32_t erpc_client_get_stats(erpc_client_t client, erpc_call_stats_t *stats, uint32_t maxCount, bool reset);
+#endif
+
 /*!
  * @brief This function de-initializes client.
  *
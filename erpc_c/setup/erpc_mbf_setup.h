@@ -18,13 +18,6 @@
  * @file
  */
 
-////////////////////////////////////////////////////////////////////////////////
-// Types
-////////////////////////////////////////////////////////////////////////////////
-
-//! @brief Opaque MessageBufferFactory object type.
-typedef struct ErpcMessageBufferFactory *erpc_mbf_t;
-
 ////////////////////////////////////////////////////////////////////////////////
 // API
 ////////////////////////////////////////////////////////////////////////////////
@@ -62,6 +55,22 @@ erpc_mbf_t erpc_mbf_rpmsg_init(erpc_transport_t transport);
  */
 void erpc_mbf_rpmsg_deinit(erpc_mbf_t mbf);
 
+/*!
+ * @brief Create MessageBuffer factory which is using slots of shared memory transport.
+ *
+ * Has to be used with shared memory transport, messages are then sent without copy.
+ *
+ * @param[in] transport Shared memory transport.
+ */
+erpc_mbf_t erpc_mbf_shm_init(erpc_transport_t transport);
+
+/*!
+ * @brief Deinit MessageBuffer factory.
+ *
+ * @param[in] mbf MessageBuffer factory which was initialized in init function.
+ */
+void erpc_mbf_shm_deinit(erpc_mbf_t mbf);
+
 /*!
  * @brief Create IPC Service message buffer factory and return pointer to it.
  *
@@ -11,6 +11,7 @@
 #include "erpc_server_setup.h"
 
 #include "erpc_basic_codec.hpp"
+#include "erpc_compact_codec.hpp"
 #include "erpc_crc16.hpp"
 #include "erpc_manually_constructed.hpp"
 #include "erpc_message_buffer.hpp"
@@ -27,6 +28,9 @@ using namespace erpc;
 ERPC_MANUALLY_CONSTRUCTED_STATIC(SimpleServer, s_server);
 ERPC_MANUALLY_CONSTRUCTED_STATIC(BasicCodecFactory, s_codecFactory);
 ERPC_MANUALLY_CONSTRUCTED_STATIC(Crc16, s_crc16);
+// Codec factories have no state, so those selected by erpc_server_set_codec() are shared by all servers.
+ERPC_MANUALLY_CONSTRUCTED_STATIC(BasicCodecFactory, s_selectedBasicCodecFactory);
+ERPC_MANUALLY_CONSTRUCTED_STATIC(CompactCodecFactory, s_selectedCompactCodecFactory);
 
 ////////////////////////////////////////////////////////////////////////////////
 // Code
@@ -150,6 +154,61 @@ void erpc_server_set_crc(erpc_server_t server, uint32_t crcStart)
     simpleServer->getTransport()->getCrc16()->setCrcStart(crcStart);
 }
 
+erpc_status_t erpc_server_set_codec(erpc_server_t server, erpc_codec_t codec)
+{
+    erpc_assert(server != NULL);
+
+    SimpleServer *simpleServer = reinterpret_cast<SimpleServer *>(server);
+    CodecFactory *codecFactory;
+    erpc_status_t status = kErpcStatus_Success;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (codec == kErpcCodec_Compact)
+    {
+        if (!s_selectedCompactCodecFactory.isUsed())
+        {
+            s_selectedCompactCodecFactory.construct();
+        }
+        codecFactory = s_selectedCompactCodecFactory.get();
+    }
+    else
+    {
+        if (!s_selectedBasicCodecFactory.isUsed())
+        {
+            s_selectedBasicCodecFactory.construct();
+        }
+        codecFactory = s_selectedBasicCodecFactory.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    if (codec == kErpcCodec_Compact)
+    {
+        codecFactory = new CompactCodecFactory();
+    }
+    else
+    {
+        codecFactory = new BasicCodecFactory();
+    }
+
+    if (codecFactory == NULL)
+    {
+        status = kErpcStatus_MemoryError;
+    }
+    else
+    {
+        delete simpleServer->getCodecFactory();
+    }
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    if (status == kErpcStatus_Success)
+    {
+        simpleServer->setCodecFactory(codecFactory);
+    }
+
+    return status;
+}
+
 erpc_status_t erpc_server_run(erpc_server_t server)
 {
     erpc_assert(server != NULL);
@@ -207,3 +266,14 @@ void erpc_server_add_post_cb_action(erpc_server_t server, pre_post_action_cb pos
     simpleServer->addPostCB(postCB);
 }
 #endif
+
+#if ERPC_STATS
+uint32_t erpc_server_get_stats(erpc_server_t server, erpc_call_stats_t *stats, uint32_t maxCount, bool reset)
+{
+    erpc_assert(server != NULL);
+
+    SimpleServer *simpleServer = reinterpret_cast<SimpleServer *>(server);
+
+    return simpleServer->getCallStats(stats, maxCount, reset);
+}
+#endif
@@ -18,6 +18,9 @@
 #if ERPC_PRE_POST_ACTION
 #include "erpc_pre_post_action.h"
 #endif
+#if ERPC_STATS
+#include "erpc_call_stats.h"
+#endif
 
 /*!
  * @addtogroup server_setup
@@ -63,6 +66,38 @@ erpc_server_t erpc_server_init(erpc_transport_t transport, erpc_mbf_t message_bu
  */
 void erpc_server_deinit(erpc_server_t server);
 
+#if !ERPC_THREADS_IS(NONE)
+/*!
+ * @brief This function initializes server processing requests on a pool of worker threads.
+ *
+ * The thread calling erpc_server_run() receives requests, worker threads execute them and
+ * send replies. Service implementations must be thread safe. Other server functions
+ * (erpc_add_service_to_server(), erpc_server_run(), erpc_server_stop(), ...) are used the
+ * same way as with server created by erpc_server_init().
+ *
+ * Each request in flight holds one buffer of the message buffer factory. With static allocation policy
+ * requests in flight are limited by ERPC_DEFAULT_BUFFERS_COUNT and ERPC_CODEC_COUNT, set both to at
+ * least workerCount + 1 to let all workers run at once.
+ *
+ * @param[in] transport Initiated transport. Its send must be thread safe.
+ * @param[in] message_buffer_factory Initiated message buffer factory.
+ * @param[in] workerCount Count of worker threads, limited by ERPC_THREAD_POOL_SERVER_MAX_WORKERS.
+ *
+ * @return erpc_server_t Pointer to server structure.
+ */
+erpc_server_t erpc_server_thread_pool_init(erpc_transport_t transport, erpc_mbf_t message_buffer_factory,
+                                           uint32_t workerCount);
+
+/*!
+ * @brief This function de-initializes thread pool server.
+ *
+ * This function stops worker threads and de-initializes server and all components which it own.
+ *
+ * @param[in] server Pointer to server structure created by erpc_server_thread_pool_init().
+ */
+void erpc_server_thread_pool_deinit(erpc_server_t server);
+#endif
+
 /*!
  * @brief This function adds service to server.
  *
@@ -92,6 +127,20 @@ void erpc_remove_service_from_server(erpc_server_t server, void *service);
  * @param[in] crcStart Set start number for crc.
  */
 void erpc_server_set_crc(erpc_server_t server, uint32_t crcStart);
+
+/*!
+ * @brief This function selects message format.
+ *
+ * Works for servers of erpc_server_init() and erpc_server_thread_pool_init(). Clients have to use the same format.
+ * Call it before the server starts running.
+ *
+ * @param[in] server Pointer to server structure.
+ * @param[in] codec Message format, kErpcCodec_Basic is used by default.
+ *
+ * @retval #kErpcStatus_Success Format was selected.
+ * @retval #kErpcStatus_MemoryError Codec factory could not be allocated.
+ */
+erpc_status_t erpc_server_set_codec(erpc_server_t server, erpc_codec_t codec);
 //@}
 
 //! @name Server control
@@ -163,6 +212,20 @@ void erpc_server_add_pre_cb_action(erpc_server_t server, pre_post_action_cb preC
 void erpc_server_add_post_cb_action(erpc_server_t server, pre_post_action_cb postCB);
 #endif
 
+#if ERPC_STATS
+/*!
+ * @brief This function copies per method call statistics of server.
+ *
+ * @param[in] server Pointer to server structure.
+ * @param[out] stats Array for statistics of methods, can be NULL when maxCount is 0.
+ * @param[in] maxCount Size of stats array.
+ * @param[in] reset True to clear statistics after they are copied.
+ *
+ * @return Number of recorded methods, can be higher than maxCount.
+ */
+uint32_t erpc_server_get_stats(erpc_server_t server, erpc_call_stats_t *stats, uint32_t maxCount, bool reset);
+#endif
+
 //@}
 
 #ifdef __cplusplus
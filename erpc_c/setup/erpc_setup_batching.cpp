@@ -0,0 +1,168 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_batching_transport.hpp"
+#include "erpc_compact_codec.hpp"
+#include "erpc_manually_constructed.hpp"
+#include "erpc_mbf_setup.h"
+#include "erpc_transport_setup.h"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+ERPC_MANUALLY_CONSTRUCTED_STATIC(BatchingTransport, s_batchingTransport);
+ERPC_MANUALLY_CONSTRUCTED_STATIC(BasicCodec, s_batchingCodec);
+ERPC_MANUALLY_CONSTRUCTED_STATIC(CompactCodec, s_batchingCompactCodec);
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_transport_t erpc_transport_batching_init(erpc_transport_t transport, erpc_mbf_t message_buffer_factory,
+                                              uint32_t max_delay_us)
+{
+    erpc_assert(transport != NULL);
+    erpc_assert(message_buffer_factory != NULL);
+
+    erpc_transport_t batching;
+    BatchingTransport *batchingTransport;
+    BasicCodec *codec = NULL;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_batchingTransport.isUsed() || s_batchingCodec.isUsed())
+    {
+        batchingTransport = NULL;
+    }
+    else
+    {
+        s_batchingTransport.construct();
+        batchingTransport = s_batchingTransport.get();
+
+        // Create codec reading type of sent messages.
+        s_batchingCodec.construct();
+        codec = s_batchingCodec.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    batchingTransport = new BatchingTransport();
+
+    // Create codec reading type of sent messages.
+    codec = new BasicCodec();
+
+    if ((batchingTransport == NULL) || (codec == NULL))
+    {
+        if (batchingTransport != NULL)
+        {
+            delete batchingTransport;
+            batchingTransport = NULL;
+        }
+        if (codec != NULL)
+        {
+            delete codec;
+        }
+    }
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    batching = reinterpret_cast<erpc_transport_t>(batchingTransport);
+
+    if (batchingTransport != NULL)
+    {
+        batchingTransport->setCodec(codec);
+        if (batchingTransport->init(reinterpret_cast<Transport *>(transport),
+                                    reinterpret_cast<MessageBufferFactory *>(message_buffer_factory),
+                                    max_delay_us) != kErpcStatus_Success)
+        {
+            erpc_transport_batching_deinit(batching);
+            batching = NULL;
+        }
+    }
+
+    return batching;
+}
+
+erpc_status_t erpc_transport_batching_set_codec(erpc_transport_t transport, erpc_codec_t codec)
+{
+    erpc_assert(transport != NULL);
+
+    BatchingTransport *batchingTransport = reinterpret_cast<BatchingTransport *>(transport);
+    Codec *batchingCodec;
+    erpc_status_t status = kErpcStatus_Success;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (codec == kErpcCodec_Compact)
+    {
+        if (!s_batchingCompactCodec.isUsed())
+        {
+            s_batchingCompactCodec.construct();
+        }
+        batchingCodec = s_batchingCompactCodec.get();
+    }
+    else
+    {
+        batchingCodec = s_batchingCodec.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    if (codec == kErpcCodec_Compact)
+    {
+        batchingCodec = new CompactCodec();
+    }
+    else
+    {
+        batchingCodec = new BasicCodec();
+    }
+
+    if (batchingCodec == NULL)
+    {
+        status = kErpcStatus_MemoryError;
+    }
+    else
+    {
+        delete batchingTransport->getCodec();
+    }
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    if (status == kErpcStatus_Success)
+    {
+        batchingTransport->setCodec(batchingCodec);
+    }
+
+    return status;
+}
+
+erpc_status_t erpc_transport_batching_flush(erpc_transport_t transport)
+{
+    erpc_assert(transport != NULL);
+
+    BatchingTransport *batchingTransport = reinterpret_cast<BatchingTransport *>(transport);
+
+    return batchingTransport->flush();
+}
+
+void erpc_transport_batching_deinit(erpc_transport_t transport)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)transport;
+    s_batchingTransport.destroy();
+    s_batchingCodec.destroy();
+    s_batchingCompactCodec.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(transport != NULL);
+
+    BatchingTransport *batchingTransport = reinterpret_cast<BatchingTransport *>(transport);
+
+    delete batchingTransport->getCodec();
+    delete batchingTransport;
+#endif
+}
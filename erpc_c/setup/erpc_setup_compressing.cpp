@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_compressing_transport.hpp"
+#include "erpc_manually_constructed.hpp"
+#include "erpc_mbf_setup.h"
+#include "erpc_transport_setup.h"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+ERPC_MANUALLY_CONSTRUCTED_STATIC(CompressingTransport, s_compressingTransport);
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_transport_t erpc_transport_compressing_init(erpc_transport_t transport, erpc_mbf_t message_buffer_factory,
+                                                 uint32_t threshold)
+{
+    erpc_assert(transport != NULL);
+    erpc_assert(message_buffer_factory != NULL);
+
+    erpc_transport_t compressing;
+    CompressingTransport *compressingTransport;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_compressingTransport.isUsed())
+    {
+        compressingTransport = NULL;
+    }
+    else
+    {
+        s_compressingTransport.construct();
+        compressingTransport = s_compressingTransport.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    compressingTransport = new CompressingTransport();
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    compressing = reinterpret_cast<erpc_transport_t>(compressingTransport);
+
+    if (compressingTransport != NULL)
+    {
+        if (compressingTransport->init(reinterpret_cast<Transport *>(transport),
+                                       reinterpret_cast<MessageBufferFactory *>(message_buffer_factory),
+                                       threshold) != kErpcStatus_Success)
+        {
+            erpc_transport_compressing_deinit(compressing);
+            compressing = NULL;
+        }
+    }
+
+    return compressing;
+}
+
+void erpc_transport_compressing_deinit(erpc_transport_t transport)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)transport;
+    s_compressingTransport.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(transport != NULL);
+
+    CompressingTransport *compressingTransport = reinterpret_cast<CompressingTransport *>(transport);
+
+    delete compressingTransport;
+#endif
+}
@@ -19,6 +19,18 @@
 #include "erpc_threading.h"
 #endif
 
+// Free buffers list is updated by compare and swap when atomics are available, otherwise under semaphore.
+#if !ERPC_THREADS_IS(NONE) && ERPC_HAS_ATOMICS
+#define ERPC_MBF_STATIC_LOCK_FREE (1)
+#include <atomic>
+#else
+#define ERPC_MBF_STATIC_LOCK_FREE (0)
+#endif
+
+#if ERPC_DEFAULT_BUFFERS_COUNT >= 0xffff
+#error "ERPC_DEFAULT_BUFFERS_COUNT has to be lower than 65535!"
+#endif
+
 using namespace erpc;
 
 #define ERPC_BUFFER_SIZE_UINT64 ((ERPC_DEFAULT_BUFFER_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t))
@@ -29,6 +41,10 @@ using namespace erpc;
 
 /*!
  * @brief Static Message buffer factory
+ *
+ * Free buffers are kept in a list linked by buffer indexes, so create() and dispose() take constant time.
+ * The list head holds the index of the first free buffer in the low 16 bits and a modification counter
+ * in the high 16 bits, which prevents ABA problem of lock-free updates.
  */
 class StaticMessageBufferFactory : public MessageBufferFactory
 {
@@ -36,13 +52,19 @@ public:
     /*!
      * @brief Constructor.
      */
-    StaticMessageBufferFactory(void)
-#if !ERPC_THREADS_IS(NONE)
-    :
+    StaticMessageBufferFactory(void) :
+    m_freeHead(0U)
+#if !ERPC_MBF_STATIC_LOCK_FREE && !ERPC_THREADS_IS(NONE)
+    ,
     m_semaphore(1)
 #endif
     {
-        (void)memset(m_freeBufferBitmap, 0xff, sizeof(m_freeBufferBitmap));
+        uint16_t idx;
+
+        for (idx = 0U; idx < ERPC_DEFAULT_BUFFERS_COUNT; ++idx)
+        {
+            m_nextFree[idx] = (idx + 1U < ERPC_DEFAULT_BUFFERS_COUNT) ? (uint16_t)(idx + 1U) : kNoBuffer;
+        }
         (void)memset(m_buffers, 0, sizeof(m_buffers));
     }
 
@@ -54,31 +76,52 @@ public:
     /*!
      * @brief This function creates new message buffer.
      *
-     * @return MessageBuffer New created MessageBuffer.
+     * @return MessageBuffer New created MessageBuffer. Buffer is NULL when all buffers are used.
      */
     virtual MessageBuffer create(void)
     {
-        uint8_t idx = 0;
+        MessageBuffer buffer;
+        uint32_t head;
+        uint16_t idx;
+#if ERPC_MBF_STATIC_LOCK_FREE
+        bool done = false;
+
+        head = m_freeHead.load(std::memory_order_acquire);
+        while (!done)
+        {
+            idx = (uint16_t)(head & kIndexMask);
+            if (idx == kNoBuffer)
+            {
+                done = true;
+            }
+            else
+            {
+                done = m_freeHead.compare_exchange_weak(
+                    head, nextHead(head, m_nextFree[idx].load(std::memory_order_relaxed)), std::memory_order_acquire,
+                    std::memory_order_acquire);
+            }
+        }
+#else
 #if !ERPC_THREADS_IS(NONE)
         m_semaphore.get();
 #endif
-        while (((m_freeBufferBitmap[idx >> 3U] & (1U << (idx & 0x7U))) == 0U) && (idx < ERPC_DEFAULT_BUFFERS_COUNT))
+        head = m_freeHead;
+        idx = (uint16_t)(head & kIndexMask);
+        if (idx != kNoBuffer)
         {
-            idx++;
+            m_freeHead = nextHead(head, m_nextFree[idx]);
         }
-
-        erpc_assert(idx < ERPC_DEFAULT_BUFFERS_COUNT);
-
-        m_freeBufferBitmap[idx >> 3U] &= ~(1U << (idx & 0x7U));
 #if !ERPC_THREADS_IS(NONE)
         m_semaphore.put();
+#endif
 #endif
 
-        uint8_t *buf;
-        buf = reinterpret_cast<uint8_t *>(m_buffers[idx]);
+        if (idx != kNoBuffer)
+        {
+            buffer.set(reinterpret_cast<uint8_t *>(m_buffers[idx]), ERPC_DEFAULT_BUFFER_SIZE);
+        }
 
-        erpc_assert(NULL != buf);
-        return MessageBuffer(buf, ERPC_DEFAULT_BUFFER_SIZE);
+        return buffer;
     }
 
     /*!
@@ -89,34 +132,60 @@ public:
     virtual void dispose(MessageBuffer *buf)
     {
         erpc_assert(buf != NULL);
-        uint8_t *tmp = buf->get();
-        if (tmp != NULL)
+        uintptr_t offset = (uintptr_t)buf->get() - (uintptr_t)m_buffers;
+        uint32_t head;
+        uint16_t idx;
+
+        // Buffers not owned by this factory, including NULL, are ignored.
+        if ((offset < sizeof(m_buffers)) && ((offset % sizeof(m_buffers[0])) == 0U))
         {
-            uint8_t idx = 0;
+            idx = (uint16_t)(offset / sizeof(m_buffers[0]));
+#if ERPC_MBF_STATIC_LOCK_FREE
+            head = m_freeHead.load(std::memory_order_relaxed);
+            do
+            {
+                m_nextFree[idx].store((uint16_t)(head & kIndexMask), std::memory_order_relaxed);
+            } while (!m_freeHead.compare_exchange_weak(head, nextHead(head, idx), std::memory_order_release,
+                                                       std::memory_order_relaxed));
+#else
 #if !ERPC_THREADS_IS(NONE)
             m_semaphore.get();
 #endif
-            while ((idx < ERPC_DEFAULT_BUFFERS_COUNT) && (tmp != reinterpret_cast<uint8_t *>(m_buffers[idx])))
-            {
-                idx++;
-            }
-            if (idx < ERPC_DEFAULT_BUFFERS_COUNT)
-            {
-                m_freeBufferBitmap[idx >> 3U] |= 1U << (idx & 0x7U);
-            }
+            head = m_freeHead;
+            m_nextFree[idx] = (uint16_t)(head & kIndexMask);
+            m_freeHead = nextHead(head, idx);
 #if !ERPC_THREADS_IS(NONE)
             m_semaphore.put();
+#endif
 #endif
         }
     }
 
 protected:
-    //! Bitmap representing which buffers are in use. A bit value of 1 means free and 0 means in
-    //! use.
-    uint8_t m_freeBufferBitmap[(ERPC_DEFAULT_BUFFERS_COUNT >> 3U) + (ERPC_DEFAULT_BUFFERS_COUNT % 8 ? 1U : 0U)];
+    static const uint16_t kNoBuffer = 0xffffU;       //!< Index marking end of free buffers list.
+    static const uint32_t kIndexMask = 0xffffU;      //!< Mask of buffer index in list head.
+    static const uint32_t kCounterStep = 1UL << 16U; //!< Increment of modification counter in list head.
+
+    /*!
+     * @brief Returns list head pointing to given index with increased modification counter.
+     *
+     * @param[in] head Current list head.
+     * @param[in] idx Index of new first free buffer.
+     *
+     * @return New list head.
+     */
+    static uint32_t nextHead(uint32_t head, uint16_t idx) { return ((head & ~kIndexMask) + kCounterStep) | idx; }
+
+#if ERPC_MBF_STATIC_LOCK_FREE
+    std::atomic<uint32_t> m_freeHead;                             //!< First free buffer index and modification counter.
+    std::atomic<uint16_t> m_nextFree[ERPC_DEFAULT_BUFFERS_COUNT]; //!< Index of next free buffer for each free buffer.
+#else
+    uint32_t m_freeHead;                             //!< First free buffer index and modification counter.
+    uint16_t m_nextFree[ERPC_DEFAULT_BUFFERS_COUNT]; //!< Index of next free buffer for each free buffer.
+#endif
     //! Static buffers
     uint64_t m_buffers[ERPC_DEFAULT_BUFFERS_COUNT][ERPC_BUFFER_SIZE_UINT64];
-#if !ERPC_THREADS_IS(NONE)
+#if !ERPC_MBF_STATIC_LOCK_FREE && !ERPC_THREADS_IS(NONE)
     Semaphore m_semaphore; /*!< Semaphore.*/
 #endif
 };
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_manually_constructed.hpp"
+#include "erpc_mbf_setup.h"
+#include "erpc_shm_transport.hpp"
+#include "erpc_transport_setup.h"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+ERPC_MANUALLY_CONSTRUCTED_STATIC(ShmTransport, s_shmTransport);
+ERPC_MANUALLY_CONSTRUCTED_STATIC(ShmMessageBufferFactory, s_shmMsgFactory);
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_transport_t erpc_transport_shm_init(const char *name, bool isServer)
+{
+    erpc_transport_t transport;
+    ShmTransport *shmTransport;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_shmTransport.isUsed())
+    {
+        shmTransport = NULL;
+    }
+    else
+    {
+        s_shmTransport.construct();
+        shmTransport = s_shmTransport.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    shmTransport = new ShmTransport();
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    transport = reinterpret_cast<erpc_transport_t>(shmTransport);
+
+    if (shmTransport != NULL)
+    {
+        if (shmTransport->open(name, isServer) != kErpcStatus_Success)
+        {
+            erpc_transport_shm_deinit(transport);
+            transport = NULL;
+        }
+    }
+
+    return transport;
+}
+
+void erpc_transport_shm_close(erpc_transport_t transport)
+{
+    erpc_assert(transport != NULL);
+
+    ShmTransport *shmTransport = reinterpret_cast<ShmTransport *>(transport);
+
+    shmTransport->close();
+}
+
+void erpc_transport_shm_deinit(erpc_transport_t transport)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)transport;
+    s_shmTransport.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(transport != NULL);
+
+    ShmTransport *shmTransport = reinterpret_cast<ShmTransport *>(transport);
+
+    delete shmTransport;
+#endif
+}
+
+erpc_mbf_t erpc_mbf_shm_init(erpc_transport_t transport)
+{
+    ShmMessageBufferFactory *msgFactory;
+
+    erpc_assert(transport != NULL);
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_shmMsgFactory.isUsed())
+    {
+        msgFactory = NULL;
+    }
+    else
+    {
+        s_shmMsgFactory.construct(reinterpret_cast<ShmTransport *>(transport));
+        msgFactory = s_shmMsgFactory.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    msgFactory = new ShmMessageBufferFactory(reinterpret_cast<ShmTransport *>(transport));
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    return reinterpret_cast<erpc_mbf_t>(msgFactory);
+}
+
+void erpc_mbf_shm_deinit(erpc_mbf_t mbf)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)mbf;
+    s_shmMsgFactory.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(mbf != NULL);
+
+    ShmMessageBufferFactory *msgFactory = reinterpret_cast<ShmMessageBufferFactory *>(mbf);
+
+    delete msgFactory;
+#endif
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_manually_constructed.hpp"
+#include "erpc_tcp_epoll_server_transport.hpp"
+#include "erpc_transport_setup.h"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+ERPC_MANUALLY_CONSTRUCTED_STATIC(TCPEpollServerTransport, s_tcpEpollServerTransport);
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_transport_t erpc_transport_tcp_epoll_server_init(const char *host, uint16_t port, uint32_t maxConnections)
+{
+    erpc_transport_t transport;
+    TCPEpollServerTransport *tcpTransport;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_tcpEpollServerTransport.isUsed())
+    {
+        tcpTransport = NULL;
+    }
+    else
+    {
+        s_tcpEpollServerTransport.construct(host, port, maxConnections);
+        tcpTransport = s_tcpEpollServerTransport.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    tcpTransport = new TCPEpollServerTransport(host, port, maxConnections);
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    transport = reinterpret_cast<erpc_transport_t>(tcpTransport);
+
+    if (tcpTransport != NULL)
+    {
+        if (tcpTransport->open() != kErpcStatus_Success)
+        {
+            erpc_transport_tcp_epoll_server_deinit(transport);
+            transport = NULL;
+        }
+    }
+
+    return transport;
+}
+
+void erpc_transport_tcp_epoll_server_close(erpc_transport_t transport)
+{
+    erpc_assert(transport != NULL);
+
+    TCPEpollServerTransport *tcpTransport = reinterpret_cast<TCPEpollServerTransport *>(transport);
+
+    (void)tcpTransport->close();
+}
+
+void erpc_transport_tcp_epoll_server_deinit(erpc_transport_t transport)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)transport;
+    s_tcpEpollServerTransport.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(transport != NULL);
+
+    TCPEpollServerTransport *tcpTransport = reinterpret_cast<TCPEpollServerTransport *>(transport);
+
+    delete tcpTransport;
+#endif
+}
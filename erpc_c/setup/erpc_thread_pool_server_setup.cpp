@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_server_setup.h"
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_crc16.hpp"
+#include "erpc_manually_constructed.hpp"
+#include "erpc_message_buffer.hpp"
+#include "erpc_thread_pool_server.hpp"
+#include "erpc_transport.hpp"
+
+#if ERPC_THREADS_IS(NONE)
+#error "Thread pool server does not work in no-threading configuration."
+#endif
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// global thread pool server variables
+ERPC_MANUALLY_CONSTRUCTED_STATIC(ThreadPoolServer, s_threadPoolServer);
+ERPC_MANUALLY_CONSTRUCTED_STATIC(BasicCodecFactory, s_threadPoolCodecFactory);
+ERPC_MANUALLY_CONSTRUCTED_STATIC(Crc16, s_threadPoolCrc16);
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_server_t erpc_server_thread_pool_init(erpc_transport_t transport, erpc_mbf_t message_buffer_factory,
+                                           uint32_t workerCount)
+{
+    erpc_assert(transport != NULL);
+    erpc_assert(message_buffer_factory != NULL);
+
+    Transport *castedTransport;
+    BasicCodecFactory *codecFactory;
+    Crc16 *crc16;
+    ThreadPoolServer *threadPoolServer;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_threadPoolCodecFactory.isUsed() || s_threadPoolCrc16.isUsed() || s_threadPoolServer.isUsed())
+    {
+        threadPoolServer = NULL;
+    }
+    else
+    {
+        // Init factories.
+        s_threadPoolCodecFactory.construct();
+        codecFactory = s_threadPoolCodecFactory.get();
+
+        s_threadPoolCrc16.construct();
+        crc16 = s_threadPoolCrc16.get();
+
+        // Init the server.
+        s_threadPoolServer.construct(workerCount);
+        threadPoolServer = s_threadPoolServer.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    // Init factories.
+    codecFactory = new BasicCodecFactory();
+
+    crc16 = new Crc16();
+
+    // Init the server.
+    threadPoolServer = new ThreadPoolServer(workerCount);
+
+    if ((codecFactory == NULL) || (crc16 == NULL) || (threadPoolServer == NULL))
+    {
+        if (codecFactory != NULL)
+        {
+            delete codecFactory;
+        }
+        if (crc16 != NULL)
+        {
+            delete crc16;
+        }
+        if (threadPoolServer != NULL)
+        {
+            delete threadPoolServer;
+        }
+        threadPoolServer = NULL;
+    }
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    if (threadPoolServer != NULL)
+    {
+        // Init server with the provided transport.
+        castedTransport = reinterpret_cast<Transport *>(transport);
+        castedTransport->setCrc16(crc16);
+        threadPoolServer->setTransport(castedTransport);
+        threadPoolServer->setCodecFactory(codecFactory);
+        threadPoolServer->setMessageBufferFactory(reinterpret_cast<MessageBufferFactory *>(message_buffer_factory));
+    }
+
+    // Other server functions use SimpleServer interface, so pass pointer to that base.
+    return reinterpret_cast<erpc_server_t>(static_cast<SimpleServer *>(threadPoolServer));
+}
+
+void erpc_server_thread_pool_deinit(erpc_server_t server)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)server;
+    erpc_assert(reinterpret_cast<SimpleServer *>(server) == s_threadPoolServer.get());
+    s_threadPoolServer.destroy();
+    s_threadPoolCrc16.destroy();
+    s_threadPoolCodecFactory.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(server != NULL);
+    ThreadPoolServer *threadPoolServer = static_cast<ThreadPoolServer *>(reinterpret_cast<SimpleServer *>(server));
+    CodecFactory *codecFactory = threadPoolServer->getCodecFactory();
+    Crc16 *crc16 = threadPoolServer->getTransport()->getCrc16();
+
+    // Server is deleted first, because its destructor waits for worker threads using codecs.
+    delete threadPoolServer;
+    delete codecFactory;
+    delete crc16;
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+}
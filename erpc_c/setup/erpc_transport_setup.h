@@ -10,6 +10,8 @@
 #ifndef _ERPC_TRANSPORT_SETUP_H_
 #define _ERPC_TRANSPORT_SETUP_H_
 
+#include "erpc_common.h"
+
 /*!
  * @addtogroup transport_setup
  * @{
@@ -22,6 +24,8 @@
 
 //! @brief Opaque transport object type.
 typedef struct ErpcTransport *erpc_transport_t;
+//! @brief Opaque MessageBufferFactory object type.
+typedef struct ErpcMessageBufferFactory *erpc_mbf_t;
 //! @brief Ready callback object type for RPMsg-Lite transport.
 typedef void (*rpmsg_ready_cb)(void);
 
@@ -483,6 +487,73 @@ void erpc_transport_tcp_close(erpc_transport_t transport);
  */
 void erpc_transport_tcp_deinit(erpc_transport_t transport);
 
+/*!
+ * @brief Create and open multi-connection TCP server transport (Linux only).
+ *
+ * Create a TCP listen socket. All accepted connections are served through one epoll
+ * instance by the thread which runs the server. Replies are routed back to the connection
+ * from which the request was received.
+ *
+ * @param[in] host hostname/IP address to listen on, NULL for any address
+ * @param[in] port port to listen on
+ * @param[in] maxConnections maximal amount of simultaneously served connections
+ *
+ * @return Return NULL or erpc_transport_t instance pointer.
+ */
+erpc_transport_t erpc_transport_tcp_epoll_server_init(const char *host, uint16_t port, uint32_t maxConnections);
+
+/*!
+ * @brief Close multi-connection TCP server transport.
+ *
+ * Stop listening and close all connections. Server blocked in receive is woken up.
+ *
+ * @param[in] transport Transport which was returned from init function.
+ */
+void erpc_transport_tcp_epoll_server_close(erpc_transport_t transport);
+
+/*!
+ * @brief Deinitialize multi-connection TCP server transport.
+ *
+ * @param[in] transport Transport which was initialized with init function.
+ */
+void erpc_transport_tcp_epoll_server_deinit(erpc_transport_t transport);
+
+//@}
+
+//! @name Shared memory transport setup
+//@{
+
+/*!
+ * @brief Create shared memory transport between two processes of one Linux host.
+ *
+ * Server creates the shared memory object, client maps the one created by server. Use factory
+ * from erpc_mbf_shm_init() so that messages are written in place into shared memory.
+ *
+ * @param[in] name Name of POSIX shared memory object, for example "/erpc". Has to live as long as transport.
+ * @param[in] isServer true if we are a server
+ *
+ * @return Return NULL or erpc_transport_t instance pointer.
+ */
+erpc_transport_t erpc_transport_shm_init(const char *name, bool isServer);
+
+/*!
+ * @brief Close shared memory transport.
+ *
+ * Threads of both processes waiting for a message fail with connection closed.
+ *
+ * @param[in] transport Transport which was returned from init function.
+ */
+void erpc_transport_shm_close(erpc_transport_t transport);
+
+/*!
+ * @brief Deinitialize shared memory transport.
+ *
+ * Server also removes the shared memory object.
+ *
+ * @param[in] transport Transport which was initialized with init function.
+ */
+void erpc_transport_shm_deinit(erpc_transport_t transport);
+
 //@}
 
 //! @name CMSIS UART transport setup
@@ -649,6 +720,89 @@ void erpc_transport_usb_cdc_deinit(erpc_transport_t transport);
 
 //@}
 
+//! @name Batching transport setup
+//@{
+
+/*!
+ * @brief Create batching transport wrapping another transport.
+ *
+ * Oneway messages are queued and sent together with other messages in one unit of the wrapped
+ * transport. Queued messages are sent when the batch is full, when max_delay_us elapses after the
+ * first queued message, on erpc_transport_batching_flush() call, or before the next invocation or
+ * reply message. Both sides of the communication have to use the batching transport. Type of
+ * sent messages is read in basic codec format, see erpc_transport_batching_set_codec().
+ *
+ * @param[in] transport Wrapped transport, e.g. TCP or serial transport.
+ * @param[in] message_buffer_factory Message buffer factory. Two more buffers are used for batches.
+ * @param[in] max_delay_us Maximal time in [us] for which a oneway message is queued, 0 to send
+ * only when batch is full or flushed. Non zero value needs threading support.
+ *
+ * @return Return NULL or erpc_transport_t instance pointer.
+ */
+erpc_transport_t erpc_transport_batching_init(erpc_transport_t transport, erpc_mbf_t message_buffer_factory,
+                                              uint32_t max_delay_us);
+
+/*!
+ * @brief This function selects message format read by batching transport.
+ *
+ * Clients and servers using the transport have to use the same format. Call it before the first message is sent.
+ *
+ * @param[in] transport Transport which was returned from init function.
+ * @param[in] codec Message format, kErpcCodec_Basic is used by default.
+ *
+ * @retval #kErpcStatus_Success Format was selected.
+ * @retval #kErpcStatus_MemoryError Codec could not be allocated.
+ */
+erpc_status_t erpc_transport_batching_set_codec(erpc_transport_t transport, erpc_codec_t codec);
+
+/*!
+ * @brief Send all queued messages of batching transport.
+ *
+ * @param[in] transport Transport which was returned from init function.
+ *
+ * @return Return one of status from erpc_common.h
+ */
+erpc_status_t erpc_transport_batching_flush(erpc_transport_t transport);
+
+/*!
+ * @brief Deinitialize batching transport.
+ *
+ * Queued messages are not sent, call erpc_transport_batching_flush() before.
+ *
+ * @param[in] transport Transport which was initialized with init function.
+ */
+void erpc_transport_batching_deinit(erpc_transport_t transport);
+
+//@}
+
+//! @name Compressing transport setup
+//@{
+
+/*!
+ * @brief Create compressing transport wrapping another transport.
+ *
+ * Messages with at least threshold bytes of data are compressed by a small LZ compressor when
+ * they shrink, a flags byte in front of each message tells the receiver. Both sides of the
+ * communication have to use the compressing transport.
+ *
+ * @param[in] transport Wrapped transport, e.g. TCP or serial transport.
+ * @param[in] message_buffer_factory Message buffer factory. Two more buffers are used for compressed data.
+ * @param[in] threshold Minimal size of message data in bytes to try compression.
+ *
+ * @return Return NULL or erpc_transport_t instance pointer.
+ */
+erpc_transport_t erpc_transport_compressing_init(erpc_transport_t transport, erpc_mbf_t message_buffer_factory,
+                                                 uint32_t threshold);
+
+/*!
+ * @brief Deinitialize compressing transport.
+ *
+ * @param[in] transport Transport which was initialized with init function.
+ */
+void erpc_transport_compressing_deinit(erpc_transport_t transport);
+
+//@}
+
 #ifdef __cplusplus
 }
 #endif
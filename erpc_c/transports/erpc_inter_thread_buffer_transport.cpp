@@ -12,63 +12,278 @@
 
 using namespace erpc;
 
+#define ERPC_INTER_THREAD_QUEUE_MASK (ERPC_INTER_THREAD_QUEUE_SIZE - 1U)
+
 ////////////////////////////////////////////////////////////////////////////////
 // Code
 ////////////////////////////////////////////////////////////////////////////////
 
-InterThreadBufferTransport::~InterThreadBufferTransport(void) {}
+#if ERPC_HAS_ATOMICS
+/*!
+ * @brief Hint to the processor that the thread is spinning.
+ */
+static inline void spinPause(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#elif defined(__GNUC__) && (defined(__aarch64__) || defined(__arm__))
+    __asm__ __volatile__("yield");
+#endif
+}
+#endif
+
+InterThreadBufferTransport::Waiters::Waiters(int count) :
+#if ERPC_HAS_ATOMICS
+m_count(0), m_spinLimit(ERPC_INTER_THREAD_SPIN_COUNT), m_semaphore(0)
+{
+    (void)count;
+}
+#else
+m_semaphore(count)
+{
+}
+#endif
+
+InterThreadBufferTransport::InterThreadBufferTransport(void) :
+Transport(), m_peer(NULL), m_messageFactory(NULL), m_head(0), m_tail(0), m_receivers(0),
+m_senders(ERPC_INTER_THREAD_QUEUE_SIZE)
+{
+#if ERPC_HAS_ATOMICS
+    uint32_t i;
+
+    for (i = 0; i < ERPC_INTER_THREAD_QUEUE_SIZE; ++i)
+    {
+        m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+    }
+#endif
+}
+
+InterThreadBufferTransport::~InterThreadBufferTransport(void)
+{
+    uint32_t i;
+
+    // Dispose of messages nobody received and of spare buffers.
+    if (m_messageFactory != NULL)
+    {
+        for (i = 0; i < ERPC_INTER_THREAD_QUEUE_SIZE; ++i)
+        {
+            m_messageFactory->dispose(&m_slots[i].m_buffer);
+        }
+    }
+}
 
 void InterThreadBufferTransport::linkWithPeer(InterThreadBufferTransport *peer)
 {
     m_peer = peer;
     peer->m_peer = this;
+}
 
-    if (!m_state)
+erpc_status_t InterThreadBufferTransport::receive(MessageBuffer *message)
+{
+    erpc_assert(m_peer != NULL);
+
+    transfer(message, false);
+
+    return kErpcStatus_Success;
+}
+
+erpc_status_t InterThreadBufferTransport::send(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+
+    erpc_assert(m_peer != NULL);
+
+    // Sender gets back buffers of the peer, so both sides have to create and dispose them by one factory.
+    if ((m_messageFactory == NULL) || (m_messageFactory != m_peer->m_messageFactory))
+    {
+        status = kErpcStatus_SendFailed;
+    }
+    else
     {
-        if (peer->m_state == NULL)
+        m_peer->transfer(message, true);
+
+        // Caller keeps a buffer to reuse or dispose.
+        if (message->get() == NULL)
         {
-            m_state = new SharedState;
-            peer->m_state = m_state;
+            MessageBuffer buffer(m_messageFactory->create());
+            message->swap(&buffer);
+        }
+    }
+
+    return status;
+}
+
+bool InterThreadBufferTransport::hasMessage(void)
+{
+#if ERPC_HAS_ATOMICS
+    uint32_t head = m_head.load(std::memory_order_relaxed);
+
+    return (m_slots[head & ERPC_INTER_THREAD_QUEUE_MASK].m_sequence.load(std::memory_order_acquire) == (head + 1U));
+#else
+    Mutex::Guard lock(m_mutex);
+
+    return (m_head != m_tail);
+#endif
+}
+
+#if ERPC_HAS_ATOMICS
+bool InterThreadBufferTransport::tryPush(MessageBuffer *message)
+{
+    bool pushed = false;
+    bool full = false;
+    uint32_t pos = m_tail.load(std::memory_order_relaxed);
+    Slot *slot;
+    int32_t diff;
+
+    while (!pushed && !full)
+    {
+        slot = &m_slots[pos & ERPC_INTER_THREAD_QUEUE_MASK];
+        diff = (int32_t)(slot->m_sequence.load(std::memory_order_acquire) - pos);
+        if (diff == 0)
+        {
+            // Slot is free for this position, claim it. On failure pos is updated to current tail.
+            if (m_tail.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed))
+            {
+                slot->m_buffer.swap(message);
+                slot->m_sequence.store(pos + 1U, std::memory_order_release);
+                pushed = true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Slot still holds message of previous round.
+            full = true;
         }
         else
         {
-            m_state = peer->m_state;
+            // Other sender claimed the slot.
+            pos = m_tail.load(std::memory_order_relaxed);
         }
     }
+
+    return pushed;
 }
 
-erpc_status_t InterThreadBufferTransport::receive(MessageBuffer *message)
+bool InterThreadBufferTransport::tryPop(MessageBuffer *message)
 {
-    erpc_assert(m_state && m_peer);
+    bool popped = false;
+    bool empty = false;
+    uint32_t pos = m_head.load(std::memory_order_relaxed);
+    Slot *slot;
+    int32_t diff;
 
-    m_inSem.get();
+    while (!popped && !empty)
+    {
+        slot = &m_slots[pos & ERPC_INTER_THREAD_QUEUE_MASK];
+        diff = (int32_t)(slot->m_sequence.load(std::memory_order_acquire) - (pos + 1U));
+        if (diff == 0)
+        {
+            // Slot holds message for this position, claim it. On failure pos is updated to current head.
+            if (m_head.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed))
+            {
+                slot->m_buffer.swap(message);
+                slot->m_sequence.store(pos + ERPC_INTER_THREAD_QUEUE_SIZE, std::memory_order_release);
+                popped = true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Slot was not filled yet.
+            empty = true;
+        }
+        else
+        {
+            // Other receiver claimed the slot.
+            pos = m_head.load(std::memory_order_relaxed);
+        }
+    }
 
-    m_state->m_mutex.lock();
+    return popped;
+}
 
-    erpc_assert(m_inBuffer != NULL);
-    message->copy(m_inBuffer);
-    m_inBuffer = NULL;
+void InterThreadBufferTransport::transfer(MessageBuffer *message, bool push)
+{
+    Waiters &self = push ? m_senders : m_receivers;
+    Waiters &other = push ? m_receivers : m_senders;
+    uint32_t spinLimit = self.m_spinLimit.load(std::memory_order_relaxed);
+    uint32_t spin;
+    bool done = push ? tryPush(message) : tryPop(message);
 
-    m_outSem.put();
+    // Spin while the peer is likely to respond soon, spin longer next time when it paid off.
+    for (spin = 0; !done && (spin < spinLimit); ++spin)
+    {
+        spinPause();
+        done = push ? tryPush(message) : tryPop(message);
+    }
+    if (spin != 0U)
+    {
+        if (done)
+        {
+            spinLimit = (spinLimit < (ERPC_INTER_THREAD_SPIN_COUNT / 2U)) ? (spinLimit * 2U) :
+                                                                             ERPC_INTER_THREAD_SPIN_COUNT;
+        }
+        else
+        {
+            spinLimit = (spinLimit > 1U) ? (spinLimit / 2U) : 1U;
+        }
+        self.m_spinLimit.store(spinLimit, std::memory_order_relaxed);
+    }
 
-    m_state->m_mutex.unlock();
+    // Block. The count is raised before the last try, so the peer sees it after its push or pop.
+    while (!done)
+    {
+        (void)self.m_count.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        done = push ? tryPush(message) : tryPop(message);
+        if (!done)
+        {
+            (void)self.m_semaphore.get();
+        }
+        (void)self.m_count.fetch_sub(1, std::memory_order_relaxed);
+    }
 
-    return kErpcStatus_Success;
+    // Wake a thread waiting for the other side. Extra wake-ups only make it try again.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (other.m_count.load(std::memory_order_relaxed) != 0U)
+    {
+        other.m_semaphore.put();
+    }
 }
-
-erpc_status_t InterThreadBufferTransport::send(MessageBuffer *message)
+#else
+bool InterThreadBufferTransport::tryPush(MessageBuffer *message)
 {
-    erpc_assert((m_state != NULL) && (m_peer != NULL));
+    Mutex::Guard lock(m_mutex);
+
+    m_slots[m_tail & ERPC_INTER_THREAD_QUEUE_MASK].m_buffer.swap(message);
+    ++m_tail;
 
-    m_peer->m_outSem.get();
+    return true;
+}
 
-    m_state->m_mutex.lock();
+bool InterThreadBufferTransport::tryPop(MessageBuffer *message)
+{
+    Mutex::Guard lock(m_mutex);
 
-    erpc_assert(m_peer->m_inBuffer == NULL);
-    m_peer->m_inBuffer = const_cast<MessageBuffer *>(message);
-    m_peer->m_inSem.put();
+    m_slots[m_head & ERPC_INTER_THREAD_QUEUE_MASK].m_buffer.swap(message);
+    ++m_head;
 
-    m_state->m_mutex.unlock();
+    return true;
+}
 
-    return kErpcStatus_Success;
+void InterThreadBufferTransport::transfer(MessageBuffer *message, bool push)
+{
+    // Semaphores count free slots and messages, so the ring operation cannot fail.
+    if (push)
+    {
+        (void)m_senders.m_semaphore.get();
+        (void)tryPush(message);
+        m_receivers.m_semaphore.put();
+    }
+    else
+    {
+        (void)m_receivers.m_semaphore.get();
+        (void)tryPop(message);
+        m_senders.m_semaphore.put();
+    }
 }
+#endif
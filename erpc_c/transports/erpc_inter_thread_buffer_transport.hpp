@@ -10,10 +10,19 @@
 #ifndef _EMBEDDED_RPC__INTER_THREAD_BUFFER_TRANSPORT_H_
 #define _EMBEDDED_RPC__INTER_THREAD_BUFFER_TRANSPORT_H_
 
+#include "erpc_config_internal.h"
 #include "erpc_message_buffer.hpp"
 #include "erpc_threading.h"
 #include "erpc_transport.hpp"
 
+#if ERPC_HAS_ATOMICS
+#include <atomic>
+#endif
+
+#if (ERPC_INTER_THREAD_QUEUE_SIZE == 0U) || ((ERPC_INTER_THREAD_QUEUE_SIZE & (ERPC_INTER_THREAD_QUEUE_SIZE - 1U)) != 0U)
+#error "ERPC_INTER_THREAD_QUEUE_SIZE has to be power of two!"
+#endif
+
 /*!
  * @addtogroup itbp_transport
  * @{
@@ -26,48 +35,136 @@
 
 namespace erpc {
 /*!
- * @brief Very basic transport to send/receive messages between threads.
+ * @brief Transport to send/receive messages between threads of one process without copying them.
  *
- * Can send and receive message buffers to/from another instance of the same class
- * associated with another thread. Only one other thread may be communicated with. To set
- * things up first create two instances. Then call the linkWithPeer() method on the
- * first one, passing the second. The two instances of this class do not have to be
- * created on their respective threads, but the send() and receive() calls must be
- * invoked on the appropriate thread.
+ * Can send and receive message buffers to/from another instance of the same class. To set things
+ * up first create two instances. Then call the linkWithPeer() method on the first one, passing the
+ * second. Any thread may call send() and receive() of either instance.
  *
- * Only a single message may be pending for each of the two threads. If a message is
- * pending for a thread and another is sent, then the sender will block until the
- * currently pending message is received.
+ * Each instance receives from a ring of ERPC_INTER_THREAD_QUEUE_SIZE slots, so that many messages
+ * can be in flight. Buffers are not copied, their ownership is transferred: send() swaps the message
+ * buffer into a slot and receive() swaps it out, leaving the receiver's own buffer in the slot. The
+ * sender gets that spare buffer back with next send() through the slot, or a new buffer from the
+ * factory set by setMessageBufferFactory() when the slot was empty. Hence both linked instances have
+ * to be given the message buffer factory used by their client and server, send() fails otherwise.
+ *
+ * Slots are claimed with atomic operations when available. A thread waiting for a message or for a
+ * free slot spins first, up to ERPC_INTER_THREAD_SPIN_COUNT iterations adjusted by how often spinning
+ * succeeded, then blocks on a semaphore.
  *
  * @ingroup itbp_transport
  */
 class InterThreadBufferTransport : public Transport
 {
 public:
-    InterThreadBufferTransport(void) :
-    Transport(), m_state(NULL), m_peer(NULL), m_inSem(), m_outSem(1), m_inBuffer(NULL)
-    {
-    }
+    InterThreadBufferTransport(void);
+
     virtual ~InterThreadBufferTransport(void);
 
+    /*!
+     * @brief This function links two instances together.
+     *
+     * @param[in] peer Instance receiving messages sent by this one, and sending to this one.
+     */
     void linkWithPeer(InterThreadBufferTransport *peer);
 
+    /*!
+     * @brief This function sets factory of buffers given to sender in exchange for sent messages.
+     *
+     * The factory also disposes buffers left in the ring when the transport is destroyed.
+     *
+     * @param[in] factory Message buffer factory used by client and server of both peers.
+     */
+    void setMessageBufferFactory(MessageBufferFactory *factory) { m_messageFactory = factory; }
+
     virtual erpc_status_t receive(MessageBuffer *message) override;
+
+    /*!
+     * @brief This function passes message to the peer and gives the caller a spare buffer instead.
+     *
+     * @param[inout] message Message to send, spare buffer on return.
+     *
+     * @retval #kErpcStatus_Success Message was passed to the peer.
+     * @retval #kErpcStatus_SendFailed Factory was not set on this and the peer instance, or differs.
+     */
     virtual erpc_status_t send(MessageBuffer *message) override;
 
+    virtual bool hasMessage(void) override;
+
     virtual int32_t getAvailable(void) const { return 0; }
 
 protected:
-    struct SharedState
+    /*!
+     * @brief Threads waiting for one side of the ring.
+     */
+    struct Waiters
     {
-        Mutex m_mutex;
+        /*!
+         * @brief Constructor.
+         *
+         * @param[in] count Initial semaphore count, used when atomics are not available.
+         */
+        explicit Waiters(int count);
+
+#if ERPC_HAS_ATOMICS
+        std::atomic<uint32_t> m_count;     /*!< Number of blocked threads. */
+        std::atomic<uint32_t> m_spinLimit; /*!< Spin iterations before blocking. */
+#endif
+        Semaphore m_semaphore; /*!< Blocked threads wait here, counts messages or free slots without atomics. */
+    };
+
+    /*!
+     * @brief Slot of the ring.
+     */
+    struct Slot
+    {
+#if ERPC_HAS_ATOMICS
+        std::atomic<uint32_t> m_sequence; /*!< Position for which the slot is free or full. */
+#endif
+        MessageBuffer m_buffer; /*!< Message, or spare buffer left by receiver. */
     };
 
-    SharedState *m_state;               /*!< */
-    InterThreadBufferTransport *m_peer; /*!< */
-    Semaphore m_inSem;                  /*!< */
-    Semaphore m_outSem;                 /*!< */
-    MessageBuffer *m_inBuffer;          /*!< */
+    InterThreadBufferTransport *m_peer;         /*!< Linked instance. */
+    MessageBufferFactory *m_messageFactory;     /*!< Creates buffers for senders, when set. */
+    Slot m_slots[ERPC_INTER_THREAD_QUEUE_SIZE]; /*!< Ring of received messages. */
+#if ERPC_HAS_ATOMICS
+    std::atomic<uint32_t> m_head; /*!< Position of next message to receive. */
+    std::atomic<uint32_t> m_tail; /*!< Position of next message to send. */
+#else
+    Mutex m_mutex;   /*!< Guards positions. */
+    uint32_t m_head; /*!< Position of next message to receive. */
+    uint32_t m_tail; /*!< Position of next message to send. */
+#endif
+    Waiters m_receivers; /*!< Threads waiting for a message. */
+    Waiters m_senders;   /*!< Threads waiting for a free slot. */
+
+    /*!
+     * @brief This function swaps message into a free slot of this ring, if any.
+     *
+     * @param[inout] message Message to send, spare buffer of the slot on return.
+     *
+     * @retval True Message was queued.
+     * @retval False Ring is full.
+     */
+    bool tryPush(MessageBuffer *message);
+
+    /*!
+     * @brief This function swaps oldest message of this ring out, if any.
+     *
+     * @param[inout] message Spare buffer left in the slot, received message on return.
+     *
+     * @retval True Message was received.
+     * @retval False Ring is empty.
+     */
+    bool tryPop(MessageBuffer *message);
+
+    /*!
+     * @brief This function pushes message into or pops message from this ring, waits when not possible.
+     *
+     * @param[inout] message Message to push or spare buffer, swapped buffer on return.
+     * @param[in] push True to push, false to pop.
+     */
+    void transfer(MessageBuffer *message, bool push);
 };
 
 } // namespace erpc
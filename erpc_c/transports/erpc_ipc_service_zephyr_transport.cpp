@@ -56,8 +56,8 @@ void ZephyrIPCTransport::ept_recv_cb(const void *data, size_t len, void *priv)
             if (ret == 0)
             {
                 MessageBuffer message(const_cast<uint8_t *>(reinterpret_cast<const uint8_t *>(data)),
-                                      static_cast<uint16_t>(len));
-                message.setUsed(static_cast<uint16_t>(len));
+                                      static_cast<message_size_t>(len));
+                message.setUsed(static_cast<message_size_t>(len));
 
                 // Add to queue
                 (void)transport->m_messageQueue.add(message);
@@ -158,7 +158,7 @@ erpc_status_t ZephyrIPCTransport::send(MessageBuffer *message)
     }
 
     uint8_t *buf = message->get();
-    uint16_t len = message->getUsed();
+    message_size_t len = message->getUsed();
 
     // Use nocopy send (buffer was allocated by factory with get_tx_buffer)
     ret = ipc_service_send_nocopy(&m_ept, buf, len);
@@ -97,7 +97,7 @@ erpc_status_t MBOXTransport::receive(MessageBuffer *message)
 
         // Wait for message to be transmitted
         waitForBytes(rxMsgSize);
-        message->setUsed((uint16_t)rxMsgSize);
+        message->setUsed((message_size_t)rxMsgSize);
 
         if (ring_buf_get(&s_rxRingBuffer, reinterpret_cast<uint8_t *>(message->get()), rxMsgSize) != rxMsgSize)
         {
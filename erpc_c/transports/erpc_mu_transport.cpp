@@ -217,7 +217,7 @@ erpc_status_t MUTransport::receive(MessageBuffer *message)
         }
 #endif
 
-        message->setUsed((uint16_t)m_rxMsgSize);
+        message->setUsed((message_size_t)m_rxMsgSize);
         m_newMessage = false;
         status = kErpcStatus_Success;
     }
@@ -260,8 +260,8 @@ erpc_status_t RPMsgRTOSTransport::send(MessageBuffer *message)
 {
     erpc_status_t status = kErpcStatus_Success;
     uint8_t *buf = message->get();
-    uint16_t length = message->getLength();
-    uint16_t used = message->getUsed();
+    message_size_t length = message->getLength();
+    message_size_t used = message->getUsed();
     int32_t ret_val;
 
     message->set(NULL, 0);
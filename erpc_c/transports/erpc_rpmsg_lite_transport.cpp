@@ -33,7 +33,7 @@ int32_t RPMsgTransport::rpmsg_read_cb(void *payload, uint32_t payload_len, uint3
     if (payload_len <= ERPC_DEFAULT_BUFFER_SIZE)
     {
         MessageBuffer message(reinterpret_cast<uint8_t *>(payload), payload_len);
-        message.setUsed((uint16_t)payload_len);
+        message.setUsed((message_size_t)payload_len);
         (void)transport->m_messageQueue.add(message);
     }
     return RL_HOLD;
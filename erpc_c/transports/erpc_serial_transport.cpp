@@ -35,6 +35,9 @@ using namespace erpc;
 SerialTransport::SerialTransport(const char *portName, speed_t baudRate) :
 m_serialHandle(0), m_portName(portName), m_baudRate(baudRate)
 {
+#if ERPC_TRANSPORT_READ_AHEAD_SIZE > 0
+    setReadAheadBuffer(m_readAhead, sizeof(m_readAhead));
+#endif
 }
 
 SerialTransport::~SerialTransport(void)
@@ -104,3 +107,13 @@ erpc_status_t SerialTransport::underlyingReceive(uint8_t *data, uint32_t size)
 
     return (size != bytesRead) ? kErpcStatus_ReceiveFailed : kErpcStatus_Success;
 }
+
+erpc_status_t SerialTransport::underlyingReceiveAvailable(uint8_t *data, uint32_t minSize, uint32_t maxSize,
+                                                          uint32_t &received)
+{
+    int bytesRead = serial_read_available(m_serialHandle, reinterpret_cast<char *>(data), (int)minSize, (int)maxSize);
+
+    received = (bytesRead > 0) ? (uint32_t)bytesRead : 0U;
+
+    return (received < minSize) ? kErpcStatus_ReceiveFailed : kErpcStatus_Success;
+}
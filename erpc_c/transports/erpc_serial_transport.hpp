@@ -79,6 +79,20 @@ private:
      */
     virtual erpc_status_t underlyingReceive(uint8_t *data, uint32_t size) override;
 
+    /*!
+     * @brief Receive data available on Serial peripheral.
+     *
+     * @param[inout] data Preallocated buffer for receiving data.
+     * @param[in] minSize Size of data to wait for.
+     * @param[in] maxSize Size of buffer.
+     * @param[out] received Size of received data.
+     *
+     * @retval kErpcStatus_ReceiveFailed Serial failed to receive data.
+     * @retval kErpcStatus_Success Successfully received at least minSize bytes.
+     */
+    virtual erpc_status_t underlyingReceiveAvailable(uint8_t *data, uint32_t minSize, uint32_t maxSize,
+                                                     uint32_t &received) override;
+
     /*!
      * @brief Write data to Serial peripheral.
      *
@@ -94,6 +108,9 @@ private:
     int m_serialHandle;     /*!< Serial handle id. */
     const char *m_portName; /*!< Port name. */
     speed_t m_baudRate;     /*!< Bauderate. */
+#if ERPC_TRANSPORT_READ_AHEAD_SIZE > 0
+    uint8_t m_readAhead[ERPC_TRANSPORT_READ_AHEAD_SIZE]; /*!< Read-ahead buffer. */
+#endif
 };
 
 } // namespace erpc
@@ -0,0 +1,581 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_shm_transport.hpp"
+
+#include <climits>
+#include <cstring>
+#include <new>
+
+extern "C" {
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+}
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#define ERPC_SHM_MAGIC (0x65525043U) // "eRPC"
+#define ERPC_SHM_VERSION (1U)
+#define ERPC_SHM_CACHE_LINE (64U)
+#define ERPC_SHM_SLOTS_MASK (ERPC_TRANSPORT_SHM_SLOTS_COUNT - 1U)
+
+//! Slots start on cache line boundary.
+#define ERPC_SHM_SLOT_SIZE \
+    (((ERPC_DEFAULT_BUFFER_SIZE + ERPC_SHM_CACHE_LINE - 1U) / ERPC_SHM_CACHE_LINE) * ERPC_SHM_CACHE_LINE)
+
+// Atomics in shared memory have to work without locks of this process.
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "Shared memory transport requires lock-free 32-bit atomics.");
+
+namespace erpc {
+/*!
+ * @brief Bounded lock-free ring of slot indices inside shared memory.
+ *
+ * Each position has sequence telling if it is free or filled for the current round, so any thread
+ * of both processes can push and pop.
+ */
+struct ShmRing
+{
+    alignas(ERPC_SHM_CACHE_LINE) std::atomic<uint32_t> head; /*!< Position of next index to pop. */
+    alignas(ERPC_SHM_CACHE_LINE) std::atomic<uint32_t> tail; /*!< Position of next index to push. */
+    alignas(ERPC_SHM_CACHE_LINE) std::atomic<uint32_t> event; /*!< Futex word, changed by each push. */
+    std::atomic<uint32_t> waiters;                            /*!< Threads sleeping on the futex. */
+    std::atomic<uint32_t> sequence[ERPC_TRANSPORT_SHM_SLOTS_COUNT]; /*!< Round of each position. */
+    uint32_t value[ERPC_TRANSPORT_SHM_SLOTS_COUNT];                 /*!< Slot index at each position. */
+};
+
+/*!
+ * @brief Slots owned by one side for sending.
+ */
+struct ShmPool
+{
+    ShmRing free;                                    /*!< Slots which can be allocated. */
+    ShmRing sent;                                    /*!< Slots sent to the peer. */
+    uint32_t length[ERPC_TRANSPORT_SHM_SLOTS_COUNT]; /*!< Message length of each sent slot. */
+};
+
+/*!
+ * @brief Header of shared memory, followed by slots of both pools.
+ */
+struct ShmRegion
+{
+    std::atomic<uint32_t> magic; /*!< Set when the server finished initialization. */
+    uint32_t version;            /*!< Layout version. */
+    uint32_t slotsCount;         /*!< Slots in each pool. */
+    uint32_t slotSize;           /*!< Bytes of each slot. */
+    std::atomic<uint32_t> closed; /*!< Set by close() of either side. */
+    ShmPool pools[2];             /*!< Pool of server and pool of client. */
+};
+} // namespace erpc
+
+//! Offset of slots from start of the region.
+#define ERPC_SHM_SLOTS_OFFSET \
+    (((sizeof(ShmRegion) + ERPC_SHM_CACHE_LINE - 1U) / ERPC_SHM_CACHE_LINE) * ERPC_SHM_CACHE_LINE)
+
+//! Size of the whole region.
+#define ERPC_SHM_REGION_SIZE (ERPC_SHM_SLOTS_OFFSET + (2U * ERPC_TRANSPORT_SHM_SLOTS_COUNT * ERPC_SHM_SLOT_SIZE))
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Hint to the processor that the thread is spinning.
+ */
+static inline void spinPause(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#elif defined(__GNUC__) && (defined(__aarch64__) || defined(__arm__))
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/*!
+ * @brief Sleeps while futex word has given value. Futex is not private, peer process wakes it.
+ */
+static void futexWait(std::atomic<uint32_t> *word, uint32_t value)
+{
+    (void)syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAIT, value, NULL, NULL, 0);
+}
+
+/*!
+ * @brief Wakes threads sleeping on futex word.
+ */
+static void futexWake(std::atomic<uint32_t> *word, int count)
+{
+    (void)syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAKE, count, NULL, NULL, 0);
+}
+
+static void ringInit(ShmRing *ring)
+{
+    uint32_t i;
+
+    ring->head.store(0, std::memory_order_relaxed);
+    ring->tail.store(0, std::memory_order_relaxed);
+    ring->event.store(0, std::memory_order_relaxed);
+    ring->waiters.store(0, std::memory_order_relaxed);
+    for (i = 0; i < ERPC_TRANSPORT_SHM_SLOTS_COUNT; ++i)
+    {
+        ring->sequence[i].store(i, std::memory_order_relaxed);
+        ring->value[i] = 0;
+    }
+}
+
+static bool ringPop(ShmRing *ring, uint32_t &value)
+{
+    bool popped = false;
+    bool empty = false;
+    uint32_t pos = ring->head.load(std::memory_order_relaxed);
+    uint32_t index;
+    int32_t diff;
+
+    while (!popped && !empty)
+    {
+        index = pos & ERPC_SHM_SLOTS_MASK;
+        diff = (int32_t)(ring->sequence[index].load(std::memory_order_acquire) - (pos + 1U));
+        if (diff == 0)
+        {
+            // On failure pos is updated to current head.
+            if (ring->head.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed))
+            {
+                value = ring->value[index];
+                ring->sequence[index].store(pos + ERPC_TRANSPORT_SHM_SLOTS_COUNT, std::memory_order_release);
+                popped = true;
+            }
+        }
+        else if (diff < 0)
+        {
+            empty = true;
+        }
+        else
+        {
+            // Other thread popped this position.
+            pos = ring->head.load(std::memory_order_relaxed);
+        }
+    }
+
+    return popped;
+}
+
+static void ringPush(ShmRing *ring, uint32_t value)
+{
+    bool pushed = false;
+    uint32_t pos = ring->tail.load(std::memory_order_relaxed);
+    uint32_t index;
+    int32_t diff;
+
+    // Ring holds every slot of the pool, it is full only until a popping thread updates the sequence.
+    while (!pushed)
+    {
+        index = pos & ERPC_SHM_SLOTS_MASK;
+        diff = (int32_t)(ring->sequence[index].load(std::memory_order_acquire) - pos);
+        if (diff == 0)
+        {
+            // On failure pos is updated to current tail.
+            if (ring->tail.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed))
+            {
+                ring->value[index] = value;
+                ring->sequence[index].store(pos + 1U, std::memory_order_release);
+                pushed = true;
+            }
+        }
+        else if (diff < 0)
+        {
+            spinPause();
+            pos = ring->tail.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            // Other thread pushed to this position.
+            pos = ring->tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Sleeping thread is counted before its last pop attempt, so it sees either the value or the event.
+    (void)ring->event.fetch_add(1, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (ring->waiters.load(std::memory_order_relaxed) != 0U)
+    {
+        futexWake(&ring->event, 1);
+    }
+}
+
+ShmTransport::ShmTransport(void) :
+Transport(), m_region(NULL), m_size(0), m_side(0), m_name(NULL), m_spinLimit(ERPC_TRANSPORT_SHM_SPIN_COUNT)
+{
+}
+
+ShmTransport::~ShmTransport(void)
+{
+    if (m_region != NULL)
+    {
+        close();
+        (void)munmap(m_region, m_size);
+    }
+
+    if (m_name != NULL)
+    {
+        (void)shm_unlink(m_name);
+    }
+}
+
+erpc_status_t ShmTransport::open(const char *name, bool isServer)
+{
+    erpc_status_t status;
+    int fd;
+
+    erpc_assert(name != NULL);
+
+    if (isServer)
+    {
+        (void)shm_unlink(name);
+        fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    }
+    else
+    {
+        fd = shm_open(name, O_RDWR, 0);
+    }
+
+    if (fd < 0)
+    {
+        status = kErpcStatus_InitFailed;
+    }
+    else
+    {
+        status = map(fd, isServer);
+        (void)::close(fd);
+
+        if (isServer)
+        {
+            if (status == kErpcStatus_Success)
+            {
+                m_name = name;
+            }
+            else
+            {
+                (void)shm_unlink(name);
+            }
+        }
+    }
+
+    return status;
+}
+
+erpc_status_t ShmTransport::open(int fd, bool isServer)
+{
+    return map(fd, isServer);
+}
+
+erpc_status_t ShmTransport::map(int fd, bool isServer)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    struct stat st;
+    void *address;
+    uint32_t pool;
+    uint32_t i;
+
+    erpc_assert(m_region == NULL);
+
+    if (isServer)
+    {
+        if (ftruncate(fd, (off_t)ERPC_SHM_REGION_SIZE) != 0)
+        {
+            status = kErpcStatus_InitFailed;
+        }
+    }
+    else if ((fstat(fd, &st) != 0) || ((size_t)st.st_size < ERPC_SHM_REGION_SIZE))
+    {
+        status = kErpcStatus_InitFailed;
+    }
+    else
+    {
+        // Region was sized by the server.
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        address = mmap(NULL, ERPC_SHM_REGION_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            status = kErpcStatus_InitFailed;
+        }
+        else
+        {
+            m_region = reinterpret_cast<ShmRegion *>(address);
+            m_size = ERPC_SHM_REGION_SIZE;
+            m_side = isServer ? 0U : 1U;
+        }
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        if (isServer)
+        {
+            m_region = new (address) ShmRegion;
+            m_region->version = ERPC_SHM_VERSION;
+            m_region->slotsCount = ERPC_TRANSPORT_SHM_SLOTS_COUNT;
+            m_region->slotSize = ERPC_SHM_SLOT_SIZE;
+            m_region->closed.store(0, std::memory_order_relaxed);
+            for (pool = 0; pool < 2U; ++pool)
+            {
+                ringInit(&m_region->pools[pool].free);
+                ringInit(&m_region->pools[pool].sent);
+                for (i = 0; i < ERPC_TRANSPORT_SHM_SLOTS_COUNT; ++i)
+                {
+                    m_region->pools[pool].length[i] = 0;
+                    ringPush(&m_region->pools[pool].free, i);
+                }
+            }
+            m_region->magic.store(ERPC_SHM_MAGIC, std::memory_order_release);
+        }
+        else if ((m_region->magic.load(std::memory_order_acquire) != ERPC_SHM_MAGIC) ||
+                 (m_region->version != ERPC_SHM_VERSION) ||
+                 (m_region->slotsCount != ERPC_TRANSPORT_SHM_SLOTS_COUNT) ||
+                 (m_region->slotSize != ERPC_SHM_SLOT_SIZE))
+        {
+            (void)munmap(m_region, m_size);
+            m_region = NULL;
+            status = kErpcStatus_InitFailed;
+        }
+        else
+        {
+            // Layout matches.
+        }
+    }
+
+    return status;
+}
+
+void ShmTransport::close(void)
+{
+    uint32_t pool;
+
+    erpc_assert(m_region != NULL);
+
+    m_region->closed.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (pool = 0; pool < 2U; ++pool)
+    {
+        (void)m_region->pools[pool].free.event.fetch_add(1, std::memory_order_relaxed);
+        futexWake(&m_region->pools[pool].free.event, INT_MAX);
+        (void)m_region->pools[pool].sent.event.fetch_add(1, std::memory_order_relaxed);
+        futexWake(&m_region->pools[pool].sent.event, INT_MAX);
+    }
+}
+
+bool ShmTransport::pop(ShmRing *ring, uint32_t &value)
+{
+    uint32_t spinLimit = m_spinLimit.load(std::memory_order_relaxed);
+    uint32_t spin;
+    uint32_t event;
+    bool done = ringPop(ring, value);
+
+    // Spin while the peer is likely to respond soon, spin longer next time when it paid off.
+    for (spin = 0; !done && (spin < spinLimit); ++spin)
+    {
+        spinPause();
+        done = ringPop(ring, value);
+    }
+    if (spin != 0U)
+    {
+        if (done)
+        {
+            spinLimit = (spinLimit < (ERPC_TRANSPORT_SHM_SPIN_COUNT / 2U)) ? (spinLimit * 2U) :
+                                                                              ERPC_TRANSPORT_SHM_SPIN_COUNT;
+        }
+        else
+        {
+            spinLimit = (spinLimit > 1U) ? (spinLimit / 2U) : 1U;
+        }
+        m_spinLimit.store(spinLimit, std::memory_order_relaxed);
+    }
+
+    // Sleep. Event is read before the last attempt, so a push made after it does not let the futex sleep.
+    while (!done && (m_region->closed.load(std::memory_order_relaxed) == 0U))
+    {
+        event = ring->event.load(std::memory_order_acquire);
+        (void)ring->waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        done = ringPop(ring, value);
+        if (!done && (m_region->closed.load(std::memory_order_relaxed) == 0U))
+        {
+            futexWait(&ring->event, event);
+        }
+        (void)ring->waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    return done;
+}
+
+MessageBuffer ShmTransport::allocate(void)
+{
+    MessageBuffer buffer;
+    uint32_t index;
+
+    erpc_assert(m_region != NULL);
+
+    if ((m_region->closed.load(std::memory_order_relaxed) == 0U) && pop(&m_region->pools[m_side].free, index))
+    {
+        buffer.set(slotData(m_side, index), ERPC_SHM_SLOT_SIZE);
+    }
+
+    return buffer;
+}
+
+void ShmTransport::release(MessageBuffer *buf)
+{
+    uint32_t pool;
+    uint32_t index;
+
+    erpc_assert(buf != NULL);
+
+    if (findSlot(buf->get(), pool, index))
+    {
+        ringPush(&m_region->pools[pool].free, index);
+    }
+    buf->set(NULL, 0);
+}
+
+erpc_status_t ShmTransport::send(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    uint32_t pool = 0;
+    uint32_t index = 0;
+
+    erpc_assert(m_region != NULL);
+
+    if (m_region->closed.load(std::memory_order_relaxed) != 0U)
+    {
+        status = kErpcStatus_ConnectionClosed;
+    }
+    else if (findSlot(message->get(), pool, index) && (pool == m_side))
+    {
+        // Message was written in place, pass the slot itself.
+        m_region->pools[m_side].length[index] = message->getUsed();
+        ringPush(&m_region->pools[m_side].sent, index);
+        message->set(NULL, 0);
+    }
+    else if (message->getUsed() > ERPC_SHM_SLOT_SIZE)
+    {
+        status = kErpcStatus_SendFailed;
+    }
+    else
+    {
+        MessageBuffer slot(allocate());
+
+        if (slot.get() == NULL)
+        {
+            status = kErpcStatus_ConnectionClosed;
+        }
+        else
+        {
+            (void)memcpy(slot.get(), message->get(), message->getUsed());
+            (void)findSlot(slot.get(), pool, index);
+            m_region->pools[m_side].length[index] = message->getUsed();
+            ringPush(&m_region->pools[m_side].sent, index);
+        }
+    }
+
+    return status;
+}
+
+erpc_status_t ShmTransport::receive(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    uint32_t pool = 1U - m_side;
+    uint32_t index;
+    uint32_t length;
+    MessageBuffer slot;
+
+    erpc_assert(m_region != NULL);
+
+    if (!pop(&m_region->pools[pool].sent, index))
+    {
+        status = kErpcStatus_ConnectionClosed;
+    }
+    else if (index >= ERPC_TRANSPORT_SHM_SLOTS_COUNT)
+    {
+        // Peer process wrote invalid index, there is no slot to return.
+        status = kErpcStatus_ReceiveFailed;
+    }
+    else
+    {
+        // Length is written by the peer process, read it once and check it before use.
+        length = m_region->pools[pool].length[index];
+        if (length > ERPC_SHM_SLOT_SIZE)
+        {
+            status = kErpcStatus_ReceiveFailed;
+            slot.set(slotData(pool, index), ERPC_SHM_SLOT_SIZE);
+            release(&slot);
+        }
+        else if (message->get() == NULL)
+        {
+            // Hand over the slot, caller returns it with release().
+            message->set(slotData(pool, index), ERPC_SHM_SLOT_SIZE);
+            message->setUsed((message_size_t)length);
+        }
+        else
+        {
+            if (length > message->getLength())
+            {
+                status = kErpcStatus_ReceiveFailed;
+            }
+            else
+            {
+                (void)memcpy(message->get(), slotData(pool, index), length);
+                message->setUsed((message_size_t)length);
+            }
+            slot.set(slotData(pool, index), ERPC_SHM_SLOT_SIZE);
+            release(&slot);
+        }
+    }
+
+    return status;
+}
+
+bool ShmTransport::hasMessage(void)
+{
+    ShmRing *ring = &m_region->pools[1U - m_side].sent;
+    uint32_t head = ring->head.load(std::memory_order_relaxed);
+
+    return (ring->sequence[head & ERPC_SHM_SLOTS_MASK].load(std::memory_order_acquire) == (head + 1U));
+}
+
+bool ShmTransport::findSlot(const uint8_t *data, uint32_t &pool, uint32_t &index) const
+{
+    bool found = false;
+    const uint8_t *slots = reinterpret_cast<const uint8_t *>(m_region) + ERPC_SHM_SLOTS_OFFSET;
+    size_t offset;
+
+    if ((m_region != NULL) && (data >= slots) && (data < (slots + (m_size - ERPC_SHM_SLOTS_OFFSET))))
+    {
+        offset = (size_t)(data - slots);
+        if ((offset % ERPC_SHM_SLOT_SIZE) == 0U)
+        {
+            pool = (uint32_t)(offset / ERPC_SHM_SLOT_SIZE) / ERPC_TRANSPORT_SHM_SLOTS_COUNT;
+            index = (uint32_t)(offset / ERPC_SHM_SLOT_SIZE) & ERPC_SHM_SLOTS_MASK;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+uint8_t *ShmTransport::slotData(uint32_t pool, uint32_t index) const
+{
+    return reinterpret_cast<uint8_t *>(m_region) + ERPC_SHM_SLOTS_OFFSET +
+           (((pool * ERPC_TRANSPORT_SHM_SLOTS_COUNT) + index) * ERPC_SHM_SLOT_SIZE);
+}
@@ -0,0 +1,291 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _EMBEDDED_RPC__SHM_TRANSPORT_H_
+#define _EMBEDDED_RPC__SHM_TRANSPORT_H_
+
+#include "erpc_config_internal.h"
+#include "erpc_message_buffer.hpp"
+#include "erpc_transport.hpp"
+
+#include <atomic>
+#include <stddef.h>
+
+#if (ERPC_TRANSPORT_SHM_SLOTS_COUNT == 0U) || \
+    ((ERPC_TRANSPORT_SHM_SLOTS_COUNT & (ERPC_TRANSPORT_SHM_SLOTS_COUNT - 1U)) != 0U)
+#error "ERPC_TRANSPORT_SHM_SLOTS_COUNT has to be power of two!"
+#endif
+
+/*!
+ * @addtogroup shm_transport
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+struct ShmRegion;
+struct ShmRing;
+
+/*!
+ * @brief Transport between two processes of one Linux host through shared memory.
+ *
+ * The region is a POSIX shared memory object (shm_open()) or any other mappable file descriptor,
+ * for example memfd_create() passed to the peer process. The server creates and initializes it,
+ * the client maps an existing one.
+ *
+ * Each side owns a pool of ERPC_TRANSPORT_SHM_SLOTS_COUNT slots of ERPC_DEFAULT_BUFFER_SIZE bytes.
+ * Two lock-free rings of slot indices belong to each pool: free slots, and slots sent to the peer.
+ * Waiting threads spin shortly and then sleep on a futex in the region, so no system call is made
+ * while the peer is fast enough.
+ *
+ * Messages are sent without copy when they are written directly into a slot. The factory returned
+ * by erpc_mbf_shm_init() allocates slots with allocate() and returns received slots with release().
+ * send() then passes the slot itself and receive() hands over the received slot, like the RPMsg
+ * zero copy transport does. Buffers of other factories work too, their content is copied into
+ * and out of slots.
+ *
+ * @ingroup shm_transport
+ */
+class ShmTransport : public Transport
+{
+public:
+    /*!
+     * @brief Constructor.
+     */
+    ShmTransport(void);
+
+    /*!
+     * @brief ShmTransport destructor
+     */
+    virtual ~ShmTransport(void);
+
+    /*!
+     * @brief This function opens shared memory object by name.
+     *
+     * Server replaces object of the same name, which can be left by crashed process, and unlinks it
+     * when the transport is destroyed. Client fails when the server did not create the object yet.
+     *
+     * @param[in] name Name of shared memory object, starts with '/'. Has to live as long as transport.
+     * @param[in] isServer True to create and initialize the object.
+     *
+     * @retval #kErpcStatus_Success Region was mapped.
+     * @retval #kErpcStatus_InitFailed Object does not exist, is not initialized or differs in configuration.
+     */
+    erpc_status_t open(const char *name, bool isServer);
+
+    /*!
+     * @brief This function maps shared memory file descriptor.
+     *
+     * The descriptor stays owned by caller and can be closed once this function returns.
+     *
+     * @param[in] fd File descriptor of shared memory, for example from memfd_create().
+     * @param[in] isServer True to size and initialize the memory.
+     *
+     * @retval #kErpcStatus_Success Region was mapped.
+     * @retval #kErpcStatus_InitFailed Memory is not initialized or differs in configuration.
+     */
+    erpc_status_t open(int fd, bool isServer);
+
+    /*!
+     * @brief This function closes the link.
+     *
+     * Threads of both processes waiting in receive() or allocate() wake up and fail.
+     */
+    void close(void);
+
+    /*!
+     * @brief This function takes free slot of this side for a message to send.
+     *
+     * Waits until the peer releases a slot.
+     *
+     * @return Buffer inside shared memory, NULL buffer when the link was closed.
+     */
+    MessageBuffer allocate(void);
+
+    /*!
+     * @brief This function returns slot to its pool.
+     *
+     * Accepts slots from allocate() which were not sent and received slots.
+     *
+     * @param[inout] buf Slot to return, set to NULL buffer.
+     */
+    void release(MessageBuffer *buf);
+
+    /*!
+     * @brief This function receives message from the peer.
+     *
+     * NULL buffer gets the received slot, which has to be returned by release(). Other buffer gets
+     * copy of the message.
+     *
+     * @param[inout] message Buffer for the message.
+     *
+     * @retval #kErpcStatus_Success Message was received.
+     * @retval #kErpcStatus_ReceiveFailed Message does not fit into the buffer, or peer wrote invalid slot or length.
+     * @retval #kErpcStatus_ConnectionClosed Link was closed.
+     */
+    virtual erpc_status_t receive(MessageBuffer *message) override;
+
+    /*!
+     * @brief This function sends message to the peer.
+     *
+     * Slot from allocate() is passed to the peer and message is set to NULL buffer. Other buffer
+     * is copied into a free slot and stays owned by caller.
+     *
+     * @param[inout] message Message to send.
+     *
+     * @retval #kErpcStatus_Success Message was sent.
+     * @retval #kErpcStatus_SendFailed Message does not fit into a slot.
+     * @retval #kErpcStatus_ConnectionClosed Link was closed.
+     */
+    virtual erpc_status_t send(MessageBuffer *message) override;
+
+    /*!
+     * @brief This function checks for received message.
+     *
+     * @retval True Message is waiting.
+     * @retval False No message was received.
+     */
+    virtual bool hasMessage(void) override;
+
+protected:
+    ShmRegion *m_region;               /*!< Mapped shared memory. */
+    size_t m_size;                     /*!< Size of the mapping. */
+    uint32_t m_side;                   /*!< 0 for server, 1 for client, selects the pool used for sending. */
+    const char *m_name;                /*!< Name of shared memory object unlinked by server, or NULL. */
+    std::atomic<uint32_t> m_spinLimit; /*!< Spin iterations before sleeping, adapted to peer response time. */
+
+    /*!
+     * @brief This function maps the region and checks or initializes its layout.
+     *
+     * @param[in] fd File descriptor of shared memory.
+     * @param[in] isServer True to size and initialize the memory.
+     *
+     * @return Status of the mapping.
+     */
+    erpc_status_t map(int fd, bool isServer);
+
+    /*!
+     * @brief This function pops slot index from ring, waits until there is one.
+     *
+     * @param[in] ring Ring in shared memory.
+     * @param[out] value Popped slot index.
+     *
+     * @retval True Index was popped.
+     * @retval False Link was closed.
+     */
+    bool pop(ShmRing *ring, uint32_t &value);
+
+    /*!
+     * @brief This function returns pool and index of slot containing given data.
+     *
+     * @param[in] data Start of message buffer.
+     * @param[out] pool Pool of the slot.
+     * @param[out] index Index of the slot in the pool.
+     *
+     * @retval True Data is start of a slot.
+     * @retval False Data is outside of slots.
+     */
+    bool findSlot(const uint8_t *data, uint32_t &pool, uint32_t &index) const;
+
+    /*!
+     * @brief This function returns start of slot.
+     *
+     * @param[in] pool Pool of the slot.
+     * @param[in] index Index of the slot in the pool.
+     *
+     * @return Slot data.
+     */
+    uint8_t *slotData(uint32_t pool, uint32_t index) const;
+};
+
+/*!
+ * @brief Message buffer factory writing messages in place into slots of shared memory transport.
+ *
+ * @ingroup shm_transport
+ */
+class ShmMessageBufferFactory : public MessageBufferFactory
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * @param[in] transport Transport owning the slots.
+     */
+    explicit ShmMessageBufferFactory(ShmTransport *transport) : m_transport(transport) {}
+
+    /*!
+     * @brief Destructor
+     */
+    virtual ~ShmMessageBufferFactory(void) {}
+
+    /*!
+     * @brief This function allocates free slot, waits until the peer releases one.
+     *
+     * @return Slot, NULL buffer when the link was closed.
+     */
+    virtual MessageBuffer create(void) override { return m_transport->allocate(); }
+
+    /*!
+     * @brief This function returns slot to its pool.
+     *
+     * @param[in] buf Slot to return.
+     */
+    virtual void dispose(MessageBuffer *buf) override
+    {
+        erpc_assert(buf != NULL);
+        m_transport->release(buf);
+    }
+
+    /*!
+     * @brief This function returns received slot and allocates slot for the reply.
+     *
+     * @param[inout] message Received slot, reply slot on return.
+     * @param[in] reserveHeaderSize Reserved amount of bytes at the beginning of message buffer.
+     *
+     * @retval #kErpcStatus_Success Reply slot was allocated.
+     * @retval #kErpcStatus_MemoryError Link was closed.
+     */
+    virtual erpc_status_t prepareServerBufferForSend(MessageBuffer &message, uint8_t reserveHeaderSize = 0) override
+    {
+        erpc_status_t status;
+
+        dispose(&message);
+        MessageBuffer slot(create());
+        message.swap(&slot);
+        if (message.get() != NULL)
+        {
+            message.setUsed(reserveHeaderSize);
+            status = kErpcStatus_Success;
+        }
+        else
+        {
+            status = kErpcStatus_MemoryError;
+        }
+
+        return status;
+    }
+
+    /*!
+     * @brief Server receives slots from transport, it does not need own buffer.
+     *
+     * @return Always false.
+     */
+    virtual bool createServerBuffer(void) override { return false; }
+
+protected:
+    ShmTransport *m_transport; /*!< Transport owning the slots. */
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__SHM_TRANSPORT_H_
@@ -0,0 +1,629 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "erpc_tcp_epoll_server_transport.hpp"
+
+#include "erpc_config_internal.h"
+#include ENDIANNESS_HEADER
+#include "erpc_port.h"
+
+#include <cstdio>
+#include <new>
+
+extern "C" {
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+}
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Set this to 1 to enable debug logging.
+//#define TCP_EPOLL_TRANSPORT_DEBUG_LOG (1)
+
+#if TCP_EPOLL_TRANSPORT_DEBUG_LOG
+#define TCP_EPOLL_DEBUG_PRINT(_fmt_, ...) printf(_fmt_, ##__VA_ARGS__)
+#else
+#define TCP_EPOLL_DEBUG_PRINT(_fmt_, ...)
+#endif
+
+//! @brief Amount of events processed by one epoll_wait() call.
+#define TCP_EPOLL_EVENTS_COUNT (32U)
+
+//! @brief Marks end of free slots list.
+#define TCP_EPOLL_NO_SLOT (0xFFFFFFFFU)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TCPEpollServerTransport::TCPEpollServerTransport(const char *host, uint16_t port, uint32_t maxConnections,
+                                                 uint32_t maxMessageSize) :
+FramedTransport(), m_host(host), m_port(port), m_maxConnections(maxConnections), m_maxMessageSize(maxMessageSize),
+m_serverSocket(-1), m_epoll(-1), m_wakeEvent(-1), m_connections(NULL), m_firstFree(TCP_EPOLL_NO_SLOT),
+m_connectionCount(0), m_connectionsLock(), m_runServer(false)
+{
+    // Slot index is carried in 16 bits of the reply routing tag.
+    erpc_assert(maxConnections <= 0xFFFFU);
+}
+
+TCPEpollServerTransport::~TCPEpollServerTransport(void)
+{
+    uint32_t i;
+
+    (void)close();
+
+    if (m_connections != NULL)
+    {
+        for (i = 0; i < m_maxConnections; ++i)
+        {
+            if (m_connections[i].m_buffer != NULL)
+            {
+                erpc_free(m_connections[i].m_buffer);
+            }
+        }
+        delete[] m_connections;
+    }
+
+    if (m_epoll >= 0)
+    {
+        ::close(m_epoll);
+    }
+
+    if (m_wakeEvent >= 0)
+    {
+        ::close(m_wakeEvent);
+    }
+}
+
+erpc_status_t TCPEpollServerTransport::open(void)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    struct addrinfo hints = {};
+    struct addrinfo *res = NULL;
+    struct epoll_event event = {};
+    char portString[8];
+    int yes = 1;
+    uint32_t i;
+
+    if (m_connections == NULL)
+    {
+        m_connections = new (std::nothrow) Connection[m_maxConnections];
+        if (m_connections == NULL)
+        {
+            status = kErpcStatus_MemoryError;
+        }
+        else
+        {
+            for (i = 0; i < m_maxConnections; ++i)
+            {
+                m_connections[i].m_id = 0;
+                m_connections[i].m_buffer = NULL;
+            }
+        }
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        // Build free list of connection slots.
+        for (i = 0; i < m_maxConnections; ++i)
+        {
+            m_connections[i].m_socket = -1;
+            m_connections[i].m_closedSocket = -1;
+            m_connections[i].m_senders = 0;
+            m_connections[i].m_received = 0;
+            m_connections[i].m_expected = 0;
+            m_connections[i].m_nextFree = ((i + 1U) < m_maxConnections) ? (i + 1U) : TCP_EPOLL_NO_SLOT;
+        }
+        m_firstFree = (m_maxConnections > 0U) ? 0U : TCP_EPOLL_NO_SLOT;
+        m_connectionCount = 0;
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        hints.ai_flags = AI_PASSIVE | AI_NUMERICSERV;
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        (void)snprintf(portString, sizeof(portString), "%d", m_port);
+        if (getaddrinfo(m_host, portString, &hints, &res) != 0)
+        {
+            TCP_EPOLL_DEBUG_PRINT("%s", "getaddrinfo failed\n");
+            status = kErpcStatus_UnknownName;
+        }
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        m_serverSocket = socket(res->ai_family, res->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, res->ai_protocol);
+        if ((m_serverSocket < 0) ||
+            (setsockopt(m_serverSocket, SOL_SOCKET, SO_REUSEADDR, (const void *)&yes, sizeof(yes)) < 0) ||
+            (bind(m_serverSocket, res->ai_addr, res->ai_addrlen) < 0) || (listen(m_serverSocket, SOMAXCONN) < 0))
+        {
+            TCP_EPOLL_DEBUG_PRINT("%s", "creating of listening socket failed\n");
+            status = kErpcStatus_Fail;
+        }
+    }
+
+    if (res != NULL)
+    {
+        freeaddrinfo(res);
+    }
+
+    if ((status == kErpcStatus_Success) && (m_epoll < 0))
+    {
+        m_epoll = epoll_create1(EPOLL_CLOEXEC);
+        m_wakeEvent = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if ((m_epoll < 0) || (m_wakeEvent < 0))
+        {
+            status = kErpcStatus_Fail;
+        }
+        else
+        {
+            event.events = EPOLLIN;
+            event.data.u64 = (uint64_t)m_maxConnections + 1U;
+            if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_wakeEvent, &event) < 0)
+            {
+                status = kErpcStatus_Fail;
+            }
+        }
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        // Slot index right above connection table marks listening socket, next one wake event.
+        event.events = EPOLLIN;
+        event.data.u64 = m_maxConnections;
+        if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_serverSocket, &event) < 0)
+        {
+            status = kErpcStatus_Fail;
+        }
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        m_runServer = true;
+    }
+    else
+    {
+        (void)close();
+    }
+
+    return status;
+}
+
+erpc_status_t TCPEpollServerTransport::close(void)
+{
+    uint64_t wake = 1;
+    uint32_t i;
+
+    m_runServer = false;
+
+    if (m_wakeEvent >= 0)
+    {
+        // Wake up receive() blocked in epoll_wait().
+        (void)write(m_wakeEvent, &wake, sizeof(wake));
+    }
+
+    if (m_connections != NULL)
+    {
+        for (i = 0; i < m_maxConnections; ++i)
+        {
+            closeConnection(i);
+        }
+    }
+
+    if (m_serverSocket >= 0)
+    {
+        (void)epoll_ctl(m_epoll, EPOLL_CTL_DEL, m_serverSocket, NULL);
+        ::close(m_serverSocket);
+        m_serverSocket = -1;
+    }
+
+    // Connection table, epoll and eventfd are released in destructor, so woken up receive() never uses freed
+    // memory or closed descriptors.
+    return kErpcStatus_Success;
+}
+
+void TCPEpollServerTransport::acceptConnections(void)
+{
+    int incomingSocket;
+    int yes = 1;
+    uint32_t index;
+    struct epoll_event event = {};
+
+    while (true)
+    {
+        incomingSocket = accept4(m_serverSocket, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (incomingSocket < 0)
+        {
+            // EAGAIN when there is no more pending connections.
+            break;
+        }
+
+        Mutex::Guard lock(m_connectionsLock);
+
+        index = m_firstFree;
+        if (index == TCP_EPOLL_NO_SLOT)
+        {
+            TCP_EPOLL_DEBUG_PRINT("%s", "connection table is full\n");
+            ::close(incomingSocket);
+            continue;
+        }
+
+        Connection &connection = m_connections[index];
+        if (connection.m_buffer == NULL)
+        {
+            connection.m_buffer = reinterpret_cast<uint8_t *>(erpc_malloc(reserveHeaderSize() + m_maxMessageSize));
+            if (connection.m_buffer == NULL)
+            {
+                ::close(incomingSocket);
+                continue;
+            }
+        }
+
+        (void)setsockopt(incomingSocket, IPPROTO_TCP, TCP_NODELAY, (void *)&yes, sizeof(yes));
+
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.u64 = index;
+        if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, incomingSocket, &event) < 0)
+        {
+            ::close(incomingSocket);
+            continue;
+        }
+
+        m_firstFree = connection.m_nextFree;
+        connection.m_socket = incomingSocket;
+        connection.m_id++;
+        connection.m_received = 0;
+        connection.m_expected = reserveHeaderSize();
+        m_connectionCount++;
+
+        TCP_EPOLL_DEBUG_PRINT("accepted connection %u\n", (unsigned)index);
+    }
+}
+
+void TCPEpollServerTransport::closeConnection(uint32_t index)
+{
+    Mutex::Guard lock(m_connectionsLock);
+    Connection &connection = m_connections[index];
+
+    if (connection.m_socket >= 0)
+    {
+        (void)epoll_ctl(m_epoll, EPOLL_CTL_DEL, connection.m_socket, NULL);
+        if (connection.m_senders == 0U)
+        {
+            ::close(connection.m_socket);
+            connection.m_nextFree = m_firstFree;
+            m_firstFree = index;
+        }
+        else
+        {
+            // Wake up send() waiting for the socket. Descriptor and slot are released by the last send().
+            (void)shutdown(connection.m_socket, SHUT_RDWR);
+            connection.m_closedSocket = connection.m_socket;
+        }
+        connection.m_socket = -1;
+        m_connectionCount--;
+
+        TCP_EPOLL_DEBUG_PRINT("closed connection %u\n", (unsigned)index);
+    }
+}
+
+erpc_status_t TCPEpollServerTransport::readConnection(uint32_t index, bool &complete)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    Connection &connection = m_connections[index];
+    uint16_t crcHeader;
+    message_size_t messageSize;
+    uint16_t crcBody;
+    uint16_t computedCrc;
+    ssize_t length;
+
+    complete = false;
+
+    while ((status == kErpcStatus_Success) && !complete)
+    {
+        length = read(connection.m_socket, &connection.m_buffer[connection.m_received],
+                      connection.m_expected - connection.m_received);
+        if (length == 0)
+        {
+            status = kErpcStatus_ConnectionClosed;
+        }
+        else if (length < 0)
+        {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+            {
+                status = kErpcStatus_ReceiveFailed;
+            }
+            // Wait for next event.
+            break;
+        }
+        else
+        {
+            connection.m_received += (uint32_t)length;
+        }
+
+        if ((status == kErpcStatus_Success) && (connection.m_received == connection.m_expected))
+        {
+            if (connection.m_expected == reserveHeaderSize())
+            {
+                // Header is complete, extend frame by message size.
+                (void)memcpy(&crcHeader, &connection.m_buffer[0], sizeof(crcHeader));
+                (void)memcpy(&messageSize, &connection.m_buffer[sizeof(crcHeader)], sizeof(messageSize));
+                (void)memcpy(&crcBody, &connection.m_buffer[sizeof(crcHeader) + sizeof(messageSize)],
+                             sizeof(crcBody));
+
+                ERPC_READ_AGNOSTIC_16(crcHeader);
+#if ERPC_LARGE_MESSAGES
+                ERPC_READ_AGNOSTIC_32(messageSize);
+#else
+                ERPC_READ_AGNOSTIC_16(messageSize);
+#endif
+                ERPC_READ_AGNOSTIC_16(crcBody);
+
+                computedCrc =
+                    m_crcImpl->computeCRC16(reinterpret_cast<const uint8_t *>(&messageSize), sizeof(messageSize)) +
+                    m_crcImpl->computeCRC16(reinterpret_cast<const uint8_t *>(&crcBody), sizeof(crcBody));
+                if (computedCrc != crcHeader)
+                {
+                    status = kErpcStatus_CrcCheckFailed;
+                }
+                else if (messageSize > m_maxMessageSize)
+                {
+                    status = kErpcStatus_ReceiveFailed;
+                }
+                else
+                {
+                    connection.m_expected += messageSize;
+                }
+            }
+
+            if ((status == kErpcStatus_Success) && (connection.m_received == connection.m_expected))
+            {
+                complete = true;
+            }
+        }
+    }
+
+    return status;
+}
+
+erpc_status_t TCPEpollServerTransport::completeFrame(uint32_t index, MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    Connection &connection = m_connections[index];
+    uint16_t crcBody;
+    uint16_t tag[2];
+
+    (void)memcpy(&crcBody, &connection.m_buffer[reserveHeaderSize() - sizeof(crcBody)], sizeof(crcBody));
+    ERPC_READ_AGNOSTIC_16(crcBody);
+
+    if (m_crcImpl->computeCRC16(&connection.m_buffer[reserveHeaderSize()],
+                                connection.m_received - reserveHeaderSize()) != crcBody)
+    {
+        status = kErpcStatus_CrcCheckFailed;
+    }
+    else if (message->getLength() < connection.m_received)
+    {
+        status = kErpcStatus_MemoryError;
+    }
+    else
+    {
+        (void)memcpy(message->get(), connection.m_buffer, connection.m_received);
+        message->setUsed((message_size_t)connection.m_received);
+
+        // Replace received header by reply routing tag. Header is rewritten by send().
+        tag[0] = (uint16_t)index;
+        tag[1] = connection.m_id;
+        (void)memcpy(message->get(), tag, sizeof(tag));
+    }
+
+    // Start next frame.
+    connection.m_received = 0;
+    connection.m_expected = reserveHeaderSize();
+
+    return status;
+}
+
+erpc_status_t TCPEpollServerTransport::receive(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_ReceiveFailed;
+    struct epoll_event events[TCP_EPOLL_EVENTS_COUNT];
+    uint64_t wake;
+    bool received = false;
+    bool complete;
+    uint32_t index;
+    int count;
+    int i;
+
+    erpc_assert((m_crcImpl != NULL) && ("Uninitialized Crc16 object." != NULL));
+
+    if ((message->get() == NULL) || (message->getLength() < reserveHeaderSize()))
+    {
+        status = kErpcStatus_MemoryError;
+        received = true;
+    }
+
+    while (!received)
+    {
+        if (!m_runServer)
+        {
+            status = kErpcStatus_ServerIsDown;
+            break;
+        }
+
+        count = epoll_wait(m_epoll, events, TCP_EPOLL_EVENTS_COUNT, -1);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            status = kErpcStatus_ReceiveFailed;
+            break;
+        }
+
+        // Events which are not processed because of returning frame are reported again (level triggered).
+        for (i = 0; (i < count) && !received && m_runServer; ++i)
+        {
+            index = (uint32_t)events[i].data.u64;
+            if (index == m_maxConnections)
+            {
+                acceptConnections();
+            }
+            else if (index < m_maxConnections)
+            {
+                status = readConnection(index, complete);
+                if ((status == kErpcStatus_Success) && complete)
+                {
+                    status = completeFrame(index, message);
+                    received = (status == kErpcStatus_Success);
+                }
+
+                if (status != kErpcStatus_Success)
+                {
+                    // Only this connection is affected, keep serving other ones.
+                    closeConnection(index);
+                }
+            }
+            else
+            {
+                // Wake event, loop condition handles it.
+                (void)read(m_wakeEvent, &wake, sizeof(wake));
+            }
+        }
+    }
+
+    return received ? kErpcStatus_Success : status;
+}
+
+erpc_status_t TCPEpollServerTransport::send(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    Connection *connection = NULL;
+    int clientSocket = -1;
+    uint16_t tag[2];
+
+    (void)memcpy(tag, message->get(), sizeof(tag));
+
+    {
+        Mutex::Guard lock(m_connectionsLock);
+
+        if ((tag[0] >= m_maxConnections) || (m_connections[tag[0]].m_socket < 0) ||
+            (m_connections[tag[0]].m_id != tag[1]))
+        {
+            // Peer disconnected while request was processed.
+            status = kErpcStatus_ConnectionClosed;
+        }
+        else
+        {
+            // Slot and socket stay reserved for this call even when the connection is closed meanwhile.
+            connection = &m_connections[tag[0]];
+            connection->m_senders++;
+            clientSocket = connection->m_socket;
+        }
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        writeHeader(message);
+
+        {
+            Mutex::Guard sendLock(connection->m_sendLock);
+
+            status = writeSocket(clientSocket, message->get(), message->getUsed());
+        }
+
+        Mutex::Guard lock(m_connectionsLock);
+
+        connection->m_senders--;
+        if ((connection->m_senders == 0U) && (connection->m_closedSocket >= 0))
+        {
+            ::close(connection->m_closedSocket);
+            connection->m_closedSocket = -1;
+            connection->m_nextFree = m_firstFree;
+            m_firstFree = tag[0];
+        }
+    }
+
+    return status;
+}
+
+bool TCPEpollServerTransport::hasMessage(void)
+{
+    struct pollfd pfd;
+
+    pfd.fd = m_epoll;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    return (m_epoll >= 0) && (poll(&pfd, 1, 0) > 0);
+}
+
+erpc_status_t TCPEpollServerTransport::writeSocket(int clientSocket, const uint8_t *data, uint32_t size)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    struct pollfd pfd;
+    ssize_t result;
+
+    // Loop until all data is sent.
+    while (size > 0U)
+    {
+        result = ::send(clientSocket, data, size, MSG_NOSIGNAL);
+        if (result >= 0)
+        {
+            size -= (uint32_t)result;
+            data += result;
+        }
+        else if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+        {
+            // Socket is non-blocking, wait until it is writable again.
+            pfd.fd = clientSocket;
+            pfd.events = POLLOUT;
+            pfd.revents = 0;
+            (void)poll(&pfd, 1, -1);
+        }
+        else if (errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            status = (errno == EPIPE) ? kErpcStatus_ConnectionClosed : kErpcStatus_SendFailed;
+            break;
+        }
+    }
+
+    return status;
+}
+
+erpc_status_t TCPEpollServerTransport::underlyingSend(const uint8_t *data, uint32_t size)
+{
+    (void)data;
+    (void)size;
+
+    return kErpcStatus_Fail;
+}
+
+erpc_status_t TCPEpollServerTransport::underlyingReceive(uint8_t *data, uint32_t size)
+{
+    (void)data;
+    (void)size;
+
+    return kErpcStatus_Fail;
+}
@@ -0,0 +1,230 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _EMBEDDED_RPC__TCP_EPOLL_SERVER_TRANSPORT_H_
+#define _EMBEDDED_RPC__TCP_EPOLL_SERVER_TRANSPORT_H_
+
+#include "erpc_framed_transport.hpp"
+#include "erpc_threading.h"
+
+/*!
+ * @addtogroup tcp_epoll_server_transport
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Server side of TCP/IP transport serving many connections at once.
+ *
+ * All client sockets are multiplexed through one Linux epoll instance, so a single
+ * server thread can serve many peers. Every connection keeps its own framing state,
+ * therefore partially received frames of different peers do not interfere.
+ *
+ * receive() returns the first complete frame from any connection. The connection the
+ * frame came from is remembered inside the reserved frame header space of the message
+ * buffer, and send() uses it to route the reply back to the same socket. This works
+ * with message buffer factories which reuse the request buffer for the reply (dynamic
+ * and static factories).
+ *
+ * Connection errors (peer closed, CRC failure, oversized frame) close only the affected
+ * connection, receive() keeps waiting for the other peers.
+ *
+ * Replies from several server threads are written at once when they go to different
+ * connections. Only replies to the same connection wait for each other, so a slow peer
+ * does not hold up the others.
+ *
+ * @ingroup tcp_epoll_server_transport
+ */
+class TCPEpollServerTransport : public FramedTransport
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * This function initializes object attributes.
+     *
+     * @param[in] host Specify the host name or IP address to listen on. NULL for any address.
+     * @param[in] port Specify the listening port number.
+     * @param[in] maxConnections Maximal amount of simultaneously served connections.
+     * @param[in] maxMessageSize Maximal size of received message (without frame header).
+     */
+    TCPEpollServerTransport(const char *host, uint16_t port, uint32_t maxConnections,
+                            uint32_t maxMessageSize = ERPC_DEFAULT_BUFFER_SIZE);
+
+    /*!
+     * @brief TCPEpollServerTransport destructor
+     */
+    virtual ~TCPEpollServerTransport(void);
+
+    /*!
+     * @brief This function creates listening socket and epoll instance.
+     *
+     * @retval #kErpcStatus_Success When server was created successfully.
+     * @retval #kErpcStatus_UnknownName Host name resolution failed.
+     * @retval #kErpcStatus_MemoryError Connection table could not be allocated.
+     * @retval #kErpcStatus_Fail Creating of socket or epoll instance failed.
+     */
+    erpc_status_t open(void);
+
+    /*!
+     * @brief This function closes all connections and stops the server.
+     *
+     * Blocked receive() call is woken up and returns #kErpcStatus_ServerIsDown.
+     *
+     * @retval #kErpcStatus_Success Always return this.
+     */
+    erpc_status_t close(void);
+
+    /*!
+     * @brief Receives an entire message from any connection.
+     *
+     * @param[in] message Message buffer, to which will be stored incoming message.
+     *
+     * @retval #kErpcStatus_Success When a frame was received.
+     * @retval #kErpcStatus_ServerIsDown When transport was closed.
+     * @retval #kErpcStatus_ReceiveFailed When waiting for events failed.
+     */
+    virtual erpc_status_t receive(MessageBuffer *message) override;
+
+    /*!
+     * @brief Sends a message to the connection from which the request was received.
+     *
+     * The connection table is locked only to look up the connection, the message is written under
+     * the send lock of the connection. Socket of a connection closed meanwhile is shut down to wake
+     * up the writer and closed when the last send() to it returns.
+     *
+     * @param[in] message Message buffer to send.
+     *
+     * @retval #kErpcStatus_Success When sending was successful.
+     * @retval #kErpcStatus_ConnectionClosed Connection of the request is already closed.
+     * @retval #kErpcStatus_SendFailed When writing data ends with error.
+     */
+    virtual erpc_status_t send(MessageBuffer *message) override;
+
+    /*!
+     * @brief Poll for an incoming data on any connection.
+     *
+     * @retval True when some connection has pending data, else false.
+     */
+    virtual bool hasMessage(void) override;
+
+    /*!
+     * @brief Returns amount of currently opened connections.
+     *
+     * @return Amount of opened connections.
+     */
+    uint32_t getConnectionCount(void) const { return m_connectionCount; }
+
+protected:
+    /*! @brief Framing state of one client connection. */
+    struct Connection
+    {
+        int m_socket;        //!< Client socket, -1 when slot is free or connection is closed.
+        int m_closedSocket;  //!< Socket of closed connection still written by send(), else -1.
+        uint16_t m_id;       //!< Generation of slot, increased on each accept.
+        uint32_t m_senders;  //!< Amount of send() calls writing to the socket.
+        Mutex m_sendLock;    //!< Keeps replies written to the socket whole.
+        uint8_t *m_buffer;   //!< Buffer for currently received frame.
+        uint32_t m_received; //!< Amount of bytes of the frame received so far.
+        uint32_t m_expected; //!< Amount of bytes of the frame expected (header, then header + body).
+        uint32_t m_nextFree; //!< Index of next free slot when this slot is free.
+    };
+
+    const char *m_host;          /*!< Specify the host name or IP address to listen on. */
+    uint16_t m_port;             /*!< Specify the listening port number. */
+    uint32_t m_maxConnections;   /*!< Size of connection table. */
+    uint32_t m_maxMessageSize;   /*!< Maximal size of received message body. */
+    int m_serverSocket;          /*!< Listening socket. */
+    int m_epoll;                 /*!< Epoll instance. */
+    int m_wakeEvent;             /*!< Eventfd used for waking up receive() on close(). */
+    Connection *m_connections;   /*!< Connection table. */
+    uint32_t m_firstFree;        /*!< Head of free slot list. */
+    uint32_t m_connectionCount;  /*!< Amount of opened connections. */
+    Mutex m_connectionsLock;     /*!< Guards connection table against concurrent send() and close. */
+    volatile bool m_runServer;   /*!< Cleared by close(). */
+
+    using FramedTransport::underlyingReceive;
+    using FramedTransport::underlyingSend;
+
+    /*!
+     * @brief Not used, send() writes to the socket of the connection.
+     *
+     * @param[in] data Buffer to send.
+     * @param[in] size Size of data to send.
+     *
+     * @retval #kErpcStatus_Fail Always.
+     */
+    virtual erpc_status_t underlyingSend(const uint8_t *data, uint32_t size) override;
+
+    /*!
+     * @brief Not used, frames are assembled per connection in receive().
+     *
+     * @param[inout] data Preallocated buffer for receiving data.
+     * @param[in] size Size of data to read.
+     *
+     * @retval #kErpcStatus_Fail Always.
+     */
+    virtual erpc_status_t underlyingReceive(uint8_t *data, uint32_t size) override;
+
+    /*!
+     * @brief This function writes data to the socket of a connection.
+     *
+     * @param[in] clientSocket Socket of the connection.
+     * @param[in] data Buffer to send.
+     * @param[in] size Size of data to send.
+     *
+     * @retval #kErpcStatus_Success When data was written successfully.
+     * @retval #kErpcStatus_SendFailed When writing data ends with error.
+     * @retval #kErpcStatus_ConnectionClosed Peer closed the connection.
+     */
+    static erpc_status_t writeSocket(int clientSocket, const uint8_t *data, uint32_t size);
+
+    /*!
+     * @brief Accepts all pending connections on listening socket.
+     */
+    void acceptConnections(void);
+
+    /*!
+     * @brief Closes connection and returns its slot to free list.
+     *
+     * @param[in] index Index of connection slot.
+     */
+    void closeConnection(uint32_t index);
+
+    /*!
+     * @brief Reads available data of connection and advances its framing state.
+     *
+     * @param[in] index Index of connection slot.
+     * @param[out] complete Set to true when whole frame was received.
+     *
+     * @retval #kErpcStatus_Success Connection is healthy.
+     * @retval other Connection has to be closed.
+     */
+    erpc_status_t readConnection(uint32_t index, bool &complete);
+
+    /*!
+     * @brief Validates complete frame of connection and copies it into message.
+     *
+     * @param[in] index Index of connection slot.
+     * @param[in] message Message buffer to fill.
+     *
+     * @retval #kErpcStatus_Success Frame is valid and was copied.
+     * @retval other Frame is not valid, connection has to be closed.
+     */
+    erpc_status_t completeFrame(uint32_t index, MessageBuffer *message);
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__TCP_EPOLL_SERVER_TRANSPORT_H_
@@ -75,6 +75,9 @@ m_serverThread(serverThreadStub), m_runServer(true)
     WSADATA ws;
     WSAStartup(MAKEWORD(2, 2), &ws);
 #endif
+#if ERPC_TRANSPORT_READ_AHEAD_SIZE > 0
+    setReadAheadBuffer(m_readAhead, sizeof(m_readAhead));
+#endif
 }
 
 TCPTransport::TCPTransport(const char *host, uint16_t port, bool isServer) :
@@ -93,6 +96,9 @@ m_serverThread(serverThreadStub), m_runServer(true)
     WSADATA ws;
     WSAStartup(MAKEWORD(2, 2), &ws);
 #endif
+#if ERPC_TRANSPORT_READ_AHEAD_SIZE > 0
+    setReadAheadBuffer(m_readAhead, sizeof(m_readAhead));
+#endif
 }
 
 TCPTransport::~TCPTransport(void) {}
@@ -300,6 +306,9 @@ erpc_status_t TCPTransport::close(bool stopServer)
     }
 #endif
 
+    // Data of closed connection are not valid for the next one.
+    resetReadAhead();
+
     return kErpcStatus_Success;
 }
 
@@ -353,6 +362,58 @@ erpc_status_t TCPTransport::underlyingReceive(uint8_t *data, uint32_t size)
     return status;
 }
 
+erpc_status_t TCPTransport::underlyingReceiveAvailable(uint8_t *data, uint32_t minSize, uint32_t maxSize,
+                                                       uint32_t &received)
+{
+    ssize_t length;
+    erpc_status_t status = kErpcStatus_Success;
+
+    received = 0;
+
+    // Block until we have a valid connection.
+#if defined(__MINGW32__)
+    while (m_socket == INVALID_SOCKET)
+#else
+    while (m_socket <= 0)
+#endif
+    {
+        // Sleep 10 ms.
+        Thread::sleep(10000);
+    }
+
+    // Loop until the requested data is received, taking whatever else is already available.
+    while (received < minSize)
+    {
+#if defined(__MINGW32__)
+        length = recv(m_socket, (char *)&data[received], maxSize - received, 0);
+#else
+        length = read(m_socket, &data[received], maxSize - received);
+#endif
+
+        // Length will be zero if the connection is closed.
+        if (length > 0)
+        {
+            received += (uint32_t)length;
+        }
+        else
+        {
+            if (length == 0)
+            {
+                // close socket, not server
+                close(false);
+                status = kErpcStatus_ConnectionClosed;
+            }
+            else
+            {
+                status = kErpcStatus_ReceiveFailed;
+            }
+            break;
+        }
+    }
+
+    return status;
+}
+
 erpc_status_t TCPTransport::underlyingSend(const uint8_t *data, uint32_t size)
 {
     erpc_status_t status = kErpcStatus_Success;
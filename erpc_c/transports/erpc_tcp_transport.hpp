@@ -96,6 +96,9 @@ protected:
 #endif
     Thread m_serverThread; /*!< Pointer to server thread. */
     bool m_runServer;      /*!< Thread is executed while this is true. */
+#if ERPC_TRANSPORT_READ_AHEAD_SIZE > 0
+    uint8_t m_readAhead[ERPC_TRANSPORT_READ_AHEAD_SIZE]; /*!< Read-ahead buffer. */
+#endif
 
     using FramedTransport::underlyingReceive;
     using FramedTransport::underlyingSend;
@@ -120,6 +123,21 @@ protected:
      */
     virtual erpc_status_t underlyingReceive(uint8_t *data, uint32_t size) override;
 
+    /*!
+     * @brief This function reads data available on the socket.
+     *
+     * @param[inout] data Preallocated buffer for receiving data.
+     * @param[in] minSize Size of data to wait for.
+     * @param[in] maxSize Size of buffer.
+     * @param[out] received Size of received data.
+     *
+     * @retval #kErpcStatus_Success When data was read successfully.
+     * @retval #kErpcStatus_ReceiveFailed When reading data ends with error.
+     * @retval #kErpcStatus_ConnectionClosed Peer closed the connection.
+     */
+    virtual erpc_status_t underlyingReceiveAvailable(uint8_t *data, uint32_t minSize, uint32_t maxSize,
+                                                     uint32_t &received) override;
+
     /*!
      * @brief This function writes data.
      *
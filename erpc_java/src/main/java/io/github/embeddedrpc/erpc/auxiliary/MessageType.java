@@ -28,7 +28,17 @@ public enum MessageType {
     /**
      * Notification message.
      */
-    kNotificationMessage(3);
+    kNotificationMessage(3),
+
+    /**
+     * Part of streamed parameter or return value.
+     */
+    kStreamChunkMessage(4),
+
+    /**
+     * Count of stream chunks received, sent back to the sender of chunks.
+     */
+    kStreamAckMessage(5);
 
     private final int value;
 
@@ -66,6 +76,10 @@ public enum MessageType {
               return kReplyMessage;
             case 3:
               return kNotificationMessage;
+            case 4:
+              return kStreamChunkMessage;
+            case 5:
+              return kStreamAckMessage;
             default:
               throw new RuntimeException("Invalid MessageType " + value);
         }
@@ -62,7 +62,9 @@ public class ClientManager {
     public void performRequest(RequestContext request) {
         this.transport.send(request.codec().array());
 
-        if (!request.isOneWay()) {
+        if (request.isOneWay()) {
+            request.codec().release();
+        } else {
             request.codec().setArray(this.transport.receive());
 
             MessageInfo info = request.codec().startReadMessage();
@@ -19,12 +19,13 @@ import java.nio.ByteOrder;
 @SuppressWarnings("checkstyle:MagicNumber")
 public final class BasicCodec implements Codec {
     private static final int BASIC_CODEC_VERSION = 1;
-    private static final int DEFAULT_BUFFER_SIZE = 256;
+    private static final ByteBuffer EMPTY_BUFFER = ByteBuffer.allocate(0).order(ByteOrder.LITTLE_ENDIAN);
 
     private ByteBuffer buffer;
+    private boolean pooled;
 
     /**
-     * Basic codec constructor. Create empty buffer.
+     * Basic codec constructor. Take empty buffer from the buffer pool.
      */
     public BasicCodec() {
         this.reset();
@@ -48,14 +49,28 @@ public final class BasicCodec implements Codec {
             this.buffer.flip();
 
             newBuffer.put(this.buffer);
+            this.release();
             this.buffer = newBuffer;
         }
     }
 
     @Override
     public void reset() {
-        this.buffer = ByteBuffer.allocate(DEFAULT_BUFFER_SIZE)
-                .order(ByteOrder.LITTLE_ENDIAN);
+        if (this.pooled) {
+            this.buffer.clear();
+        } else {
+            this.buffer = BufferPool.acquire();
+            this.pooled = true;
+        }
+    }
+
+    @Override
+    public void release() {
+        if (this.pooled) {
+            BufferPool.release(this.buffer);
+            this.buffer = EMPTY_BUFFER;
+            this.pooled = false;
+        }
     }
 
     @Override
@@ -70,6 +85,7 @@ public final class BasicCodec implements Codec {
 
     @Override
     public void setArray(final byte[] array) {
+        this.release();
         this.buffer = ByteBuffer.wrap(array).order(ByteOrder.LITTLE_ENDIAN);
     }
 
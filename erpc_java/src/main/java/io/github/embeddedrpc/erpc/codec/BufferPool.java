@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+package  io.github.embeddedrpc.erpc.codec;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.concurrent.ArrayBlockingQueue;
+import java.util.concurrent.BlockingQueue;
+
+/**
+ * Pool of codec buffers shared by all threads. Buffers released to the pool are reused by next messages
+ * instead of allocating new buffer for each message.
+ */
+final class BufferPool {
+    /**
+     * Size of pooled buffers.
+     */
+    static final int BUFFER_SIZE = 256;
+
+    /**
+     * Maximal count of buffers kept in the pool, other released buffers are left to garbage collector.
+     */
+    static final int MAX_POOLED_BUFFERS = 64;
+
+    private static final BlockingQueue<ByteBuffer> POOL = new ArrayBlockingQueue<>(MAX_POOLED_BUFFERS);
+
+    private BufferPool() {
+    }
+
+    /**
+     * Take buffer from the pool or allocate new one when the pool is empty.
+     *
+     * @return empty little endian buffer of BUFFER_SIZE bytes
+     */
+    static ByteBuffer acquire() {
+        ByteBuffer buffer = POOL.poll();
+
+        if (buffer == null) {
+            buffer = ByteBuffer.allocate(BUFFER_SIZE).order(ByteOrder.LITTLE_ENDIAN);
+        }
+
+        return buffer;
+    }
+
+    /**
+     * Return buffer taken by acquire() to the pool. Buffer must not be used after release.
+     *
+     * @param buffer buffer to be released
+     */
+    static void release(ByteBuffer buffer) {
+        buffer.clear();
+        POOL.offer(buffer);
+    }
+
+    /**
+     * Return count of buffers in the pool.
+     *
+     * @return count of pooled buffers
+     */
+    static int size() {
+        return POOL.size();
+    }
+}
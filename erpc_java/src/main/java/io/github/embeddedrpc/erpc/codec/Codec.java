@@ -19,6 +19,12 @@ public interface Codec {
      */
     void reset();
 
+    /**
+     * Release codec's buffer for reuse by other codecs. Codec is empty after release.
+     */
+    default void release() {
+    }
+
     /**
      * Return bytea array from code's buffer.
      *
@@ -32,12 +32,16 @@ public final class SimpleServer extends Server {
         byte[] data = getTransport().receive();
         Codec codec = getCodecFactory().create(data);
 
-        processRequest(codec);
+        try {
+            processRequest(codec);
 
-        byte[] responseData = codec.array();
+            byte[] responseData = codec.array();
 
-        if (responseData.length != 0) {
-            getTransport().send(responseData);
+            if (responseData.length != 0) {
+                getTransport().send(responseData);
+            }
+        } finally {
+            codec.release();
         }
     }
 
@@ -6,8 +6,106 @@
 
 package  io.github.embeddedrpc.erpc.server;
 
+import  io.github.embeddedrpc.erpc.codec.Codec;
+import  io.github.embeddedrpc.erpc.codec.CodecFactory;
+import  io.github.embeddedrpc.erpc.transport.RequestError;
+import  io.github.embeddedrpc.erpc.transport.Transport;
+import  io.github.embeddedrpc.erpc.transport.TransportError;
+
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.RejectedExecutionException;
+
 /**
- * Threaded server.
+ * Threaded server. Requests are received by the thread calling run() and processed by the executor, so requests
+ * of several clients (e.g. connections of TCPNioTransport) are processed in parallel. Services must be thread safe.
  */
-public class ThreadServer {
+public final class ThreadServer extends Server {
+    private final ExecutorService executor;
+    private final boolean ownExecutor;
+    private volatile boolean runFlag;
+
+    /**
+     * Create threaded server processing requests by thread pool with thread for each processor.
+     *
+     * @param transport    transport used in server
+     * @param codecFactory codec factory used for creating codec on request
+     */
+    public ThreadServer(Transport transport, CodecFactory codecFactory) {
+        this(transport, codecFactory, Executors.newFixedThreadPool(Runtime.getRuntime().availableProcessors()), true);
+    }
+
+    /**
+     * Create threaded server processing requests by the executor. Executor is not shut down by the server.
+     *
+     * @param transport    transport used in server
+     * @param codecFactory codec factory used for creating codec on request
+     * @param executor     executor processing requests
+     */
+    public ThreadServer(Transport transport, CodecFactory codecFactory, ExecutorService executor) {
+        this(transport, codecFactory, executor, false);
+    }
+
+    private ThreadServer(Transport transport, CodecFactory codecFactory, ExecutorService executor,
+                         boolean ownExecutor) {
+        super(transport, codecFactory);
+        this.executor = executor;
+        this.ownExecutor = ownExecutor;
+    }
+
+    private void receiveRequest() {
+        byte[] data = getTransport().receive();
+        Transport replyTransport = getTransport().replyTransport();
+
+        executor.execute(() -> processRequest(data, replyTransport));
+    }
+
+    private void processRequest(byte[] data, Transport replyTransport) {
+        Codec codec = getCodecFactory().create(data);
+
+        try {
+            processRequest(codec);
+
+            byte[] responseData = codec.array();
+
+            if (responseData.length != 0) {
+                replyTransport.send(responseData);
+            }
+        } catch (RuntimeException e) {
+            // Error of one request does not stop processing of other ones.
+            System.err.println("Error while processing request: " + e);
+        } finally {
+            codec.release();
+        }
+    }
+
+    @Override
+    public void run() {
+        runFlag = true;
+
+        while (runFlag) {
+            try {
+                receiveRequest();
+            } catch (TransportError e) {
+                System.err.println("Transport error: " + e);
+                stop();
+            } catch (RequestError e) {
+                System.err.println("Error while receiving request: " + e);
+                stop();
+            } catch (RejectedExecutionException e) {
+                System.err.println("Executor rejected request: " + e);
+                stop();
+            }
+        }
+
+        if (ownExecutor) {
+            executor.shutdown();
+        }
+    }
+
+    @Override
+    public void stop() {
+        runFlag = false;
+    }
+
 }
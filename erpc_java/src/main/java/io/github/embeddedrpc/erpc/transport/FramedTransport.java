@@ -11,6 +11,8 @@ import  io.github.embeddedrpc.erpc.auxiliary.Utils;
 import  io.github.embeddedrpc.erpc.codec.BasicCodec;
 import  io.github.embeddedrpc.erpc.codec.Codec;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.concurrent.locks.Lock;
 import java.util.concurrent.locks.ReentrantLock;
 
@@ -63,26 +65,21 @@ public abstract class FramedTransport implements Transport {
         try {
             sendLock.lock();
 
-            Codec codec = new BasicCodec();
-
             int messageLength = message.length;
             int crcBody = crc16.computeCRC16(message);
             int crcHeader = crc16.computeCRC16(Utils.uInt16ToBytes(messageLength))
                     + crc16.computeCRC16(Utils.uInt16ToBytes(crcBody));
             crcHeader &= 0xFFFF; // 2 bytes
 
-            codec.writeUInt16(crcHeader);
-            codec.writeUInt16(messageLength);
-            codec.writeUInt16(crcBody);
-
-            byte[] header = codec.array();
-
-            assert header.length == HEADER_LEN;
+            // Header is written straight to the frame, no codec buffer is taken from the pool.
+            ByteBuffer frame = ByteBuffer.allocate(HEADER_LEN + messageLength).order(ByteOrder.LITTLE_ENDIAN);
 
-            byte[] data = new byte[message.length + header.length];
+            frame.putShort((short) crcHeader);
+            frame.putShort((short) messageLength);
+            frame.putShort((short) crcBody);
+            frame.put(message);
 
-            System.arraycopy(header, 0, data, 0, header.length);
-            System.arraycopy(message, 0, data, header.length, message.length);
+            byte[] data = frame.array();
 
             baseSend(data);
         } finally {
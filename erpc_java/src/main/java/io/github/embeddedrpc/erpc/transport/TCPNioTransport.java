@@ -0,0 +1,336 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+package  io.github.embeddedrpc.erpc.transport;
+
+import java.io.IOException;
+import java.net.InetSocketAddress;
+import java.net.StandardSocketOptions;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.ClosedSelectorException;
+import java.nio.channels.SelectionKey;
+import java.nio.channels.Selector;
+import java.nio.channels.ServerSocketChannel;
+import java.nio.channels.SocketChannel;
+import java.util.Iterator;
+import java.util.Queue;
+import java.util.Set;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentLinkedQueue;
+import java.util.concurrent.LinkedBlockingQueue;
+
+/**
+ * Server side TCP transport serving many client connections by one selector thread.
+ * <p>
+ * Selector thread accepts connections, reads frames of all of them and writes queued replies. Received messages
+ * are returned by receive() in order of arrival. Reply is sent to the connection of the message received last by
+ * the calling thread, other threads get the connection by replyTransport().
+ */
+public final class TCPNioTransport implements Transport {
+    private static final int HEADER_LEN = 6;
+    private static final int LENGTH_OFFSET = 2;
+    private static final int INPUT_BUFFER_SIZE = 256;
+
+    private static final Received CLOSED = new Received(null, null);
+
+    private final ServerSocketChannel serverChannel;
+    private final Selector selector;
+    private final BlockingQueue<Received> received = new LinkedBlockingQueue<>();
+    private final Queue<Connection> pendingWrites = new ConcurrentLinkedQueue<>();
+    private final Set<Connection> connections = ConcurrentHashMap.newKeySet();
+    private final ThreadLocal<Connection> lastConnection = new ThreadLocal<>();
+    private volatile boolean closed;
+
+    /**
+     * Create TCP transport listening on the port.
+     *
+     * @param port TCP port
+     * @throws IOException TCP error
+     */
+    public TCPNioTransport(int port) throws IOException {
+        this(new InetSocketAddress(port));
+    }
+
+    /**
+     * Create TCP transport listening on the address.
+     *
+     * @param host IP or host name of the server interface
+     * @param port TCP port
+     * @throws IOException TCP error
+     */
+    public TCPNioTransport(String host, int port) throws IOException {
+        this(new InetSocketAddress(host, port));
+    }
+
+    private TCPNioTransport(InetSocketAddress address) throws IOException {
+        selector = Selector.open();
+        serverChannel = ServerSocketChannel.open();
+
+        try {
+            serverChannel.setOption(StandardSocketOptions.SO_REUSEADDR, true);
+            serverChannel.bind(address);
+            serverChannel.configureBlocking(false);
+            serverChannel.register(selector, SelectionKey.OP_ACCEPT);
+        } catch (IOException e) {
+            serverChannel.close();
+            selector.close();
+            throw e;
+        }
+
+        Thread selectorThread = new Thread(this::runSelector, "erpc-tcp-nio");
+        selectorThread.setDaemon(true);
+        selectorThread.start();
+    }
+
+    @Override
+    public byte[] receive() {
+        Received message;
+
+        try {
+            message = received.take();
+        } catch (InterruptedException e) {
+            Thread.currentThread().interrupt();
+            throw new TransportError("Receiving TCP data interrupted.", e);
+        }
+
+        if (message == CLOSED) {
+            // Wake up other receiving threads too.
+            received.offer(CLOSED);
+            throw new TransportError("TCP transport closed.");
+        }
+
+        lastConnection.set(message.connection);
+        return message.data;
+    }
+
+    @Override
+    public void send(byte[] message) {
+        replyTransport().send(message);
+    }
+
+    @Override
+    public Transport replyTransport() {
+        Connection connection = lastConnection.get();
+
+        if (connection == null) {
+            throw new TransportError("No message was received by this thread.");
+        }
+
+        return connection;
+    }
+
+    /**
+     * Return port the transport listens on, e.g. the one chosen by the system for port 0.
+     *
+     * @return TCP port
+     */
+    public int getPort() {
+        return serverChannel.socket().getLocalPort();
+    }
+
+    /**
+     * Function closes the listening socket and all connections.
+     */
+    @Override
+    public void close() {
+        closed = true;
+
+        try {
+            selector.close();
+            serverChannel.close();
+        } catch (IOException e) {
+            throw new TransportError("Error closing TCP transport", e);
+        } finally {
+            for (Connection connection : connections) {
+                connection.close();
+            }
+            received.offer(CLOSED);
+        }
+    }
+
+    private void runSelector() {
+        try {
+            while (!closed) {
+                selector.select();
+
+                for (Connection connection = pendingWrites.poll(); connection != null;
+                     connection = pendingWrites.poll()) {
+                    connection.write();
+                }
+
+                Iterator<SelectionKey> keys = selector.selectedKeys().iterator();
+
+                while (keys.hasNext()) {
+                    SelectionKey key = keys.next();
+                    keys.remove();
+
+                    if (!key.isValid()) {
+                        continue;
+                    }
+
+                    if (key.isAcceptable()) {
+                        accept();
+                    } else {
+                        Connection connection = (Connection) key.attachment();
+
+                        if (key.isReadable()) {
+                            connection.read();
+                        }
+                        if (key.isValid() && key.isWritable()) {
+                            connection.write();
+                        }
+                    }
+                }
+            }
+        } catch (ClosedSelectorException e) {
+            // Transport was closed.
+        } catch (IOException e) {
+            if (!closed) {
+                System.err.println("TCP transport error: " + e);
+                close();
+            }
+        }
+    }
+
+    private void accept() throws IOException {
+        SocketChannel channel = serverChannel.accept();
+
+        if (channel != null) {
+            Connection connection = new Connection(channel);
+
+            try {
+                channel.configureBlocking(false);
+                channel.setOption(StandardSocketOptions.TCP_NODELAY, true);
+                connection.key = channel.register(selector, SelectionKey.OP_READ, connection);
+                connections.add(connection);
+            } catch (IOException e) {
+                System.err.println("Error accepting TCP connection: " + e);
+                connection.close();
+            }
+        }
+    }
+
+    /**
+     * Message received from a connection.
+     */
+    private static final class Received {
+        private final Connection connection;
+        private final byte[] data;
+
+        Received(Connection connection, byte[] data) {
+            this.connection = connection;
+            this.data = data;
+        }
+    }
+
+    /**
+     * One client connection. Frames are decoded by FramedTransport from the input buffer when they are complete,
+     * sent frames are queued and written by the selector thread.
+     */
+    private final class Connection extends FramedTransport {
+        private final SocketChannel channel;
+        private final Queue<ByteBuffer> output = new ConcurrentLinkedQueue<>();
+        private ByteBuffer input = ByteBuffer.allocate(INPUT_BUFFER_SIZE).order(ByteOrder.LITTLE_ENDIAN);
+        private SelectionKey key;
+
+        Connection(SocketChannel channel) {
+            this.channel = channel;
+        }
+
+        void read() {
+            try {
+                if (channel.read(input) < 0) {
+                    close();
+                    return;
+                }
+            } catch (IOException e) {
+                close();
+                return;
+            }
+
+            input.flip();
+
+            while (input.remaining() >= HEADER_LEN) {
+                int frameLength = HEADER_LEN
+                        + Short.toUnsignedInt(input.getShort(input.position() + LENGTH_OFFSET));
+
+                if (input.remaining() < frameLength) {
+                    if (input.capacity() < frameLength) {
+                        ByteBuffer newInput = ByteBuffer.allocate(frameLength).order(ByteOrder.LITTLE_ENDIAN);
+                        newInput.put(input);
+                        newInput.flip();
+                        input = newInput;
+                    }
+                    break;
+                }
+
+                try {
+                    received.offer(new Received(this, receive()));
+                } catch (RequestError e) {
+                    System.err.println("Invalid message received, closing connection: " + e);
+                    close();
+                    return;
+                }
+            }
+
+            input.compact();
+        }
+
+        void write() {
+            if (!key.isValid()) {
+                // Connection was closed.
+                return;
+            }
+
+            try {
+                for (ByteBuffer data = output.peek(); data != null; data = output.peek()) {
+                    channel.write(data);
+
+                    if (data.hasRemaining()) {
+                        key.interestOps(SelectionKey.OP_READ | SelectionKey.OP_WRITE);
+                        return;
+                    }
+                    output.poll();
+                }
+                key.interestOps(SelectionKey.OP_READ);
+            } catch (IOException e) {
+                close();
+            }
+        }
+
+        @Override
+        void baseSend(byte[] data) {
+            if (!channel.isOpen()) {
+                throw new TransportError("TCP connection closed.");
+            }
+
+            output.add(ByteBuffer.wrap(data));
+            pendingWrites.add(this);
+            selector.wakeup();
+        }
+
+        @Override
+        byte[] baseReceive(int count) {
+            byte[] data = new byte[count];
+            input.get(data);
+            return data;
+        }
+
+        @Override
+        public void close() {
+            connections.remove(this);
+
+            try {
+                channel.close();
+            } catch (IOException e) {
+                // Called also by the selector thread, connection is dropped anyway.
+                System.err.println("Error closing TCP connection: " + e);
+            }
+        }
+    }
+}
@@ -24,6 +24,16 @@ public interface Transport {
      */
     byte[] receive();
 
+    /**
+     * Return transport for sending reply to the message received last by the calling thread.
+     * Transports serving several connections return the connection the message came from.
+     *
+     * @return transport used for the reply
+     */
+    default Transport replyTransport() {
+        return this;
+    }
+
     /**
      * Close transport layer.
      */
@@ -3,12 +3,14 @@ package  io.github.embeddedrpc.erpc.codec;
 import  io.github.embeddedrpc.erpc.auxiliary.MessageInfo;
 import  io.github.embeddedrpc.erpc.auxiliary.MessageType;
 import  io.github.embeddedrpc.erpc.auxiliary.Utils;
+import java.nio.ByteBuffer;
 import java.util.Arrays;
 import org.junit.jupiter.api.Test;
 
 import static org.junit.jupiter.api.Assertions.assertArrayEquals;
 import static org.junit.jupiter.api.Assertions.assertDoesNotThrow;
 import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertSame;
 import static org.junit.jupiter.api.Assertions.assertThrows;
 
 /**
@@ -364,4 +366,74 @@ class BasicCodecTest {
         assertEquals((byte) 0xFF, array[7]);
 
     }
+
+    @Test
+    void pooledBufferResetTest() {
+        Codec codec = new BasicCodec();
+
+        codec.writeInt32(1);
+        ByteBuffer buffer = codec.getBuffer();
+
+        // Reset reuses the pooled buffer.
+        codec.reset();
+
+        assertSame(buffer, codec.getBuffer());
+        assertEquals(0, codec.array().length);
+    }
+
+    @Test
+    void pooledBufferReleaseTest() {
+        drainPool();
+
+        Codec codec = new BasicCodec();
+
+        codec.writeInt32(1);
+        ByteBuffer buffer = codec.getBuffer();
+        codec.release();
+
+        assertEquals(1, BufferPool.size());
+        assertEquals(0, codec.array().length);
+
+        // Released codec can be used again, it takes the released buffer back.
+        codec.reset();
+
+        assertSame(buffer, codec.getBuffer());
+        assertEquals(0, BufferPool.size());
+
+        codec.writeInt32(2);
+
+        assertArrayEquals(new byte[] {2, 0, 0, 0}, codec.array());
+    }
+
+    @Test
+    void pooledBufferGrowTest() {
+        drainPool();
+
+        Codec codec = new BasicCodec();
+        byte[] data = new byte[BufferPool.BUFFER_SIZE * 2];
+
+        Arrays.fill(data, (byte) 42);
+        codec.writeBinary(data);
+
+        // Pooled buffer is returned to the pool when replaced by bigger one.
+        assertEquals(1, BufferPool.size());
+
+        codec.getBuffer().position(0);
+
+        assertArrayEquals(data, codec.readBinary());
+
+        // Bigger buffer is not pooled.
+        codec.release();
+
+        assertEquals(1, BufferPool.size());
+    }
+
+    /**
+     * Empty the pool shared by all tests, so it has room for released buffers.
+     */
+    private static void drainPool() {
+        while (BufferPool.size() > 0) {
+            BufferPool.acquire();
+        }
+    }
 }
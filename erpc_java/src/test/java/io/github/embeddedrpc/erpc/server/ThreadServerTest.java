@@ -0,0 +1,112 @@
+package  io.github.embeddedrpc.erpc.server;
+
+import  io.github.embeddedrpc.erpc.auxiliary.MessageInfo;
+import  io.github.embeddedrpc.erpc.auxiliary.MessageType;
+import  io.github.embeddedrpc.erpc.auxiliary.RequestContext;
+import  io.github.embeddedrpc.erpc.client.ClientManager;
+import  io.github.embeddedrpc.erpc.codec.BasicCodecFactory;
+import  io.github.embeddedrpc.erpc.codec.Codec;
+import  io.github.embeddedrpc.erpc.transport.TCPNioTransport;
+import  io.github.embeddedrpc.erpc.transport.TCPTransport;
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.TimeUnit;
+import org.junit.jupiter.api.Test;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+
+/**
+ * Round trip tests of ThreadServer with TCPNioTransport.
+ */
+@SuppressWarnings("magicnumber")
+class ThreadServerTest {
+    private static final String HOST = "127.0.0.1";
+    private static final int SERVICE_ID = 1;
+    private static final int ADD_ID = 1;
+    private static final int CLIENTS_COUNT = 4;
+    private static final int CALLS_COUNT = 100;
+
+    /**
+     * Service adding two numbers.
+     */
+    private static final class AddService extends Service {
+        AddService() {
+            super(SERVICE_ID);
+            addMethodHandler(ADD_ID, this::addHandler);
+        }
+
+        private void addHandler(int sequence, Codec codec) {
+            int a = codec.readInt32();
+            int b = codec.readInt32();
+
+            codec.reset();
+
+            codec.startWriteMessage(new MessageInfo(MessageType.kReplyMessage, getServiceId(), ADD_ID, sequence));
+            codec.writeInt32(a + b);
+        }
+    }
+
+    @Test
+    void tcpNioRoundTripTest() throws Exception {
+        TCPNioTransport transport = new TCPNioTransport(HOST, 0);
+        ThreadServer server = new ThreadServer(transport, new BasicCodecFactory());
+        Thread serverThread = new Thread(server::run);
+        ExecutorService clients = Executors.newFixedThreadPool(CLIENTS_COUNT);
+        List<Future<?>> results = new ArrayList<>();
+
+        server.addService(new AddService());
+        serverThread.start();
+
+        try {
+            // Clients call the server at the same time, each one over its own connection.
+            for (int client = 0; client < CLIENTS_COUNT; client++) {
+                int base = client * 1000;
+
+                results.add(clients.submit(() -> {
+                    callAdd(transport.getPort(), base);
+                    return null;
+                }));
+            }
+
+            for (Future<?> result : results) {
+                result.get(10, TimeUnit.SECONDS);
+            }
+        } finally {
+            clients.shutdownNow();
+            server.stop();
+            transport.close();
+            serverThread.join(TimeUnit.SECONDS.toMillis(10));
+        }
+
+        assertFalse(serverThread.isAlive());
+    }
+
+    private static void callAdd(int port, int base) throws IOException {
+        TCPTransport transport = new TCPTransport(HOST, port);
+
+        try {
+            ClientManager clientManager = new ClientManager(transport, new BasicCodecFactory());
+
+            for (int i = 0; i < CALLS_COUNT; i++) {
+                RequestContext request = clientManager.createRequest(false);
+                Codec codec = request.codec();
+
+                codec.startWriteMessage(new MessageInfo(MessageType.kInvocationMessage, SERVICE_ID, ADD_ID,
+                        request.sequence()));
+                codec.writeInt32(base);
+                codec.writeInt32(i);
+
+                clientManager.performRequest(request);
+
+                assertEquals(base + i, codec.readInt32());
+            }
+        } finally {
+            transport.close();
+        }
+    }
+}
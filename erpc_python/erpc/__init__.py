@@ -11,12 +11,17 @@ if "IS_YOCTO" in os.environ:
     from . import erpc_version
 else:
     from . import arbitrator
+    from . import async_client
+    from . import async_server
+    from . import async_transport
     from . import basic_codec
     from . import codec
+    from . import compact_codec
     from . import client
     from . import crc16
     from . import server
     from . import simple_server
+    from . import stream
     from . import transport
 
 class Reference(object):
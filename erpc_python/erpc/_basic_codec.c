@@ -0,0 +1,624 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Optional C implementation of value coding of erpc.basic_codec.BasicCodec.
+ *
+ * Values are written little endian with fixed size, exactly as by PyBasicCodecCore. Errors are reported
+ * with the same exception types as the struct module functions used by the Python implementation.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <structmember.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#if PY_VERSION_HEX < 0x030B0000
+#define PyFloat_Pack4 _PyFloat_Pack4
+#define PyFloat_Pack8 _PyFloat_Pack8
+#define PyFloat_Unpack4 _PyFloat_Unpack4
+#define PyFloat_Unpack8 _PyFloat_Unpack8
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+    PyObject_HEAD PyObject *buffer; /*!< Message data, bytearray when writing. */
+    Py_ssize_t cursor;              /*!< Read position. */
+} CoreObject;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+static PyObject *s_structError = NULL; /*!< struct.error exception type. */
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+static int appendData(CoreObject *self, const void *data, Py_ssize_t size)
+{
+    int result = 0;
+
+    if ((self->buffer != NULL) && PyByteArray_CheckExact(self->buffer))
+    {
+        Py_ssize_t used = PyByteArray_GET_SIZE(self->buffer);
+        result = PyByteArray_Resize(self->buffer, used + size);
+        if (result == 0)
+        {
+            memcpy(PyByteArray_AS_STRING(self->buffer) + used, data, (size_t)size);
+        }
+    }
+    else
+    {
+        // Other buffer types are extended as by Python += operator.
+        PyObject *bytes = PyBytes_FromStringAndSize((const char *)data, size);
+        PyObject *extended = NULL;
+        if (bytes != NULL)
+        {
+            extended = PyNumber_InPlaceAdd((self->buffer != NULL) ? self->buffer : Py_None, bytes);
+            Py_DECREF(bytes);
+        }
+        if (extended == NULL)
+        {
+            result = -1;
+        }
+        else
+        {
+            Py_XSETREF(self->buffer, extended);
+        }
+    }
+
+    return result;
+}
+
+static int writeData(CoreObject *self, const void *data, Py_ssize_t size)
+{
+    int result = appendData(self, data, size);
+
+    if (result == 0)
+    {
+        self->cursor += size;
+    }
+
+    return result;
+}
+
+static int writeUnsigned(CoreObject *self, PyObject *value, unsigned int size, unsigned long long maxValue)
+{
+    int result = -1;
+    unsigned char data[8];
+    unsigned long long number;
+    unsigned int i;
+    PyObject *index = PyNumber_Index(value);
+
+    if (index == NULL)
+    {
+        PyErr_SetString(s_structError, "required argument is not an integer");
+    }
+    else
+    {
+        number = PyLong_AsUnsignedLongLong(index);
+        Py_DECREF(index);
+        if ((PyErr_Occurred() != NULL) || (number > maxValue))
+        {
+            PyErr_Clear();
+            PyErr_Format(s_structError, "argument out of range");
+        }
+        else
+        {
+            for (i = 0; i < size; ++i)
+            {
+                data[i] = (unsigned char)(number >> (8U * i));
+            }
+            result = writeData(self, data, size);
+        }
+    }
+
+    return result;
+}
+
+static int writeSigned(CoreObject *self, PyObject *value, unsigned int size, long long minValue, long long maxValue)
+{
+    int result = -1;
+    unsigned char data[8];
+    long long number;
+    unsigned int i;
+    PyObject *index = PyNumber_Index(value);
+
+    if (index == NULL)
+    {
+        PyErr_SetString(s_structError, "required argument is not an integer");
+    }
+    else
+    {
+        number = PyLong_AsLongLong(index);
+        Py_DECREF(index);
+        if ((PyErr_Occurred() != NULL) || (number < minValue) || (number > maxValue))
+        {
+            PyErr_Clear();
+            PyErr_Format(s_structError, "argument out of range");
+        }
+        else
+        {
+            for (i = 0; i < size; ++i)
+            {
+                data[i] = (unsigned char)((unsigned long long)number >> (8U * i));
+            }
+            result = writeData(self, data, size);
+        }
+    }
+
+    return result;
+}
+
+/*!
+ * @brief Get pointer to size bytes at cursor and move cursor behind them.
+ *
+ * @return Zero on success, view has to be released by caller.
+ */
+static int readData(CoreObject *self, Py_buffer *view, Py_ssize_t size, const unsigned char **data)
+{
+    int result = -1;
+
+    if (self->buffer == NULL)
+    {
+        PyErr_SetString(s_structError, "no buffer to read from");
+    }
+    else if (PyObject_GetBuffer(self->buffer, view, PyBUF_SIMPLE) == 0)
+    {
+        if ((self->cursor < 0) || (self->cursor > view->len) || (size > (view->len - self->cursor)))
+        {
+            PyErr_Format(s_structError,
+                         "unpack_from requires a buffer of at least %zd bytes for unpacking %zd bytes at offset %zd "
+                         "(actual buffer size is %zd)",
+                         self->cursor + size, size, self->cursor, view->len);
+            PyBuffer_Release(view);
+        }
+        else
+        {
+            *data = (const unsigned char *)view->buf + self->cursor;
+            self->cursor += size;
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+static int readUnsigned(CoreObject *self, unsigned int size, unsigned long long *number)
+{
+    Py_buffer view;
+    const unsigned char *data;
+    unsigned int i;
+    int result = readData(self, &view, size, &data);
+
+    if (result == 0)
+    {
+        *number = 0;
+        for (i = 0; i < size; ++i)
+        {
+            *number |= (unsigned long long)data[i] << (8U * i);
+        }
+        PyBuffer_Release(&view);
+    }
+
+    return result;
+}
+
+static PyObject *readSigned(CoreObject *self, unsigned int size)
+{
+    PyObject *result = NULL;
+    unsigned long long number;
+    unsigned long long sign = 1ULL << ((8U * size) - 1U);
+
+    if (readUnsigned(self, size, &number) == 0)
+    {
+        // Sign extension.
+        result = PyLong_FromLongLong((long long)((number ^ sign) - sign));
+    }
+
+    return result;
+}
+
+static PyObject *readUnsignedObject(CoreObject *self, unsigned int size)
+{
+    PyObject *result = NULL;
+    unsigned long long number;
+
+    if (readUnsigned(self, size, &number) == 0)
+    {
+        result = PyLong_FromUnsignedLongLong(number);
+    }
+
+    return result;
+}
+
+#define RETURN_NONE_IF_OK(call) \
+    if ((call) != 0)            \
+    {                           \
+        return NULL;            \
+    }                           \
+    Py_RETURN_NONE
+
+static PyObject *Core_write_bool(CoreObject *self, PyObject *value)
+{
+    unsigned char data;
+    int truth = PyObject_IsTrue(value);
+
+    if (truth < 0)
+    {
+        return NULL;
+    }
+    data = (unsigned char)truth;
+    RETURN_NONE_IF_OK(writeData(self, &data, 1));
+}
+
+static PyObject *Core_write_int8(CoreObject *self, PyObject *value)
+{
+    RETURN_NONE_IF_OK(writeSigned(self, value, 1, INT8_MIN, INT8_MAX));
+}
+
+static PyObject *Core_write_int16(CoreObject *self, PyObject *value)
+{
+    RETURN_NONE_IF_OK(writeSigned(self, value, 2, INT16_MIN, INT16_MAX));
+}
+
+static PyObject *Core_write_int32(CoreObject *self, PyObject *value)
+{
+    RETURN_NONE_IF_OK(writeSigned(self, value, 4, INT32_MIN, INT32_MAX));
+}
+
+static PyObject *Core_write_int64(CoreObject *self, PyObject *value)
+{
+    RETURN_NONE_IF_OK(writeSigned(self, value, 8, INT64_MIN, INT64_MAX));
+}
+
+static PyObject *Core_write_uint8(CoreObject *self, PyObject *value)
+{
+    RETURN_NONE_IF_OK(writeUnsigned(self, value, 1, UINT8_MAX));
+}
+
+static PyObject *Core_write_uint16(CoreObject *self, PyObject *value)
+{
+    RETURN_NONE_IF_OK(writeUnsigned(self, value, 2, UINT16_MAX));
+}
+
+static PyObject *Core_write_uint32(CoreObject *self, PyObject *value)
+{
+    RETURN_NONE_IF_OK(writeUnsigned(self, value, 4, UINT32_MAX));
+}
+
+static PyObject *Core_write_uint64(CoreObject *self, PyObject *value)
+{
+    RETURN_NONE_IF_OK(writeUnsigned(self, value, 8, UINT64_MAX));
+}
+
+static PyObject *Core_write_float(CoreObject *self, PyObject *value)
+{
+    unsigned char data[4];
+    double number = PyFloat_AsDouble(value);
+
+    if ((number == -1.0) && (PyErr_Occurred() != NULL))
+    {
+        PyErr_Clear();
+        PyErr_SetString(s_structError, "required argument is not a float");
+        return NULL;
+    }
+    if (PyFloat_Pack4(number, (void *)data, 1) != 0)
+    {
+        return NULL;
+    }
+    RETURN_NONE_IF_OK(writeData(self, data, 4));
+}
+
+static PyObject *Core_write_double(CoreObject *self, PyObject *value)
+{
+    unsigned char data[8];
+    double number = PyFloat_AsDouble(value);
+
+    if ((number == -1.0) && (PyErr_Occurred() != NULL))
+    {
+        PyErr_Clear();
+        PyErr_SetString(s_structError, "required argument is not a float");
+        return NULL;
+    }
+    if (PyFloat_Pack8(number, (void *)data, 1) != 0)
+    {
+        return NULL;
+    }
+    RETURN_NONE_IF_OK(writeData(self, data, 8));
+}
+
+static PyObject *Core_write_binary(CoreObject *self, PyObject *value)
+{
+    Py_buffer view;
+    PyObject *length;
+    int result;
+
+    if (PyObject_GetBuffer(value, &view, PyBUF_SIMPLE) != 0)
+    {
+        return NULL;
+    }
+    length = PyLong_FromSsize_t(view.len);
+    result = (length == NULL) ? -1 : writeUnsigned(self, length, 4, UINT32_MAX);
+    Py_XDECREF(length);
+    if (result == 0)
+    {
+        // Data are appended without moving cursor, as by the Python implementation.
+        result = appendData(self, view.buf, view.len);
+    }
+    PyBuffer_Release(&view);
+    RETURN_NONE_IF_OK(result);
+}
+
+static PyObject *Core_write_string(CoreObject *self, PyObject *value)
+{
+    PyObject *result;
+    PyObject *encoded = PyUnicode_AsUTF8String(value);
+
+    if (encoded == NULL)
+    {
+        return NULL;
+    }
+    result = Core_write_binary(self, encoded);
+    Py_DECREF(encoded);
+    return result;
+}
+
+static PyObject *Core_write_null_flag(CoreObject *self, PyObject *value)
+{
+    unsigned char data;
+    int truth = PyObject_IsTrue(value);
+
+    if (truth < 0)
+    {
+        return NULL;
+    }
+    data = (truth != 0) ? 1U : 0U;
+    RETURN_NONE_IF_OK(writeData(self, &data, 1));
+}
+
+static PyObject *Core_read_bool(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    unsigned long long number;
+
+    if (readUnsigned(self, 1, &number) != 0)
+    {
+        return NULL;
+    }
+    return PyBool_FromLong(number != 0U);
+}
+
+static PyObject *Core_read_int8(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    return readSigned(self, 1);
+}
+
+static PyObject *Core_read_int16(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    return readSigned(self, 2);
+}
+
+static PyObject *Core_read_int32(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    return readSigned(self, 4);
+}
+
+static PyObject *Core_read_int64(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    return readSigned(self, 8);
+}
+
+static PyObject *Core_read_uint8(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    return readUnsignedObject(self, 1);
+}
+
+static PyObject *Core_read_uint16(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    return readUnsignedObject(self, 2);
+}
+
+static PyObject *Core_read_uint32(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    return readUnsignedObject(self, 4);
+}
+
+static PyObject *Core_read_uint64(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    return readUnsignedObject(self, 8);
+}
+
+static PyObject *Core_read_float(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    PyObject *result = NULL;
+    Py_buffer view;
+    const unsigned char *data;
+    double number;
+
+    if (readData(self, &view, 4, &data) == 0)
+    {
+        number = PyFloat_Unpack4((const char *)data, 1);
+        PyBuffer_Release(&view);
+        if (!((number == -1.0) && (PyErr_Occurred() != NULL)))
+        {
+            result = PyFloat_FromDouble(number);
+        }
+    }
+
+    return result;
+}
+
+static PyObject *Core_read_double(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    PyObject *result = NULL;
+    Py_buffer view;
+    const unsigned char *data;
+    double number;
+
+    if (readData(self, &view, 8, &data) == 0)
+    {
+        number = PyFloat_Unpack8((const char *)data, 1);
+        PyBuffer_Release(&view);
+        if (!((number == -1.0) && (PyErr_Occurred() != NULL)))
+        {
+            result = PyFloat_FromDouble(number);
+        }
+    }
+
+    return result;
+}
+
+static PyObject *Core_read_binary(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    PyObject *result = NULL;
+    unsigned long long length;
+
+    if (readUnsigned(self, 4, &length) == 0)
+    {
+        // Slice of the buffer, shorter when data are missing, as by the Python implementation.
+        result = PySequence_GetSlice(self->buffer, self->cursor, self->cursor + (Py_ssize_t)length);
+        if (result != NULL)
+        {
+            self->cursor += (Py_ssize_t)length;
+        }
+    }
+
+    return result;
+}
+
+static PyObject *Core_read_string(CoreObject *self, PyObject *Py_UNUSED(args))
+{
+    PyObject *result = NULL;
+    PyObject *data = Core_read_binary(self, NULL);
+
+    if (data != NULL)
+    {
+        result = PyObject_CallMethod(data, "decode", NULL);
+        Py_DECREF(data);
+    }
+
+    return result;
+}
+
+static PyMethodDef Core_methods[] = {
+    { "write_bool", (PyCFunction)Core_write_bool, METH_O, NULL },
+    { "write_int8", (PyCFunction)Core_write_int8, METH_O, NULL },
+    { "write_int16", (PyCFunction)Core_write_int16, METH_O, NULL },
+    { "write_int32", (PyCFunction)Core_write_int32, METH_O, NULL },
+    { "write_int64", (PyCFunction)Core_write_int64, METH_O, NULL },
+    { "write_uint8", (PyCFunction)Core_write_uint8, METH_O, NULL },
+    { "write_uint16", (PyCFunction)Core_write_uint16, METH_O, NULL },
+    { "write_uint32", (PyCFunction)Core_write_uint32, METH_O, NULL },
+    { "write_uint64", (PyCFunction)Core_write_uint64, METH_O, NULL },
+    { "write_float", (PyCFunction)Core_write_float, METH_O, NULL },
+    { "write_double", (PyCFunction)Core_write_double, METH_O, NULL },
+    { "write_string", (PyCFunction)Core_write_string, METH_O, NULL },
+    { "write_binary", (PyCFunction)Core_write_binary, METH_O, NULL },
+    { "start_write_list", (PyCFunction)Core_write_uint32, METH_O, NULL },
+    { "start_write_union", (PyCFunction)Core_write_uint32, METH_O, NULL },
+    { "write_null_flag", (PyCFunction)Core_write_null_flag, METH_O, NULL },
+    { "read_bool", (PyCFunction)Core_read_bool, METH_NOARGS, NULL },
+    { "read_int8", (PyCFunction)Core_read_int8, METH_NOARGS, NULL },
+    { "read_int16", (PyCFunction)Core_read_int16, METH_NOARGS, NULL },
+    { "read_int32", (PyCFunction)Core_read_int32, METH_NOARGS, NULL },
+    { "read_int64", (PyCFunction)Core_read_int64, METH_NOARGS, NULL },
+    { "read_uint8", (PyCFunction)Core_read_uint8, METH_NOARGS, NULL },
+    { "read_uint16", (PyCFunction)Core_read_uint16, METH_NOARGS, NULL },
+    { "read_uint32", (PyCFunction)Core_read_uint32, METH_NOARGS, NULL },
+    { "read_uint64", (PyCFunction)Core_read_uint64, METH_NOARGS, NULL },
+    { "read_float", (PyCFunction)Core_read_float, METH_NOARGS, NULL },
+    { "read_double", (PyCFunction)Core_read_double, METH_NOARGS, NULL },
+    { "read_string", (PyCFunction)Core_read_string, METH_NOARGS, NULL },
+    { "read_binary", (PyCFunction)Core_read_binary, METH_NOARGS, NULL },
+    { "start_read_list", (PyCFunction)Core_read_uint32, METH_NOARGS, NULL },
+    { "start_read_union", (PyCFunction)Core_read_int32, METH_NOARGS, NULL },
+    { "read_null_flag", (PyCFunction)Core_read_uint8, METH_NOARGS, NULL },
+    { NULL, NULL, 0, NULL }
+};
+
+static PyMemberDef Core_members[] = { { "_buffer", T_OBJECT, offsetof(CoreObject, buffer), 0, NULL },
+                                      { "_cursor", T_PYSSIZET, offsetof(CoreObject, cursor), 0, NULL },
+                                      { NULL, 0, 0, 0, NULL } };
+
+static int Core_traverse(CoreObject *self, visitproc visit, void *arg)
+{
+    Py_VISIT(self->buffer);
+    return 0;
+}
+
+static int Core_clear(CoreObject *self)
+{
+    Py_CLEAR(self->buffer);
+    return 0;
+}
+
+static void Core_dealloc(CoreObject *self)
+{
+    PyObject_GC_UnTrack(self);
+    (void)Core_clear(self);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyTypeObject CoreType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "erpc._basic_codec.BasicCodecCore",
+    .tp_basicsize = sizeof(CoreObject),
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC,
+    .tp_doc = "C implementation of value coding of BasicCodec.",
+    .tp_traverse = (traverseproc)Core_traverse,
+    .tp_clear = (inquiry)Core_clear,
+    .tp_dealloc = (destructor)Core_dealloc,
+    .tp_methods = Core_methods,
+    .tp_members = Core_members,
+    .tp_new = PyType_GenericNew,
+};
+
+static struct PyModuleDef s_module = {
+    PyModuleDef_HEAD_INIT, "erpc._basic_codec", "C accelerated value coding of BasicCodec.", -1, NULL,
+};
+
+PyMODINIT_FUNC PyInit__basic_codec(void)
+{
+    PyObject *module = NULL;
+    PyObject *structModule;
+
+    if (PyType_Ready(&CoreType) == 0)
+    {
+        structModule = PyImport_ImportModule("struct");
+        if (structModule != NULL)
+        {
+            s_structError = PyObject_GetAttrString(structModule, "error");
+            Py_DECREF(structModule);
+        }
+    }
+
+    if (s_structError != NULL)
+    {
+        module = PyModule_Create(&s_module);
+    }
+
+    if (module != NULL)
+    {
+        Py_INCREF(&CoreType);
+        if (PyModule_AddObject(module, "BasicCodecCore", (PyObject *)&CoreType) != 0)
+        {
+            Py_DECREF(&CoreType);
+            Py_DECREF(module);
+            module = NULL;
+        }
+    }
+
+    return module;
+}
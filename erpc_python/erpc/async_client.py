@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+
+import asyncio
+from typing import Optional, Type, TYPE_CHECKING
+
+from .client import ClientManager, RequestContext, RequestError
+from .codec import Codec, MessageType
+
+if TYPE_CHECKING:
+    from .async_transport import AsyncTransport
+
+
+class AsyncClientManager(ClientManager):
+    """ Client manager of asyncio clients generated for interfaces with @async_calls annotation.
+
+    Requests are sent without waiting for replies of previous ones. One task receives replies and passes them to
+    waiting requests by their sequence number, so many calls can be in progress over one connection.
+    """
+
+    def __init__(self, transport: Optional["AsyncTransport"] = None, codecClass: Optional[Type[Codec]] = None):
+        super(AsyncClientManager, self).__init__(transport, codecClass)
+        self._pending: dict[int, asyncio.Future] = {}
+        self._receiver: Optional[asyncio.Task] = None
+
+    async def perform_request(self, request: RequestContext):
+        assert self.transport is not None, "No Transport was set"
+        assert self.arbitrator is None, "Arbitrator is not supported by asyncio clients"
+
+        reply: Optional[asyncio.Future] = None
+        if not request.is_oneway:
+            reply = asyncio.get_running_loop().create_future()
+            self._pending[request.sequence] = reply
+            if self._receiver is None:
+                self._receiver = asyncio.create_task(self._receive_replies())
+
+        try:
+            # Send serialized request to server.
+            await self.transport.send(request.codec.buffer)
+
+            if reply is not None:
+                request.codec.buffer = await reply
+        finally:
+            if reply is not None:
+                self._pending.pop(request.sequence, None)
+
+        if reply is not None:
+            info = request.codec.start_read_message()
+            if info.type != MessageType.kReplyMessage:
+                raise RequestError("invalid reply message type")
+            if info.sequence != request.sequence:
+                raise RequestError("unexpected sequence number in reply (was %d, expected %d)"
+                                   % (info.sequence, request.sequence))
+
+    async def _receive_replies(self):
+        """ Pass received replies to requests waiting for them, while there are any. """
+        assert self.codec_class is not None, "No codec class was set"
+        try:
+            while self._pending:
+                message = await self.transport.receive()
+                codec = self.codec_class()
+                codec.buffer = message
+                reply = self._pending.pop(codec.start_read_message().sequence, None)
+                # Replies of cancelled requests are dropped.
+                if reply is not None and not reply.done():
+                    reply.set_result(message)
+        except Exception as e:
+            # Replies can not be matched anymore, fail all waiting requests.
+            for reply in self._pending.values():
+                if not reply.done():
+                    reply.set_exception(e)
+        finally:
+            self._receiver = None
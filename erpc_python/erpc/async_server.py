@@ -0,0 +1,50 @@
+#!/usr/bin/env python
+
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+
+from typing import Optional, Type
+
+from .async_transport import AsyncTransport
+from .client import RequestError
+from .codec import Codec
+from .server import Server
+from .transport import TransportError
+
+
+class AsyncServer(Server):
+    """ Server receiving requests from asyncio transport.
+
+    Requests are processed one by one by service handlers called in the event loop, so handlers should not block.
+    Many servers can run in one event loop.
+    """
+
+    def __init__(self, transport: Optional[AsyncTransport], codecClass: Optional[Type[Codec]]):
+        super(AsyncServer, self).__init__(transport, codecClass)
+        self._run = True
+
+    async def run(self) -> None:
+        self._run = True
+        while self._run:
+            try:
+                await self._receive_request()
+            except (RequestError, TransportError) as e:
+                print(f"Error while processing request: {str(e)}")
+
+    def stop(self) -> None:
+        self._run = False
+
+    async def _receive_request(self):
+        assert self.transport is not None, "No Transport is set"
+        assert self.codec_class is not None, "No Codec class is set"
+
+        message = await self.transport.receive()
+
+        codec = self.codec_class()
+        codec.buffer = message
+
+        self._process_request(codec)
+
+        if len(codec.buffer):
+            await self.transport.send(codec.buffer)
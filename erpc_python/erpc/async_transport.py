@@ -0,0 +1,194 @@
+#!/usr/bin/env python
+
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+
+import asyncio
+import socket
+from typing import Optional, Any, Union
+
+from .transport import FrameCoder, ConnectionClosed
+
+
+class AsyncTransport(object):
+    """ Base asyncio transport class.
+    """
+
+    def __init__(self):
+        super(AsyncTransport, self).__init__()
+
+    async def send(self, message: Union[bytes, bytearray]) -> None:
+        raise NotImplementedError()
+
+    async def receive(self) -> bytearray:
+        raise NotImplementedError()
+
+    async def close(self) -> None:
+        pass
+
+
+class AsyncFramedTransport(AsyncTransport, FrameCoder):
+    """ Asyncio transport with the same frames as FramedTransport.
+    """
+
+    def __init__(self):
+        super(AsyncFramedTransport, self).__init__()
+        self._send_lock = asyncio.Lock()
+        self._receive_lock = asyncio.Lock()
+
+    async def send(self, message: Union[bytes, bytearray]) -> None:
+        async with self._send_lock:
+            await self._base_send(self._pack_header(message) + message)
+
+    async def receive(self) -> bytearray:
+        async with self._receive_lock:
+            # Read fixed size header containing the message length.
+            message_length, crc_body = self._unpack_header(await self._base_receive(self.HEADER_LEN))
+
+            # Now we know the length, read the rest of the message.
+            data = bytearray(await self._base_receive(message_length))
+            self._check_message(data, crc_body)
+
+            return data
+
+    async def _base_send(self, data: Union[bytes, bytearray]) -> None:
+        raise NotImplementedError()
+
+    async def _base_receive(self, count: int) -> bytes:
+        raise NotImplementedError()
+
+
+class AsyncStreamTransport(AsyncFramedTransport):
+    """ Framed transport over asyncio stream, opened on first use.
+    """
+
+    def __init__(self):
+        super(AsyncStreamTransport, self).__init__()
+        self._reader: Optional[asyncio.StreamReader] = None
+        self._writer: Optional[asyncio.StreamWriter] = None
+        self._connected: Optional[asyncio.Event] = None
+
+    async def open(self) -> None:
+        """ Open the stream, it is called by first send or receive when not called before. """
+        if self._connected is None:
+            self._connected = asyncio.Event()
+            try:
+                await self._open()
+            except BaseException:
+                self._connected = None
+                raise
+
+    async def close(self) -> None:
+        await self._disconnect()
+        self._connected = None
+
+    async def _disconnect(self) -> None:
+        writer = self._writer
+        self._reader = None
+        self._writer = None
+        if self._connected is not None:
+            self._connected.clear()
+        if writer is not None:
+            writer.close()
+            try:
+                await writer.wait_closed()
+            except OSError:
+                # May be raised by the OS if the connection was reset by the other side.
+                pass
+
+    async def _connection_lost(self) -> None:
+        """ Called when the other side closed the connection, next use of the transport opens it again. """
+        await self.close()
+
+    def _set_streams(self, reader: asyncio.StreamReader, writer: asyncio.StreamWriter) -> None:
+        self._reader = reader
+        self._writer = writer
+        assert self._connected is not None
+        self._connected.set()
+
+    async def _open(self) -> None:
+        raise NotImplementedError()
+
+    async def _wait_connected(self) -> None:
+        await self.open()
+        assert self._connected is not None
+        await self._connected.wait()
+
+    async def _base_send(self, data: Union[bytes, bytearray]) -> None:
+        await self._wait_connected()
+        assert self._writer is not None
+        self._writer.write(data)
+        await self._writer.drain()
+
+    async def _base_receive(self, count: int) -> bytes:
+        await self._wait_connected()
+        assert self._reader is not None
+        try:
+            return await self._reader.readexactly(count)
+        except (asyncio.IncompleteReadError, ConnectionError):
+            await self._connection_lost()
+            raise ConnectionClosed()
+
+
+class AsyncTCPTransport(AsyncStreamTransport):
+    """ Asyncio version of TCPTransport.
+
+    Server side waits for connection of the client, each new connection replaces the previous one.
+    """
+
+    def __init__(self, host: str, port: int, isServer: bool):
+        super(AsyncTCPTransport, self).__init__()
+        self._host = host
+        self._port = port
+        self._is_server = isServer
+        self._server: Optional[asyncio.AbstractServer] = None
+
+    async def _open(self) -> None:
+        if self._is_server:
+            self._server = await asyncio.start_server(self._accept, self._host, self._port, reuse_address=True)
+        else:
+            reader, writer = await asyncio.open_connection(self._host, self._port)
+            writer.get_extra_info('socket').setsockopt(socket.SOL_TCP, socket.TCP_NODELAY, 1)
+            self._set_streams(reader, writer)
+
+    async def _accept(self, reader: asyncio.StreamReader, writer: asyncio.StreamWriter) -> None:
+        writer.get_extra_info('socket').setsockopt(socket.SOL_TCP, socket.TCP_NODELAY, 1)
+        self._set_streams(reader, writer)
+
+    async def _connection_lost(self) -> None:
+        if self._is_server:
+            # Keep listening for next client.
+            await self._disconnect()
+        else:
+            await super(AsyncTCPTransport, self)._connection_lost()
+
+    async def close(self) -> None:
+        if self._server is not None:
+            self._server.close()
+            await self._server.wait_closed()
+            self._server = None
+        await super(AsyncTCPTransport, self).close()
+
+
+class AsyncSerialTransport(AsyncStreamTransport):
+    """ Asyncio version of SerialTransport, using pySerial-asyncio.
+    """
+
+    def __init__(self, url: str, baudrate: int, **kwargs: Any):
+        super(AsyncSerialTransport, self).__init__()
+        self._url = url
+        self._baudrate = baudrate
+        self._kwargs = kwargs
+
+    async def _open(self) -> None:
+        try:
+            import serial_asyncio
+        except ImportError:
+            raise ImportError(
+                "Please, install pySerial-asyncio module (sudo pip3 install pyserial-asyncio).")
+
+        # 8N1 by default
+        reader, writer = await serial_asyncio.open_serial_connection(url=self._url, baudrate=self._baudrate,
+                                                                     **self._kwargs)
+        self._set_streams(reader, writer)
@@ -5,65 +5,90 @@
 #
 # SPDX-License-Identifier: BSD-3-Clause
 
+import array
 import struct
-from typing import Any
+import sys
+from typing import Any, Sequence
 
 from .codec import MessageType, MessageInfo, Codec, CodecError
 
-
-class BasicCodec(Codec):
-    """Version of this codec.
+_BOOL = struct.Struct('<?')
+_INT8 = struct.Struct('<b')
+_INT16 = struct.Struct('<h')
+_INT32 = struct.Struct('<i')
+_INT64 = struct.Struct('<q')
+_UINT8 = struct.Struct('<B')
+_UINT16 = struct.Struct('<H')
+_UINT32 = struct.Struct('<I')
+_UINT64 = struct.Struct('<Q')
+_FLOAT = struct.Struct('<f')
+_DOUBLE = struct.Struct('<d')
+
+# Array module type codes with the same size as little endian struct format characters, used to convert lists
+# of scalars on little endian hosts.
+_ARRAY_CODES = {}
+if sys.byteorder == 'little':
+    for _code in 'bBhHiIqQfd':
+        for _array_code in (_code, _code.replace('i', 'l').replace('I', 'L')):
+            if array.array(_array_code).itemsize == struct.calcsize('<' + _code):
+                _ARRAY_CODES[_code] = _array_code
+                break
+
+
+class PyBasicCodecCore(Codec):
+    """Pure Python coding of values of BasicCodec, used when the C accelerated module is not available.
 
     Args:
         Codec (code.Codec): Inherit and implement codec interface functions.
     """
 
-    BASIC_CODEC_VERSION = 1
-
-    def start_write_message(self, msgInfo: MessageInfo):
-        header = (self.BASIC_CODEC_VERSION << 24) \
-                 | ((msgInfo.service & 0xff) << 16) \
-                 | ((msgInfo.request & 0xff) << 8) \
-                 | (msgInfo.type.value & 0xff)
-        self.write_uint32(header)
-        self.write_uint32(msgInfo.sequence)
-
     def _write(self, fmt: str, value: Any):
         self._buffer += struct.pack(fmt, value)
         self._cursor += struct.calcsize(fmt)
 
     def write_bool(self, value: bool):
-        self._write('<?', value)
+        self._buffer += _BOOL.pack(value)
+        self._cursor += 1
 
     def write_int8(self, value: int):
-        self._write('<b', value)
+        self._buffer += _INT8.pack(value)
+        self._cursor += 1
 
     def write_int16(self, value: int):
-        self._write('<h', value)
+        self._buffer += _INT16.pack(value)
+        self._cursor += 2
 
     def write_int32(self, value: int):
-        self._write('<i', value)
+        self._buffer += _INT32.pack(value)
+        self._cursor += 4
 
     def write_int64(self, value: int):
-        self._write('<q', value)
+        self._buffer += _INT64.pack(value)
+        self._cursor += 8
 
     def write_uint8(self, value: int):
-        self._write('<B', value)
+        self._buffer += _UINT8.pack(value)
+        self._cursor += 1
 
     def write_uint16(self, value: int):
-        self._write('<H', value)
+        self._buffer += _UINT16.pack(value)
+        self._cursor += 2
 
     def write_uint32(self, value: int):
-        self._write('<I', value)
+        self._buffer += _UINT32.pack(value)
+        self._cursor += 4
 
     def write_uint64(self, value: int):
-        self._write('<Q', value)
+        self._buffer += _UINT64.pack(value)
+        self._cursor += 8
 
     def write_float(self, value: float):
-        self._write('<f', value)
+        self._buffer += _FLOAT.pack(value)
+        self._cursor += 4
 
     def write_double(self, value: float):
-        self._write('<d', value)
+        self._buffer += _DOUBLE.pack(value)
+        self._cursor += 8
 
     def write_string(self, value: str):
         self.write_binary(value.encode())
@@ -81,62 +106,48 @@ class BasicCodec(Codec):
     def write_null_flag(self, flag: int):
         self.write_uint8(1 if flag else 0)
 
-    def start_read_message(self) -> MessageInfo:
-        """ Returns 4-tuple of msgType, service, request, sequence.
-
-        Raises:
-            CodecError: Raise this error when unsupported codec version doesn't match.
-
-        Returns:
-            codec.MessageInfo: 4-tuple of msgType, service, request, sequence.
-        """
-        header = self.read_uint32()
-        sequence = self.read_uint32()
-        version = header >> 24
-        if version != self.BASIC_CODEC_VERSION:
-            raise CodecError("unsupported codec version %d" % version)
-        service = (header >> 16) & 0xff
-        request = (header >> 8) & 0xff
-        msg_type = MessageType(header & 0xff)
-        return MessageInfo(type=msg_type, service=service, request=request, sequence=sequence)
-
     def _read(self, fmt: str):
         result = struct.unpack_from(fmt, self._buffer, self._cursor)
         self._cursor += struct.calcsize(fmt)
         return result[0]
 
+    def _read_value(self, fmt: struct.Struct):
+        result = fmt.unpack_from(self._buffer, self._cursor)
+        self._cursor += fmt.size
+        return result[0]
+
     def read_bool(self) -> bool:
-        return self._read('<?')
+        return self._read_value(_BOOL)
 
     def read_int8(self) -> int:
-        return self._read('<b')
+        return self._read_value(_INT8)
 
     def read_int16(self) -> int:
-        return self._read('<h')
+        return self._read_value(_INT16)
 
     def read_int32(self) -> int:
-        return self._read('<i')
+        return self._read_value(_INT32)
 
     def read_int64(self) -> int:
-        return self._read('<q')
+        return self._read_value(_INT64)
 
     def read_uint8(self) -> int:
-        return self._read('<B')
+        return self._read_value(_UINT8)
 
     def read_uint16(self) -> int:
-        return self._read('<H')
+        return self._read_value(_UINT16)
 
     def read_uint32(self) -> int:
-        return self._read('<I')
+        return self._read_value(_UINT32)
 
     def read_uint64(self) -> int:
-        return self._read('<Q')
+        return self._read_value(_UINT64)
 
     def read_float(self) -> float:
-        return self._read('<f')
+        return self._read_value(_FLOAT)
 
     def read_double(self) -> float:
-        return self._read('<d')
+        return self._read_value(_DOUBLE)
 
     def read_string(self) -> str:
         return self.read_binary().decode()
@@ -165,3 +176,80 @@ class BasicCodec(Codec):
 
     def read_null_flag(self) -> int:
         return self.read_uint8()
+
+
+try:
+    from ._basic_codec import BasicCodecCore
+except ImportError:
+    BasicCodecCore = PyBasicCodecCore
+
+
+class BasicCodec(BasicCodecCore, Codec):
+    """Version of this codec.
+
+    Values are coded by the C accelerated module erpc._basic_codec when it was built, otherwise by
+    PyBasicCodecCore. Both produce the same data.
+
+    Args:
+        Codec (code.Codec): Inherit and implement codec interface functions.
+    """
+
+    BASIC_CODEC_VERSION = 1
+
+    def start_write_message(self, msgInfo: MessageInfo):
+        header = (self.BASIC_CODEC_VERSION << 24) \
+                 | ((msgInfo.service & 0xff) << 16) \
+                 | ((msgInfo.request & 0xff) << 8) \
+                 | (msgInfo.type.value & 0xff)
+        self.write_uint32(header)
+        self.write_uint32(msgInfo.sequence)
+
+    def start_read_message(self) -> MessageInfo:
+        """ Returns 4-tuple of msgType, service, request, sequence.
+
+        Raises:
+            CodecError: Raise this error when unsupported codec version doesn't match.
+
+        Returns:
+            codec.MessageInfo: 4-tuple of msgType, service, request, sequence.
+        """
+        header = self.read_uint32()
+        sequence = self.read_uint32()
+        version = header >> 24
+        if version != self.BASIC_CODEC_VERSION:
+            raise CodecError("unsupported codec version %d" % version)
+        service = (header >> 16) & 0xff
+        request = (header >> 8) & 0xff
+        msg_type = MessageType(header & 0xff)
+        return MessageInfo(type=msg_type, service=service, request=request, sequence=sequence)
+
+    def write_fixed(self, fmt: struct.Struct, values: Sequence[Any]) -> None:
+        self._buffer += fmt.pack(*values)
+        self._cursor += fmt.size
+
+    def read_fixed(self, fmt: struct.Struct) -> tuple:
+        values = fmt.unpack_from(self._buffer, self._cursor)
+        self._cursor += fmt.size
+        return values
+
+    def write_array(self, code: str, values: Sequence[Any]) -> None:
+        data = struct.pack('<%d%s' % (len(values), code), *values)
+        self._buffer += data
+        self._cursor += len(data)
+
+    def read_array(self, code: str, count: int) -> list:
+        array_code = _ARRAY_CODES.get(code)
+        if array_code is None:
+            fmt = '<%d%s' % (count, code)
+            values = list(struct.unpack_from(fmt, self._buffer, self._cursor))
+            self._cursor += struct.calcsize(fmt)
+        else:
+            elements = array.array(array_code)
+            end = self._cursor + count * elements.itemsize
+            if end > len(self._buffer):
+                raise struct.error("list of %d elements does not fit into the buffer" % count)
+            with memoryview(self._buffer) as data:
+                elements.frombytes(data[self._cursor:end])
+            self._cursor = end
+            values = elements.tolist()
+        return values
@@ -8,6 +8,7 @@ from typing import Optional, Type, TYPE_CHECKING
 
 if TYPE_CHECKING:
     from .arbitrator import TransportArbitrator
+    from .stream import Stream
     from .transport import Transport
 
 from .codec import Codec, MessageType
@@ -76,14 +77,38 @@ class ClientManager(object):
                 message = self._arbitrator.client_receive(token)
             else:
                 message = self.transport.receive()
-            request.codec.buffer = message
-
-            info = request.codec.start_read_message()
-            if info.type != MessageType.kReplyMessage:
-                raise RequestError("invalid reply message type")
-            if info.sequence != request.sequence:
-                raise RequestError("unexpected sequence number in reply (was %d, expected %d)"
-                                   % (info.sequence, request.sequence))
+            self._read_reply(request, message)
+
+    def send_stream_request(self, request: "RequestContext"):
+        """ Send invocation of a function with streamed parameter or return value.
+
+        Stream messages use the transport directly, so the transport must not be arbitrated.
+        """
+        assert self.transport is not None, "No Transport was set"
+        if self._arbitrator is not None:
+            raise RequestError("streams are not supported with transport arbitrator")
+        self.transport.send(request.codec.buffer)
+
+    def create_stream(self, request: "RequestContext", service: int, method: int) -> "Stream":
+        from .stream import Stream
+        assert self.transport is not None, "No Transport was set"
+        assert self.codec_class is not None, "No codec class was set"
+        return Stream(self.transport, self.codec_class, service, method, request.sequence)
+
+    def receive_stream_reply(self, request: "RequestContext"):
+        """ Receive reply of a function with streamed parameter or return value after the stream was transferred. """
+        assert self.transport is not None, "No Transport was set"
+        self._read_reply(request, self.transport.receive())
+
+    def _read_reply(self, request: "RequestContext", message: bytearray):
+        request.codec.buffer = message
+
+        info = request.codec.start_read_message()
+        if info.type != MessageType.kReplyMessage:
+            raise RequestError("invalid reply message type")
+        if info.sequence != request.sequence:
+            raise RequestError("unexpected sequence number in reply (was %d, expected %d)"
+                               % (info.sequence, request.sequence))
 
 
 class RequestContext(object):
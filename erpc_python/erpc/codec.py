@@ -5,8 +5,10 @@
 #
 # SPDX-License-Identifier: BSD-3-Clause
 
+import functools
+import struct
 from enum import Enum
-from typing import NamedTuple
+from typing import NamedTuple, Sequence, Any
 
 
 class MessageType(Enum):
@@ -14,6 +16,8 @@ class MessageType(Enum):
     kOnewayMessage = 1
     kReplyMessage = 2
     kNotificationMessage = 3
+    kStreamChunkMessage = 4
+    kStreamAckMessage = 5
 
 
 MessageInfo = NamedTuple(
@@ -24,6 +28,27 @@ class CodecError(RuntimeError):
     pass
 
 
+# Codec functions coding one value of struct module format character.
+_WRITERS = {'?': 'write_bool', 'b': 'write_int8', 'h': 'write_int16', 'i': 'write_int32', 'q': 'write_int64',
+            'B': 'write_uint8', 'H': 'write_uint16', 'I': 'write_uint32', 'Q': 'write_uint64',
+            'f': 'write_float', 'd': 'write_double'}
+_READERS = {code: name.replace('write_', 'read_') for code, name in _WRITERS.items()}
+
+
+@functools.lru_cache(maxsize=None)
+def _format_codes(fmt: str) -> tuple:
+    """ Expand struct module format like '<i3f' into one character per value. """
+    codes = []
+    count = ''
+    for c in fmt.lstrip('<'):
+        if c.isdigit():
+            count += c
+        else:
+            codes += [c] * int(count or '1')
+            count = ''
+    return tuple(codes)
+
+
 class Codec:
     def __init__(self):
         self._buffer = bytearray()
@@ -158,3 +183,42 @@ class Codec:
 
     def read_null_flag(self) -> int:
         raise NotImplementedError()
+
+    def write_fixed(self, fmt: struct.Struct, values: Sequence[Any]) -> None:
+        """ Write values of fixed size types described by little endian struct format.
+
+        Values are written one by one, codecs with fixed size encoding write them at once.
+        """
+        for code, value in zip(_format_codes(fmt.format), values):
+            getattr(self, _WRITERS[code])(value)
+
+    def read_fixed(self, fmt: struct.Struct) -> tuple:
+        """ Read values of fixed size types described by little endian struct format.
+
+        Returns:
+            tuple: Read values.
+        """
+        return tuple(getattr(self, _READERS[code])() for code in _format_codes(fmt.format))
+
+    def write_array(self, code: str, values: Sequence[Any]) -> None:
+        """ Write elements of list or array of scalar type given by struct module format character. """
+        writer = getattr(self, _WRITERS[code])
+        for value in values:
+            writer(value)
+
+    def read_array(self, code: str, count: int) -> list:
+        """ Read elements of list or array of scalar type given by struct module format character.
+
+        Returns:
+            list: Read elements.
+        """
+        reader = getattr(self, _READERS[code])
+        return [reader() for _ in range(count)]
+
+    def array_element_max_size(self, code: str) -> int:
+        """ Most bytes taken by one element written by write_array(), used to split streamed values into chunks.
+
+        Returns:
+            int: Size of element in bytes.
+        """
+        return struct.calcsize('<' + code)
@@ -0,0 +1,165 @@
+#!/usr/bin/env python
+
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+
+import struct
+from typing import Any, Sequence
+
+from .basic_codec import BasicCodec, PyBasicCodecCore
+from .codec import MessageType, MessageInfo, Codec, CodecError
+
+
+class CompactCodec(BasicCodec):
+    """Codec with variable length integers, compatible with C++ CompactCodec.
+
+    Integers wider than one byte are LEB128 varints, signed ones zigzag mapped first. Lengths and union
+    discriminators are varints too. Bytes, booleans and floating point numbers are written as by BasicCodec.
+
+    Args:
+        BasicCodec (basic_codec.BasicCodec): Inherit encoding of values with fixed size.
+    """
+
+    COMPACT_CODEC_VERSION = 1
+
+    # Struct module format characters of varint coded values.
+    _VARINT_CODES = 'hHiIqQ'
+
+    # Methods coding lengths and discriminators by the varint methods below, the C accelerated core of
+    # BasicCodec would code them with fixed size.
+    write_string = PyBasicCodecCore.write_string
+    write_binary = PyBasicCodecCore.write_binary
+    start_write_list = PyBasicCodecCore.start_write_list
+    read_string = PyBasicCodecCore.read_string
+    read_binary = PyBasicCodecCore.read_binary
+    start_read_list = PyBasicCodecCore.start_read_list
+    start_read_union = PyBasicCodecCore.start_read_union
+
+    def start_write_message(self, msgInfo: MessageInfo):
+        self.write_uint8((self.COMPACT_CODEC_VERSION << 4) | (msgInfo.type.value & 0x0f))
+        self.write_uint32(msgInfo.service)
+        self.write_uint32(msgInfo.request)
+        self.write_uint32(msgInfo.sequence)
+
+    def _write_varint(self, value: int):
+        data = bytearray()
+        while value >= 0x80:
+            data.append((value & 0x7f) | 0x80)
+            value >>= 7
+        data.append(value)
+        self._buffer += data
+        self._cursor += len(data)
+
+    def _write_unsigned(self, value: int, bits: int):
+        if not 0 <= value < (1 << bits):
+            raise CodecError("value %d does not fit into uint%d" % (value, bits))
+        self._write_varint(value)
+
+    def _write_signed(self, value: int, bits: int):
+        if not -(1 << (bits - 1)) <= value < (1 << (bits - 1)):
+            raise CodecError("value %d does not fit into int%d" % (value, bits))
+        self._write_varint((value << 1) if value >= 0 else ((-value << 1) - 1))
+
+    def write_int16(self, value: int):
+        self._write_signed(value, 16)
+
+    def write_int32(self, value: int):
+        self._write_signed(value, 32)
+
+    def write_int64(self, value: int):
+        self._write_signed(value, 64)
+
+    def write_uint16(self, value: int):
+        self._write_unsigned(value, 16)
+
+    def write_uint32(self, value: int):
+        self._write_unsigned(value, 32)
+
+    def write_uint64(self, value: int):
+        self._write_unsigned(value, 64)
+
+    def start_write_union(self, discriminator: int):
+        self.write_int32(discriminator)
+
+    def start_read_message(self) -> MessageInfo:
+        """ Returns 4-tuple of msgType, service, request, sequence.
+
+        Raises:
+            CodecError: Raise this error when unsupported codec version doesn't match.
+
+        Returns:
+            codec.MessageInfo: 4-tuple of msgType, service, request, sequence.
+        """
+        header = self.read_uint8()
+        version = header >> 4
+        if version != self.COMPACT_CODEC_VERSION:
+            raise CodecError("unsupported codec version %d" % version)
+        msg_type = MessageType(header & 0x0f)
+        service = self.read_uint32()
+        request = self.read_uint32()
+        sequence = self.read_uint32()
+        return MessageInfo(type=msg_type, service=service, request=request, sequence=sequence)
+
+    def _read_varint(self, bits: int) -> int:
+        result = 0
+        shift = 0
+        while True:
+            if self._cursor >= len(self._buffer):
+                raise CodecError("truncated varint")
+            byte = self._buffer[self._cursor]
+            self._cursor += 1
+            result |= (byte & 0x7f) << shift
+            shift += 7
+            if not byte & 0x80:
+                break
+            if shift >= 70:
+                raise CodecError("varint is too long")
+        if result >> bits:
+            raise CodecError("value %d does not fit into %d bits" % (result, bits))
+        return result
+
+    def _read_signed(self, bits: int) -> int:
+        value = self._read_varint(bits)
+        return (value >> 1) if not value & 1 else -((value + 1) >> 1)
+
+    def read_int16(self) -> int:
+        return self._read_signed(16)
+
+    def read_int32(self) -> int:
+        return self._read_signed(32)
+
+    def read_int64(self) -> int:
+        return self._read_signed(64)
+
+    def read_uint16(self) -> int:
+        return self._read_varint(16)
+
+    def read_uint32(self) -> int:
+        return self._read_varint(32)
+
+    def read_uint64(self) -> int:
+        return self._read_varint(64)
+
+    def write_fixed(self, fmt: struct.Struct, values: Sequence[Any]) -> None:
+        Codec.write_fixed(self, fmt, values)
+
+    def read_fixed(self, fmt: struct.Struct) -> tuple:
+        return Codec.read_fixed(self, fmt)
+
+    def write_array(self, code: str, values: Sequence[Any]) -> None:
+        if code in self._VARINT_CODES:
+            Codec.write_array(self, code, values)
+        else:
+            super().write_array(code, values)
+
+    def read_array(self, code: str, count: int) -> list:
+        if code in self._VARINT_CODES:
+            return Codec.read_array(self, code, count)
+        return super().read_array(code, count)
+
+    def array_element_max_size(self, code: str) -> int:
+        size = super().array_element_max_size(code)
+        if code in self._VARINT_CODES:
+            size = (size * 8 + 6) // 7
+        return size
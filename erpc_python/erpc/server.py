@@ -11,17 +11,37 @@ from erpc.transport import Transport
 
 from .client import RequestError
 from .codec import MessageType, Codec
+from .stream import Stream
 
 
 class Service(object):
     def __init__(self, serviceId: int):
         self._id = serviceId
         self._methods: dict[int, Callable[[int, Codec], None]] = {}
+        self._server: Optional["Server"] = None
 
     @property
     def service_id(self) -> int:
         return self._id
 
+    @property
+    def server(self) -> Optional["Server"]:
+        return self._server
+
+    @server.setter
+    def server(self, value: "Server"):
+        self._server = value
+
+    def create_stream(self, methodId: int, sequence: int) -> Stream:
+        """ Create stream of streamed parameter or return value of invoked function.
+
+        Stream messages use the transport of the server, which must be synchronous.
+        """
+        assert self._server is not None, "Service was not added to a server"
+        assert self._server.transport is not None, "No Transport is set"
+        assert self._server.codec_class is not None, "No Codec class is set"
+        return Stream(self._server.transport, self._server.codec_class, self._id, methodId, sequence)
+
     def handle_invocation(self, methodId: int, sequence: int, codec: Codec):
         try:
             self._methods[methodId](sequence, codec)
@@ -63,6 +83,7 @@ class Server(object):
 
     def add_service(self, service: "Service"):
         assert self.get_service_with_id(service.service_id) is None
+        service.server = self
         self._services.append(service)
 
     def run(self) -> None:
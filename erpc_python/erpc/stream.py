@@ -0,0 +1,137 @@
+#!/usr/bin/env python
+
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+
+from typing import Any, Sequence, Type, Union
+
+from .client import RequestError
+from .codec import Codec, MessageInfo, MessageType
+from .transport import Transport
+
+
+class Stream(object):
+    """Transfers streamed parameter or return value of a function in chunk messages, compatible with C++ Stream.
+
+    Every chunk carries the count of all elements of the stream, flag of the last chunk and a list of elements.
+    Receiver acknowledges every half of WINDOW chunks and the last chunk by an ack message with the count of chunks
+    received. Sender does not send next chunk while WINDOW chunks are not acknowledged. All messages of the stream
+    use the sequence of the call.
+
+    Streams need a synchronous transport which is not shared by other clients or servers.
+    """
+
+    # Count of chunks sent without acknowledgement, has to match ERPC_STREAM_WINDOW of the other side.
+    WINDOW = 4
+
+    # Most bytes of a chunk message, has to fit into ERPC_DEFAULT_BUFFER_SIZE less transport header of the other side.
+    MESSAGE_SIZE = 248
+
+    # Most bytes taken by the last chunk flag and the length of the element list in a chunk message.
+    _CHUNK_OVERHEAD = 6
+
+    def __init__(self, transport: Transport, codecClass: Type[Codec], service: int, method: int, sequence: int):
+        self._transport = transport
+        self._codec_class = codecClass
+        self._service = service
+        self._method = method
+        self._sequence = sequence
+
+    @property
+    def _ack_step(self) -> int:
+        return max(1, self.WINDOW // 2)
+
+    def send(self, values: Sequence[Any], code: str) -> None:
+        """ Send elements of type given by struct module format character in chunk messages. """
+        sent = 0
+        chunks = 0
+        acked = 0
+        last = False
+
+        while not last:
+            # Wait until the receiver has room for next chunk.
+            while chunks - acked >= self.WINDOW:
+                acked = self._receive_ack(chunks)
+
+            codec = self._start_message(MessageType.kStreamChunkMessage)
+            codec.write_uint32(len(values))
+
+            # Elements fill the rest of the message.
+            space = max(0, self.MESSAGE_SIZE - len(codec.buffer) - self._CHUNK_OVERHEAD)
+            count = space // codec.array_element_max_size(code)
+            if count >= len(values) - sent:
+                count = len(values) - sent
+                last = True
+            elif count == 0:
+                raise RequestError("stream message size %d is too small" % self.MESSAGE_SIZE)
+
+            codec.write_bool(last)
+            codec.start_write_list(count)
+            codec.write_array(code, values[sent:sent + count])
+            self._transport.send(codec.buffer)
+
+            sent += count
+            chunks += 1
+
+        # Receiver acknowledges the last chunk when it has all elements.
+        while acked != chunks:
+            acked = self._receive_ack(chunks)
+
+    def receive(self, code: str, isBinary: bool = False) -> Union[list, bytearray]:
+        """ Receive elements of type given by struct module format character from chunk messages.
+
+        Returns:
+            Union[list, bytearray]: Received elements, bytearray for binary.
+        """
+        values: list = []
+        chunks = 0
+        codec = self._receive_message(MessageType.kStreamChunkMessage)
+        length = codec.read_uint32()
+
+        while True:
+            last = codec.read_bool()
+            count = codec.start_read_list()
+            if count > length - len(values) or (last and count != length - len(values)):
+                raise RequestError("invalid count of elements in stream chunk")
+            values += codec.read_array(code, count)
+
+            chunks += 1
+            if last or chunks % self._ack_step == 0:
+                self._send_ack(chunks)
+            if last:
+                break
+
+            codec = self._receive_message(MessageType.kStreamChunkMessage)
+            if codec.read_uint32() != length:
+                raise RequestError("invalid length of stream")
+
+        return bytearray(values) if isBinary else values
+
+    def _start_message(self, msgType: MessageType) -> Codec:
+        codec = self._codec_class()
+        codec.start_write_message(MessageInfo(type=msgType, service=self._service, request=self._method,
+                                              sequence=self._sequence))
+        return codec
+
+    def _receive_message(self, msgType: MessageType) -> Codec:
+        codec = self._codec_class()
+        codec.buffer = self._transport.receive()
+        info = codec.start_read_message()
+        if info.type != msgType:
+            raise RequestError("invalid stream message type")
+        if info.sequence != self._sequence:
+            raise RequestError("unexpected sequence number in stream message (was %d, expected %d)"
+                               % (info.sequence, self._sequence))
+        return codec
+
+    def _receive_ack(self, chunks: int) -> int:
+        acked = self._receive_message(MessageType.kStreamAckMessage).read_uint32()
+        if acked > chunks:
+            raise RequestError("acknowledged more stream chunks than sent")
+        return acked
+
+    def _send_ack(self, chunks: int) -> None:
+        codec = self._start_message(MessageType.kStreamAckMessage)
+        codec.write_uint32(chunks)
+        self._transport.send(codec.buffer)
@@ -10,7 +10,7 @@ import socket
 import struct
 import threading
 import time
-from typing import Optional, Any, Union
+from typing import Optional, Any, Tuple, Union
 
 from .client import RequestError
 from .crc16 import Crc16
@@ -25,7 +25,7 @@ class Transport(object):
     """
 
     def __init__(self):
-        pass
+        super(Transport, self).__init__()
 
     def send(self, message: Union[bytes, bytearray]) -> None:
         raise NotImplementedError()
@@ -34,14 +34,28 @@ class Transport(object):
         raise NotImplementedError()
 
 
-class FramedTransport(Transport):
+class FrameCoder(object):
+    """ Frame header of framed transports: CRC-16 of the header, message size and CRC-16 of the message.
+    """
+
     HEADER_LEN = 6
 
     def __init__(self):
-        super(FramedTransport, self).__init__()
-        self._send_lock = threading.Lock()
-        self._receive_lock = threading.Lock()
+        super(FrameCoder, self).__init__()
         self._crc16 = Crc16()
+        self._size_format = '<H'
+        self._header_format = '<HHH'
+
+    @property
+    def large_messages(self):
+        """ 32-bit message size in frame header, has to match ERPC_LARGE_MESSAGES of the other side. """
+        return self.HEADER_LEN == 8
+
+    @large_messages.setter
+    def large_messages(self, enabled: bool):
+        self._size_format = '<I' if enabled else '<H'
+        self._header_format = '<HIH' if enabled else '<HHH'
+        self.HEADER_LEN = 8 if enabled else 6
 
     @property
     def crc_16(self):
@@ -53,20 +67,47 @@ class FramedTransport(Transport):
             raise RequestError("invalid CRC, not a number")
         self._crc16 = Crc16(crcStart)
 
+    def _header_crc(self, message_length: int, crc_body: int) -> int:
+        crc_header = self._crc16.compute_crc16(
+            bytes(struct.pack(self._size_format, message_length))) + self._crc16.compute_crc16(
+            bytes(struct.pack('<H', crc_body)))
+        return crc_header & 0xFFFF  # 2bytes
+
+    def _pack_header(self, message: Union[bytes, bytearray]) -> bytes:
+        crc_body = self._crc16.compute_crc16(message)
+        message_length = len(message)
+        header = bytes(struct.pack(self._header_format, self._header_crc(message_length, crc_body),
+                                   message_length, crc_body))
+        assert len(header) == self.HEADER_LEN
+        return header
+
+    def _unpack_header(self, header_data: bytes) -> Tuple[int, int]:
+        """ Returns message length and message CRC-16 from the frame header.
+
+        Raises:
+            RequestError: When header CRC-16 does not match.
+        """
+        crc_header, message_length, crc_body = struct.unpack(self._header_format, header_data)
+        if self._header_crc(message_length, crc_body) != crc_header:
+            raise RequestError("invalid header CRC")
+        return message_length, crc_body
+
+    def _check_message(self, data: bytearray, crc_body: int) -> None:
+        if self._crc16.compute_crc16(data) != crc_body:
+            raise RequestError("invalid message CRC")
+
+
+class FramedTransport(Transport, FrameCoder):
+    def __init__(self):
+        super(FramedTransport, self).__init__()
+        self._send_lock = threading.Lock()
+        self._receive_lock = threading.Lock()
+
     def send(self, message: Union[bytes, bytearray]):
         try:
             self._send_lock.acquire()
 
-            crc_body = self._crc16.compute_crc16(message)
-            message_length = len(message)
-            crc_header = self._crc16.compute_crc16(
-                bytes(struct.pack('<H', message_length))) + self._crc16.compute_crc16(
-                bytes(struct.pack('<H', crc_body)))
-            crc_header &= 0xFFFF  # 2bytes
-
-            header = bytes(struct.pack('<HHH', crc_header, message_length, crc_body))
-            assert len(header) == self.HEADER_LEN
-            self._base_send(header + message)
+            self._base_send(self._pack_header(message) + message)
         finally:
             self._send_lock.release()
 
@@ -75,22 +116,11 @@ class FramedTransport(Transport):
             self._receive_lock.acquire()
 
             # Read fixed size header containing the message length.
-            header_data = self._base_receive(self.HEADER_LEN)
-            crc_header, message_length, crc_body = struct.unpack('<HHH', header_data)
-
-            computed_crc = self._crc16.compute_crc16(
-                bytes(struct.pack('<H', message_length))) + self._crc16.compute_crc16(
-                bytes(struct.pack('<H', crc_body)))
-            computed_crc &= 0xFFFF  # 2bytes
-
-            if computed_crc != crc_header:
-                raise RequestError("invalid header CRC")
+            message_length, crc_body = self._unpack_header(self._base_receive(self.HEADER_LEN))
 
             # Now we know the length, read the rest of the message.
             data = bytearray(self._base_receive(message_length))
-            computed_crc = self._crc16.compute_crc16(data)
-            if computed_crc != crc_body:
-                raise RequestError("invalid message CRC")
+            self._check_message(data, crc_body)
 
             return data
         finally:
@@ -202,6 +232,199 @@ class TCPTransport(FramedTransport):
         return bytes()
 
 
+class CompressingTransport(Transport):
+    """ Compresses messages sent over another transport, compatible with C++ CompressingTransport.
+
+    One flags byte is placed in front of each message. Messages of at least threshold bytes are compressed in
+    the LZ4 block format and sent with COMPRESSED_FLAG set when they shrink, other messages are sent unchanged.
+    Both sides of the communication have to use this transport.
+    """
+
+    COMPRESSED_FLAG = 0x01
+    HASH_BITS = 10
+
+    _MIN_MATCH = 4
+    _LAST_LITERALS = 5
+    _MATCH_FIND_LIMIT = 12
+    _MAX_DISTANCE = 65535
+    _RUN_MASK = 15
+
+    def __init__(self, transport: Transport, threshold: int = 64):
+        super().__init__()
+        self._transport = transport
+        self._threshold = threshold
+
+    @property
+    def transport(self) -> Transport:
+        return self._transport
+
+    @property
+    def threshold(self) -> int:
+        return self._threshold
+
+    @threshold.setter
+    def threshold(self, value: int):
+        self._threshold = value
+
+    def close(self):
+        if hasattr(self._transport, 'close'):
+            self._transport.close()
+
+    def send(self, message: Union[bytes, bytearray]) -> None:
+        if len(message) and len(message) >= self._threshold:
+            compressed = self.compress(message)
+            if len(compressed) < len(message):
+                self._transport.send(bytes([self.COMPRESSED_FLAG]) + compressed)
+                return
+        self._transport.send(b'\x00' + bytes(message))
+
+    def receive(self) -> bytearray:
+        data = self._transport.receive()
+        if len(data) < 1:
+            raise TransportError("missing compression flags")
+        flags = data[0]
+        if flags == self.COMPRESSED_FLAG:
+            return self.decompress(memoryview(data)[1:])
+        if flags != 0:
+            raise TransportError("unknown compression flags 0x%02x" % flags)
+        return bytearray(data[1:])
+
+    @classmethod
+    def _write_sequence(cls, out: bytearray, literals: Union[bytes, bytearray, memoryview], offset: int,
+                        match_length: int):
+        literal_length = len(literals)
+        token = min(literal_length, cls._RUN_MASK) << 4
+        if match_length:
+            token |= min(match_length - cls._MIN_MATCH, cls._RUN_MASK)
+        out.append(token)
+        if literal_length >= cls._RUN_MASK:
+            cls._write_length(out, literal_length - cls._RUN_MASK)
+        out += literals
+        if match_length:
+            out += struct.pack('<H', offset)
+            if match_length - cls._MIN_MATCH >= cls._RUN_MASK:
+                cls._write_length(out, match_length - cls._MIN_MATCH - cls._RUN_MASK)
+
+    @staticmethod
+    def _write_length(out: bytearray, length: int):
+        while length >= 255:
+            out.append(255)
+            length -= 255
+        out.append(length)
+
+    @classmethod
+    def compress(cls, data: Union[bytes, bytearray]) -> bytes:
+        """ Compress data in the LZ4 block format, output is identical to the C++ compressor. """
+        data = bytes(data)
+        length = len(data)
+        out = bytearray()
+        anchor = 0
+
+        if length > cls._MATCH_FIND_LIMIT:
+            match_limit = length - cls._LAST_LITERALS
+            find_limit = length - cls._MATCH_FIND_LIMIT
+            shift = 32 - cls.HASH_BITS
+            table = [0] * (1 << cls.HASH_BITS)
+            unpack = struct.Struct('<I').unpack_from
+
+            def hash_at(pos: int) -> int:
+                return ((unpack(data, pos)[0] * 2654435761) & 0xFFFFFFFF) >> shift
+
+            table[hash_at(0)] = 0
+            ip = 1
+            while ip <= find_limit:
+                # Find match, step over data faster the longer no match was found.
+                found = False
+                candidate = 0
+                while ip <= find_limit:
+                    h = hash_at(ip)
+                    candidate = table[h]
+                    table[h] = ip
+                    if candidate < ip and ip - candidate <= cls._MAX_DISTANCE and \
+                            data[candidate:candidate + 4] == data[ip:ip + 4]:
+                        found = True
+                        break
+                    ip += 1 + ((ip - anchor) >> 6)
+                if not found:
+                    break
+
+                # Extend match backward and forward.
+                while ip > anchor and candidate > 0 and data[ip - 1] == data[candidate - 1]:
+                    ip -= 1
+                    candidate -= 1
+                match_length = cls._MIN_MATCH
+                while ip + match_length < match_limit and data[candidate + match_length] == data[ip + match_length]:
+                    match_length += 1
+
+                cls._write_sequence(out, data[anchor:ip], ip - candidate, match_length)
+                ip += match_length
+                anchor = ip
+
+                if ip <= find_limit:
+                    table[hash_at(ip - 2)] = ip - 2
+
+        cls._write_sequence(out, data[anchor:], 0, 0)
+        return bytes(out)
+
+    @classmethod
+    def decompress(cls, data: Union[bytes, bytearray, memoryview]) -> bytearray:
+        """ Decompress data in the LZ4 block format.
+
+        Raises:
+            TransportError: When data are malformed.
+        """
+        data = bytes(data)
+        length = len(data)
+        out = bytearray()
+        ip = 0
+
+        def read_length(value: int) -> int:
+            nonlocal ip
+            byte = 255
+            while byte == 255:
+                if ip >= length:
+                    raise TransportError("truncated compressed data")
+                byte = data[ip]
+                ip += 1
+                value += byte
+            return value
+
+        while True:
+            if ip >= length:
+                raise TransportError("truncated compressed data")
+            token = data[ip]
+            ip += 1
+
+            literal_length = token >> 4
+            if literal_length == cls._RUN_MASK:
+                literal_length = read_length(literal_length)
+            if literal_length > length - ip:
+                raise TransportError("truncated compressed data")
+            out += data[ip:ip + literal_length]
+            ip += literal_length
+
+            # Last sequence has literals only.
+            if ip == length:
+                return out
+
+            if length - ip < 2:
+                raise TransportError("truncated compressed data")
+            offset = data[ip] | (data[ip + 1] << 8)
+            ip += 2
+            match_length = token & cls._RUN_MASK
+            if match_length == cls._RUN_MASK:
+                match_length = read_length(match_length)
+            match_length += cls._MIN_MATCH
+            if offset == 0 or offset > len(out):
+                raise TransportError("invalid match offset %d" % offset)
+
+            # Match can overlap with its own output.
+            start = len(out) - offset
+            if offset >= match_length:
+                out += out[start:start + match_length]
+            else:
+                for i in range(match_length):
+                    out.append(out[start + i])
 
 
 class RpmsgTransport(Transport):
@@ -7,7 +7,7 @@
 #
 # SPDX-License-Identifier: BSD-3-Clause
 
-from setuptools import setup
+from setuptools import setup, Extension
 from codecs import open
 from os import path
 
@@ -48,4 +48,6 @@ setup(
     ],
     keywords='rpc rpc-framework embedded multicore multiprocessor amp rpmsg_lite',
     packages=['erpc'],
+    # Optional C implementation of BasicCodec value coding, erpc falls back to pure Python without it.
+    ext_modules=[Extension('erpc._basic_codec', ['erpc/_basic_codec.c'], optional=True)],
 )
@@ -479,11 +479,13 @@ void CGenerator::generate()
     Program *program = nullptr;
     bool generateAllocErrorChecks = true;
     bool generateInfraErrorChecks = true;
+    bool serverArena = false;
     if (m_def->hasProgramSymbol())
     {
         program = m_def->getProgramSymbol();
         generateAllocErrorChecks = (findAnnotation(program, NO_ALLOC_ERRORS_ANNOTATION) == nullptr);
         generateInfraErrorChecks = (findAnnotation(program, NO_INFRA_ERRORS_ANNOTATION) == nullptr);
+        serverArena = (findAnnotation(program, SERVER_ARENA_ANNOTATION) != nullptr);
     }
     /* Generate file with shim code version. */
     m_templateData["versionGuardMacro"] =
@@ -492,6 +494,7 @@ void CGenerator::generate()
     m_templateData["generateInfraErrorChecks"] = generateInfraErrorChecks;
     m_templateData["generateAllocErrorChecks"] = generateAllocErrorChecks;
     m_templateData["generateErrorChecks"] = generateInfraErrorChecks || generateAllocErrorChecks;
+    m_templateData["serverArena"] = serverArena;
 
     data_list empty;
     m_templateData["enums"] = empty;
@@ -581,6 +584,16 @@ void CGenerator::generate()
         groupTemplate["includes"] = makeGroupIncludesTemplateData(group);
         groupTemplate["symbolsMap"] = makeGroupSymbolsTemplateData(group);
         groupTemplate["interfaces"] = makeGroupInterfacesTemplateData(group);
+
+        bool hasStreams = false;
+        for (Interface *iface : group->getInterfaces())
+        {
+            for (Function *fn : iface->getFunctions())
+            {
+                hasStreams = (hasStreams || isStreamFunction(fn));
+            }
+        }
+        groupTemplate["hasStreams"] = hasStreams;
         group->setTemplate(groupTemplate);
 
         generateGroupOutputFiles(group);
@@ -1189,6 +1202,33 @@ data_map CGenerator::getStructDefinitionTemplateData(Group *group, StructType *s
     structInfo["members"] = members; // overwrite member's declaration with whole definition
     structInfo["membersToFree"] = membersToFree;
 
+    // Structures of fixed size are coded at once when codec supports it.
+    uint32_t fixedSize = getFixedWireSize(structType);
+    structInfo["isFixedSize"] = (fixedSize != 0);
+    if (fixedSize != 0)
+    {
+        string fixedEncode;
+        string fixedDecode;
+        uint32_t offset = 0;
+        bool fixedNeedTempVariableI32 = false;
+
+        for (StructMember *member : structType->getMembers())
+        {
+            string memberName = "data->" + getOutputName(member);
+            string memberOffset = format_string("%dU", offset);
+            fixedEncode += getFixedCoderCode(memberName, member->getDataType(), memberOffset, true, 0,
+                                             fixedNeedTempVariableI32);
+            fixedDecode += getFixedCoderCode(memberName, member->getDataType(), memberOffset, false, 0,
+                                             fixedNeedTempVariableI32);
+            offset += getFixedWireSize(member->getDataType());
+        }
+
+        structInfo["fixedSize"] = format_string("%dU", fixedSize);
+        structInfo["fixedEncode"] = fixedEncode;
+        structInfo["fixedDecode"] = fixedDecode;
+        structInfo["fixedNeedTempVariableI32"] = fixedNeedTempVariableI32;
+    }
+
     return structInfo;
 }
 
@@ -1357,6 +1397,9 @@ data_map CGenerator::getFunctionBaseTemplateData(Group *group, FunctionBase *fn)
     info["needTempVariableServerU16"] = false;
     info["needTempVariableClientU16"] = false;
     info["needNullVariableOnServer"] = false;
+    info["retainsParams"] = false;
+    info["isStream"] = false;
+    info["streamParam"] = "";
 
     /* Is function declared as external? */
     info["isNonExternalFunction"] = !findAnnotation(fnSymbol, EXTERNAL_ANNOTATION);
@@ -1409,6 +1452,15 @@ data_map CGenerator::getFunctionBaseTemplateData(Group *group, FunctionBase *fn)
         returnInfo["errorReturnValue"] = getErrorReturnValue(fn);
         returnInfo["isNullReturnType"] =
             (!trueDataType->isScalar() && !trueDataType->isEnum() && !trueDataType->isFunction());
+        if (structMember->isStream())
+        {
+            returnInfo["stream"] = getStreamTemplateData(structMember, "result");
+            info["isStream"] = true;
+        }
+        else
+        {
+            returnInfo["stream"] = "";
+        }
     }
     info["returnValue"] = returnInfo;
 
@@ -1565,6 +1617,23 @@ data_map CGenerator::getFunctionBaseTemplateData(Group *group, FunctionBase *fn)
         // Use shared memory feature instead of serializing/deserializing data.
         bool isShared = (isPointerParam(param) && findAnnotation(param, SHARED_ANNOTATION) != nullptr);
 
+        // Server function gets data inside of received message buffer instead of allocated copy.
+        bool isBorrowed = (findAnnotation(param, BORROWED_ANNOTATION) != nullptr);
+        if (isBorrowed)
+        {
+            ListType *listType = dynamic_cast<ListType *>(paramTrueType);
+            bool isScalarList = (listType && listType->hasLengthVariable() &&
+                                 listType->getElementType()->getTrueDataType()->isScalar());
+            if ((param->getDirection() != param_direction_t::kInDirection) || isShared ||
+                !(paramTrueType->isString() || isScalarList))
+            {
+                throw semantic_error(
+                    format_string("line %d: Annotation @borrowed can be applied only for 'in' parameters of string "
+                                  "type, or of binary or list of scalar types with @length annotation.",
+                                  param->getFirstLine()));
+            }
+        }
+
         string pureCName = "";
         if ((param->getDirection() != param_direction_t::kInDirection) && paramTrueType->isFunction())
         {
@@ -1610,6 +1679,14 @@ data_map CGenerator::getFunctionBaseTemplateData(Group *group, FunctionBase *fn)
         // set parameter direction
         paramInfo["direction"] = getDirection(param->getDirection());
 
+        // Streamed parameter is sent after the invocation message.
+        paramInfo["isStream"] = param->isStream();
+        if (param->isStream())
+        {
+            info["streamParam"] = getStreamTemplateData(param, getOutputName(param));
+            info["isStream"] = true;
+        }
+
         setSymbolDataToSide(param, group->getSymbolDirections(param), paramsToClient, paramsToServer, paramInfo);
 
         if (needTempVariableI32 && param->getDirection() != param_direction_t::kInDirection)
@@ -1624,12 +1701,20 @@ data_map CGenerator::getFunctionBaseTemplateData(Group *group, FunctionBase *fn)
         params.push_back(paramInfo);
 
         // Generating top of freeing functions in generated output.
-        bool l_generateServerFunctionParamFreeFunctions = (!isShared && generateServerFreeFunctions(param));
+        bool l_generateServerFunctionParamFreeFunctions =
+            (!isShared && !isBorrowed && generateServerFreeFunctions(param));
         if (l_generateServerFunctionParamFreeFunctions &&
             (isNeedCallFree(paramType) || paramInfo["firstFreeingCall1"]->getmap()["freeName"]->getvalue() != ""))
         {
             paramsToFree.push_back(paramInfo);
         }
+
+        // Data retained by the served function must not be allocated from the request arena.
+        set<DataType *> loopDetection;
+        if (!generateServerFreeFunctions(param) || containsRetainedMember(paramType, loopDetection))
+        {
+            info["retainsParams"] = true;
+        }
     }
     externalInterfacesList.unique();
     for (auto externalInterface : externalInterfacesList)
@@ -1709,6 +1794,21 @@ data_map CGenerator::getFunctionTemplateData(Group *group, Function *fn)
     string protoInterface = getFunctionPrototype(group, fn, "", "", true);
     info["prototypeInterface"] = protoInterface;
 
+    // Asynchronous variants exist only for functions with reply, own shim code and without streams.
+    bool isAsync = !fn->isOneway() && !useCommonFunction && !isStreamFunction(fn) &&
+                   ((findAnnotation(fn, ASYNC_CALLS_ANNOTATION) != nullptr) ||
+                    (findAnnotation(fn->getInterface(), ASYNC_CALLS_ANNOTATION) != nullptr));
+    info["isAsync"] = isAsync;
+    if (isAsync)
+    {
+        info["prototypeAsyncCpp"] =
+            getAsyncFunctionPrototype(group, fn, getOutputName(fn->getInterface()) + "_client", false);
+        info["prototypeAsyncResultCpp"] =
+            getAsyncFunctionPrototype(group, fn, getOutputName(fn->getInterface()) + "_client", true);
+        info["prototypeAsyncInterface"] = getAsyncFunctionPrototype(group, fn, "", false);
+        info["prototypeAsyncResultInterface"] = getAsyncFunctionPrototype(group, fn, "", true);
+    }
+
     data_list callbackParameters;
     for (auto parameter : fn->getParameters().getMembers())
     {
@@ -2179,6 +2279,55 @@ string CGenerator::getFunctionPrototype(Group *group, FunctionBase *fn, const st
     return getTypenameName(dataTypeReturn, proto); //! return type
 }
 
+string CGenerator::getAsyncFunctionPrototype(Group *group, Function *fn, const string &interfaceName, bool isResult)
+{
+    string proto = getFunctionPrototype(group, fn, interfaceName, "", true);
+    string name = getOutputName(fn);
+    string asyncParams = "erpc::AsyncRequest &asyncRequest";
+    string params;
+    size_t nameStart;
+    size_t paramsStart;
+    size_t paramsEnd;
+    int depth = 1;
+
+    if (interfaceName != "")
+    {
+        name = interfaceName + "::" + name;
+    }
+
+    // Locate parameter list of the function, return type may contain parentheses too.
+    nameStart = proto.find(name + "(");
+    assert(nameStart != string::npos);
+    paramsStart = nameStart + name.size() + 1;
+    paramsEnd = paramsStart;
+    while (depth > 0)
+    {
+        if (proto[paramsEnd] == '(')
+        {
+            ++depth;
+        }
+        else if (proto[paramsEnd] == ')')
+        {
+            --depth;
+        }
+        ++paramsEnd;
+    }
+    params = proto.substr(paramsStart, paramsEnd - paramsStart - 1);
+
+    if (params != "void")
+    {
+        asyncParams += ", " + params;
+    }
+
+    if (isResult)
+    {
+        // Same return type as the function, reply is decoded by this call.
+        return proto.substr(0, nameStart) + name + "_async_result(" + asyncParams + ")" + proto.substr(paramsEnd);
+    }
+
+    return "erpc_status_t " + name + "_async(" + asyncParams + ")";
+}
+
 string CGenerator::generateIncludeGuardName(const string &filename)
 {
     string guard;
@@ -2375,6 +2524,7 @@ void CGenerator::getEncodeDecodeBuiltin(Group *group, BuiltinType *t, data_map &
             else
             {
                 templateData["checkStringNull"] = true;
+                templateData["borrowed"] = (findAnnotation(structMember, BORROWED_ANNOTATION) != nullptr);
                 templateData["stringLocalName"] = getOutputName(structMember);
                 templateData["stringAllocSize"] = getAnnStringValue(structMember, MAX_LENGTH_ANNOTATION);
                 if ((structMember->getDirection() == param_direction_t::kInoutDirection) ||
@@ -2410,6 +2560,7 @@ data_map CGenerator::getEncodeDecodeCall(const string &name, Group *group, DataT
     templateData["freeingCall"] = make_template("", &params);
     templateData["inDataContainer"] = inDataContainer;
     templateData["isElementArrayType"] = false;
+    templateData["borrowed"] = false;
     data_map defMemberAllocation;
     templateData["memberAllocation"] = defMemberAllocation;
     // name used for serializing/deserializing current data type.
@@ -2534,11 +2685,9 @@ data_map CGenerator::getEncodeDecodeCall(const string &name, Group *group, DataT
             templateData["decode"] = m_templateData["decodeArrayType"];
             templateData["encode"] = m_templateData["encodeArrayType"];
 
-            // To improve code serialization/deserialization for scalar types when BasicCodec is used.
-            templateData["builtinTypeName"] =
-                ((m_def->getCodecType() != InterfaceDefinition::codec_t::kBasicCodec) || trueElementType->isBool()) ?
-                    "" :
-                    getScalarTypename(elementType);
+            // Scalar elements are coded at once, except of booleans which codec normalizes one by one.
+            templateData["builtinTypeName"] = trueElementType->isBool() ? "" : getScalarTypename(elementType);
+            templateData["elementKind"] = getElementKind(elementType);
 
             giveBracesToArrays(arrayName);
             templateData["forLoopCount"] = format_string("arrayCount%d", arrayCounter);
@@ -2622,17 +2771,18 @@ data_map CGenerator::getEncodeDecodeCall(const string &name, Group *group, DataT
             // Because cpptempl don't know do correct complicated conditions like
             // if(a || (b && c))
             templateData["useMallocOnClientSide"] = (!isInOut && !isTopDataType);
+            templateData["borrowed"] = (isTopDataType && findAnnotation(structMember, BORROWED_ANNOTATION) != nullptr);
+
+            // Codecs with variable length encoding need to know how to code elements.
+            templateData["elementKind"] = getElementKind(elementType);
 
             templateData["mallocSizeType"] = getTypenameName(elementType, "");
             templateData["mallocType"] = getTypenameName(elementType, "*");
             templateData["needFreeingCall"] =
                 (generateServerFreeFunctions(structMember) && isNeedCallFree(elementType));
 
-            // To improve code serialization/deserialization for scalar types when BasicCodec is used.
-            templateData["builtinTypeName"] =
-                ((m_def->getCodecType() != InterfaceDefinition::codec_t::kBasicCodec) || trueElementType->isBool()) ?
-                    "" :
-                    getScalarTypename(elementType);
+            // Scalar elements are coded at once, except of booleans which codec normalizes one by one.
+            templateData["builtinTypeName"] = trueElementType->isBool() ? "" : getScalarTypename(elementType);
 
             if (generateServerFreeFunctions(structMember))
             {
@@ -3351,6 +3501,73 @@ bool CGenerator::isBinaryList(const ListType *listType)
     return false;
 }
 
+bool CGenerator::isStreamFunction(FunctionBase *fn)
+{
+    bool isStream = fn->getReturnStructMemberType()->isStream();
+
+    for (StructMember *param : fn->getParameters().getMembers())
+    {
+        isStream = (isStream || param->isStream());
+    }
+
+    return isStream;
+}
+
+data_map CGenerator::getStreamTemplateData(StructMember *structMember, const string &name)
+{
+    data_map info;
+    StructType *structType = dynamic_cast<StructType *>(structMember->getDataType()->getTrueDataType());
+    assert(structType != nullptr);
+    assert(structType->getMembers().size() == 1);
+    StructMember *elements = structType->getMembers()[0];
+    ListType *listType = dynamic_cast<ListType *>(elements->getDataType()->getTrueDataType());
+    assert(listType != nullptr);
+    DataType *elementType = listType->getElementType()->getTrueDataType();
+    BuiltinType *builtinType = dynamic_cast<BuiltinType *>(elementType);
+    assert(builtinType != nullptr);
+
+    info["name"] = name;
+    info["elements"] = getOutputName(elements);
+    info["length"] = isBinaryStruct(structType) ? "dataLength" : "elementsCount";
+    info["elementType"] = getBuiltinTypename(builtinType);
+    info["elementKind"] = getElementKind(elementType);
+
+    return info;
+}
+
+bool CGenerator::containsRetainedMember(DataType *dataType, set<DataType *> &dataTypes)
+{
+    // For loops from forward declaration detection.
+    if (dataTypes.insert(dataType).second)
+    {
+        DataType *trueDataType = dataType->getTrueContainerDataType();
+        StructType *structType = nullptr;
+        if (trueDataType->isStruct())
+        {
+            structType = dynamic_cast<StructType *>(trueDataType);
+        }
+        else if (trueDataType->isUnion())
+        {
+            UnionType *unionType = dynamic_cast<UnionType *>(trueDataType);
+            assert(unionType != nullptr);
+            structType = &unionType->getUnionMembers();
+        }
+
+        if (structType != nullptr)
+        {
+            for (StructMember *structMember : structType->getMembers())
+            {
+                if (!generateServerFreeFunctions(structMember) ||
+                    containsRetainedMember(structMember->getDataType(), dataTypes))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
 bool CGenerator::generateServerFreeFunctions(StructMember *structMember)
 {
     return (structMember == nullptr || findAnnotation(structMember, RETAIN_ANNOTATION) == nullptr);
@@ -3454,6 +3671,194 @@ string CGenerator::getScalarTypename(DataType *dataType)
     }
 }
 
+string CGenerator::getElementKind(DataType *dataType)
+{
+    DataType *trueDataType = dataType->getTrueDataType();
+    BuiltinType *builtinType = dynamic_cast<BuiltinType *>(trueDataType);
+
+    if (trueDataType->isFloat())
+    {
+        return "kFloat";
+    }
+    else if (trueDataType->isEnum() ||
+             (builtinType && (builtinType->getBuiltinType() >= BuiltinType::builtin_type_t::kInt8Type) &&
+              (builtinType->getBuiltinType() <= BuiltinType::builtin_type_t::kInt64Type)))
+    {
+        return "kSigned";
+    }
+    else
+    {
+        return "kUnsigned";
+    }
+}
+
+uint32_t CGenerator::getFixedWireSize(DataType *dataType)
+{
+    DataType *trueDataType = dataType->getTrueDataType();
+    uint64_t size = 0;
+
+    switch (trueDataType->getDataType())
+    {
+        case DataType::data_type_t::kBuiltinType:
+        {
+            BuiltinType *builtinType = dynamic_cast<BuiltinType *>(trueDataType);
+            assert(builtinType);
+            switch (builtinType->getBuiltinType())
+            {
+                case BuiltinType::builtin_type_t::kBoolType:
+                case BuiltinType::builtin_type_t::kInt8Type:
+                case BuiltinType::builtin_type_t::kUInt8Type:
+                    size = 1;
+                    break;
+                case BuiltinType::builtin_type_t::kInt16Type:
+                case BuiltinType::builtin_type_t::kUInt16Type:
+                    size = 2;
+                    break;
+                case BuiltinType::builtin_type_t::kInt32Type:
+                case BuiltinType::builtin_type_t::kUInt32Type:
+                case BuiltinType::builtin_type_t::kFloatType:
+                    size = 4;
+                    break;
+                case BuiltinType::builtin_type_t::kInt64Type:
+                case BuiltinType::builtin_type_t::kUInt64Type:
+                case BuiltinType::builtin_type_t::kDoubleType:
+                    size = 8;
+                    break;
+                default:
+                    // Strings and binaries.
+                    break;
+            }
+            break;
+        }
+        case DataType::data_type_t::kEnumType:
+        {
+            size = 4;
+            break;
+        }
+        case DataType::data_type_t::kArrayType:
+        {
+            ArrayType *arrayType = dynamic_cast<ArrayType *>(trueDataType);
+            assert(arrayType);
+            size = (uint64_t)arrayType->getElementCount() * getFixedWireSize(arrayType->getElementType());
+            break;
+        }
+        case DataType::data_type_t::kStructType:
+        {
+            StructType *structType = dynamic_cast<StructType *>(trueDataType);
+            assert(structType);
+            if (findAnnotation(structType, NO_SHARED_ANNOTATION) == nullptr)
+            {
+                for (StructMember *member : structType->getMembers())
+                {
+                    uint32_t memberSize = 0;
+
+                    // Members coded as pointers or with null flag.
+                    if (!member->isByref() && (findAnnotation(member, SHARED_ANNOTATION) == nullptr) &&
+                        (findAnnotation(member, NULLABLE_ANNOTATION) == nullptr) &&
+                        (findAnnotation(member, NO_SHARED_ANNOTATION) == nullptr))
+                    {
+                        memberSize = getFixedWireSize(member->getDataType());
+                    }
+                    if (memberSize == 0)
+                    {
+                        size = 0;
+                        break;
+                    }
+                    size += memberSize;
+                }
+            }
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    return (size <= UINT32_MAX) ? (uint32_t)size : 0;
+}
+
+string CGenerator::getFixedCoderCode(const string &name, DataType *dataType, const string &offset, bool encode,
+                                     uint32_t depth, bool &needTempVariableI32)
+{
+    DataType *trueDataType = dataType->getTrueDataType();
+    string code;
+
+    switch (trueDataType->getDataType())
+    {
+        case DataType::data_type_t::kBuiltinType:
+        {
+            code = format_string("erpc::%s(&fixedData[%s], %s);\n", encode ? "writeFixed" : "readFixed",
+                                 offset.c_str(), name.c_str());
+            break;
+        }
+        case DataType::data_type_t::kEnumType:
+        {
+            if (encode)
+            {
+                code = format_string("erpc::writeFixed(&fixedData[%s], static_cast<int32_t>(%s));\n", offset.c_str(),
+                                     name.c_str());
+            }
+            else
+            {
+                string typeName = getOutputName(trueDataType);
+                if (typeName == "")
+                {
+                    typeName = getAliasName(trueDataType);
+                }
+                needTempVariableI32 = true;
+                code = format_string("erpc::readFixed(&fixedData[%s], _tmp_local_i32);\n", offset.c_str()) +
+                       format_string("%s = static_cast<%s>(_tmp_local_i32);\n", name.c_str(), typeName.c_str());
+            }
+            break;
+        }
+        case DataType::data_type_t::kArrayType:
+        {
+            ArrayType *arrayType = dynamic_cast<ArrayType *>(trueDataType);
+            assert(arrayType);
+            DataType *elementType = arrayType->getElementType();
+            string counter = format_string("fixedCount%d", depth);
+            string elementOffset = format_string("(%s * %dU)", counter.c_str(), getFixedWireSize(elementType));
+            if (offset != "0U")
+            {
+                elementOffset = offset + " + " + elementOffset;
+            }
+            string elementCode =
+                getFixedCoderCode(format_string("%s[%s]", name.c_str(), counter.c_str()), elementType, elementOffset,
+                                  encode, depth + 1, needTempVariableI32);
+
+            code = format_string("for (uint32_t %s = 0U; %s < %dU; ++%s)\n{\n", counter.c_str(), counter.c_str(),
+                                 arrayType->getElementCount(), counter.c_str());
+            istringstream lines(elementCode);
+            string line;
+            while (getline(lines, line))
+            {
+                code += "    " + line + "\n";
+            }
+            code += "}\n";
+            break;
+        }
+        case DataType::data_type_t::kStructType:
+        {
+            string typeName = getOutputName(trueDataType);
+            if (typeName == "")
+            {
+                typeName = getAliasName(trueDataType);
+            }
+            code = format_string("%s_%s_fixed(&fixedData[%s], &(%s));\n", encode ? "write" : "read",
+                                 typeName.c_str(), offset.c_str(), name.c_str());
+            break;
+        }
+        default:
+        {
+            assert(false);
+            break;
+        }
+    }
+
+    return code;
+}
+
 string CGenerator::getDirection(param_direction_t direction)
 {
     switch (direction)
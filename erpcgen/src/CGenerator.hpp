@@ -478,6 +478,22 @@ private:
     std::string getFunctionPrototype(Group *group, FunctionBase *fn, const std::string &interfaceName = "",
                                      const std::string &name = "", bool insideInterfaceCall = false) override;
 
+    /*!
+     * @brief This function return prototype of asynchronous variant of client function.
+     *
+     * Asynchronous variant takes erpc::AsyncRequest as first parameter followed by function parameters.
+     * The _async function sends the request and returns its status, the _async_result function waits
+     * for the reply, decodes it and returns the function result.
+     *
+     * @param[in] group Group to which function belongs.
+     * @param[in] fn Function for prototyping.
+     * @param[in] interfaceName Interface name used for function declaration.
+     * @param[in] isResult True for _async_result prototype, false for _async prototype.
+     *
+     * @return String prototype representation for asynchronous variant of given function.
+     */
+    std::string getAsyncFunctionPrototype(Group *group, Function *fn, const std::string &interfaceName, bool isResult);
+
     /*!
      * @brief This function return interface function representation called by server side.
      *
@@ -700,6 +716,35 @@ private:
      */
     bool containsByrefParamToFree(DataType *dataType, std::set<DataType *> &dataTypes);
 
+    /*!
+     * @brief This function check, if data type contains struct or union member with retain annotation.
+     *
+     * @param[in] dataType Given data type.
+     * @param[in] dataTypes For loops from forward declaration detection.
+     *
+     * @retval True if data type contains member retained by the server, else false.
+     */
+    bool containsRetainedMember(DataType *dataType, std::set<DataType *> &dataTypes);
+
+    /*!
+     * @brief This function check, if function has streamed parameter or return value.
+     *
+     * @param[in] fn Function or function type.
+     *
+     * @retval True if function transfers a value in stream chunk messages, else false.
+     */
+    bool isStreamFunction(FunctionBase *fn);
+
+    /*!
+     * @brief This function returns template data for sending or receiving streamed value.
+     *
+     * @param[in] structMember Streamed parameter or return value, binary or list wrapper structure.
+     * @param[in] name Name of variable with the value.
+     *
+     * @return Names of elements and length members, element type and kind.
+     */
+    cpptempl::data_map getStreamTemplateData(StructMember *structMember, const std::string &name);
+
     /*!
      * @brief This function returns true when structure is used as a wrapper for binary type.
      *
@@ -771,6 +816,43 @@ private:
      */
     std::string getScalarTypename(DataType *dataType);
 
+    /*!
+     * @brief This function returns kind of array or list element for element_kind_t.
+     *
+     * @param[in] dataType Element data type to inspect.
+     *
+     * @retval kFloat When element is floating point number.
+     * @retval kSigned When element is signed integer or enumeration.
+     * @retval kUnsigned Otherwise.
+     */
+    std::string getElementKind(DataType *dataType);
+
+    /*!
+     * @brief This function returns size of data type encoded by BasicCodec, when it is the same for all values.
+     *
+     * Only scalars, enumerations, arrays and structures made of them have fixed size.
+     *
+     * @param[in] dataType Data type to inspect.
+     *
+     * @return Count of bytes, 0 when size is not fixed.
+     */
+    uint32_t getFixedWireSize(DataType *dataType);
+
+    /*!
+     * @brief This function returns code writing or reading data type of fixed size in reserved message data.
+     *
+     * @param[in] name Name of variable.
+     * @param[in] dataType Data type of variable, getFixedWireSize() has to be non-zero.
+     * @param[in] offset Offset of variable in reserved data.
+     * @param[in] encode True for writing, false for reading.
+     * @param[in] depth Nesting depth of array loops.
+     * @param[out] needTempVariableI32 Set to true when enumeration is read through temporary variable.
+     *
+     * @return Code with one statement per line.
+     */
+    std::string getFixedCoderCode(const std::string &name, DataType *dataType, const std::string &offset, bool encode,
+                                  uint32_t depth, bool &needTempVariableI32);
+
     /*!
      * @brief This function returns string representations of function parameter direction.
      *
@@ -261,6 +261,17 @@ data_map JavaGenerator::getFunctionTemplateData(Group *group, Function *fn)
     /* Is function declared as external? */
     info["isNonExternalFunction"] = findAnnotation(fn, EXTERNAL_ANNOTATION) == nullptr;
 
+    bool isStream = fn->getReturnStructMemberType()->isStream();
+    for (StructMember *param : fn->getParameters().getMembers())
+    {
+        isStream = (isStream || param->isStream());
+    }
+    if (isStream)
+    {
+        throw semantic_error(format_string("line %d: Java implementation does not support streamed data of function %s",
+                                           fn->getFirstLine(), fn->getName().c_str()));
+    }
+
     // Get return value info
     data_map returnInfo;
     DataType *returnDataType = fn->getReturnType()->getTrueDataType();
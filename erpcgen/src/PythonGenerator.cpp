@@ -151,7 +151,12 @@ void PythonGenerator::generate()
         groupTemplate["name"] = group->getName();
         groupTemplate["includes"] = makeGroupIncludesTemplateData(group);
         groupTemplate["symbolsMap"] = makeGroupSymbolsTemplateData(group);
-        groupTemplate["interfaces"] = makeGroupInterfacesTemplateData(group);
+        data_list interfaces = makeGroupInterfacesTemplateData(group);
+        for (size_t i = 0; i < interfaces.size(); ++i)
+        {
+            interfaces[i]->getmap()["isAsync"] = isAsyncInterface(group->getInterfaces()[i]);
+        }
+        groupTemplate["interfaces"] = interfaces;
         group->setTemplate(groupTemplate);
 
         generateGroupOutputFiles(group);
@@ -160,6 +165,22 @@ void PythonGenerator::generate()
     initPythonReservedWords();
 }
 
+bool PythonGenerator::isAsyncInterface(Interface *iface)
+{
+    if (findAnnotation(iface, ASYNC_CALLS_ANNOTATION) != nullptr)
+    {
+        return true;
+    }
+    for (Function *fn : iface->getFunctions())
+    {
+        if (findAnnotation(fn, ASYNC_CALLS_ANNOTATION) != nullptr)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void PythonGenerator::setTemplateComments(Symbol *symbol, data_map &symbolInfo)
 {
     symbolInfo["mlComment"] = convertComment(symbol->getMlComment(), comment_type_t::kMultilineComment);
@@ -185,6 +206,8 @@ data_map PythonGenerator::getFunctionTemplateData(Group *group, Function *fn)
     // Get return value info
     data_map returnInfo;
     returnInfo["type"] = getTypeInfo(fn->getReturnType());
+    returnInfo["stream"] = getStreamTemplateData(fn->getReturnStructMemberType());
+    bool isStream = fn->getReturnStructMemberType()->isStream();
     // TODO support annotations on function return values
     //    returnInfo["isNullable"] = (fn->getReturnType()->findAnnotation(NULLABLE_ANNOTATION) != nullptr);
     info["returnValue"] = returnInfo;
@@ -202,6 +225,8 @@ data_map PythonGenerator::getFunctionTemplateData(Group *group, Function *fn)
         string name = getOutputName(param);
         paramInfo["name"] = name;
         paramInfo["type"] = getTypeInfo(paramType);
+        paramInfo["stream"] = getStreamTemplateData(param);
+        isStream = (isStream || param->isStream());
 
         bool isNullable = ((findAnnotation(param, NULLABLE_ANNOTATION) != nullptr) &&
                            (trueDataType->isString() || (!trueDataType->isBuiltin() && !trueDataType->isEnum())));
@@ -268,6 +293,7 @@ data_map PythonGenerator::getFunctionTemplateData(Group *group, Function *fn)
     info["parameters"] = params;
     info["inParameters"] = inParams;
     info["outParameters"] = outParams;
+    info["isStream"] = isStream;
 
     return info;
 }
@@ -429,6 +455,7 @@ data_map PythonGenerator::makeGroupSymbolsTemplateData(Group *group)
     data_list structs;
     data_list unions;
     data_list aliases;
+    bool hasFixedRuns = false;
 
     Log::info("Group symbols:\n");
 
@@ -463,6 +490,7 @@ data_map PythonGenerator::makeGroupSymbolsTemplateData(Group *group)
 
                         setTemplateComments(structType, info);
                         setStructMembersTemplateData(structType, info);
+                        hasFixedRuns = hasFixedRuns || !info["fixedRuns"]->getlist().empty();
 
                         names.insert(name);
                         structs.push_back(info);
@@ -533,6 +561,7 @@ data_map PythonGenerator::makeGroupSymbolsTemplateData(Group *group)
     }
 
     symbolsTemplate["structs"] = structs;
+    symbolsTemplate["hasFixedRuns"] = hasFixedRuns;
     symbolsTemplate["unions"] = unions;
     symbolsTemplate["aliases"] = aliases;
 
@@ -542,6 +571,9 @@ data_map PythonGenerator::makeGroupSymbolsTemplateData(Group *group)
 void PythonGenerator::setStructMembersTemplateData(StructType *structType, data_map &structInfo)
 {
     data_list members;
+    data_list fixedRuns;
+    vector<data_map> memberInfos;
+    vector<pair<size_t, string>> run;
     for (auto member : structType->getMembers())
     {
         data_map member_info;
@@ -569,10 +601,98 @@ void PythonGenerator::setStructMembersTemplateData(StructType *structType, data_
         }
 
         member_info["serializedViaMember"] = (referencedFrom) ? getOutputName(referencedFrom) : "";
+        member_info["inFixedRun"] = false;
+        member_info["fixedRunStart"] = false;
+        member_info["fixedRunEnd"] = false;
         setOneStructMemberTemplateData(member, member_info);
+        memberInfos.push_back(member_info);
+
+        // Consecutive serialized members of fixed size are coded together with one precompiled struct format.
+        if (!referencedFrom)
+        {
+            DataType *trueDataType = member->getDataType()->getTrueDataType();
+            ArrayType *arrayType = dynamic_cast<ArrayType *>(trueDataType);
+            string code = getFixedCode((arrayType) ? arrayType->getElementType() : trueDataType);
+            if (code.empty())
+            {
+                addFixedRun(memberInfos, run, fixedRuns);
+                run.clear();
+            }
+            else
+            {
+                run.push_back(make_pair(memberInfos.size() - 1, (arrayType) ? to_string(arrayType->getElementCount()) +
+                                                                                  code :
+                                                                              code));
+            }
+        }
+    }
+    addFixedRun(memberInfos, run, fixedRuns);
+
+    for (data_map &member_info : memberInfos)
+    {
         members.push_back(member_info);
     }
     structInfo["members"] = members;
+    structInfo["fixedRuns"] = fixedRuns;
+}
+
+void PythonGenerator::addFixedRun(vector<data_map> &memberInfos, const vector<pair<size_t, string>> &run,
+                                  data_list &fixedRuns)
+{
+    // Single members are coded directly by the codec.
+    if (run.size() < 2)
+    {
+        return;
+    }
+
+    string format = "<";
+    string values;
+    string targets;
+    data_list reads;
+    bool unpack = true;
+    size_t valueIndex = 0;
+    for (const auto &runMember : run)
+    {
+        data_map &member_info = memberInfos[runMember.first];
+        string name = "self." + member_info["name"]->getvalue();
+        string separator = values.empty() ? "" : ", ";
+        data_map read;
+        read["name"] = name;
+        format += runMember.second;
+        if (member_info["type"]->getmap()["type"]->getvalue() == "array")
+        {
+            size_t count = stoul(runMember.second);
+            values += separator + "*" + name;
+            read["value"] = format_string("list(_v[%zu:%zu])", valueIndex, valueIndex + count);
+            valueIndex += count;
+            unpack = false;
+        }
+        else
+        {
+            values += separator + name;
+            read["value"] = format_string("_v[%zu]", valueIndex);
+            ++valueIndex;
+        }
+        targets += separator + name;
+        reads.push_back(read);
+    }
+
+    data_map fixedRun;
+    fixedRun["index"] = static_cast<unsigned int>(fixedRuns.size());
+    fixedRun["format"] = format;
+    fixedRun["values"] = values;
+    fixedRun["targets"] = targets;
+    fixedRun["unpack"] = unpack;
+    fixedRun["reads"] = reads;
+    fixedRuns.push_back(fixedRun);
+
+    for (const auto &runMember : run)
+    {
+        memberInfos[runMember.first]["inFixedRun"] = true;
+        memberInfos[runMember.first]["fixedRun"] = fixedRun;
+    }
+    memberInfos[run.front().first]["fixedRunStart"] = true;
+    memberInfos[run.back().first]["fixedRunEnd"] = true;
 }
 
 void PythonGenerator::setOneStructMemberTemplateData(StructMember *member, data_map &member_info)
@@ -598,6 +718,7 @@ data_map PythonGenerator::getTypeInfo(DataType *t)
     data_map info;
     info["name"] = filterName(getOutputName(t, false));
     info["isNonEncapsulatedUnion"] = false;
+    info["fixedCode"] = getFixedCode(t);
     switch (t->getDataType())
     {
         case DataType::data_type_t::kAliasType:
@@ -795,6 +916,96 @@ data_map PythonGenerator::getTypeInfo(DataType *t)
     return info;
 }
 
+data_ptr PythonGenerator::getStreamTemplateData(StructMember *structMember)
+{
+    if (!structMember->isStream())
+    {
+        return "";
+    }
+
+    data_map info;
+    DataType *trueDataType = structMember->getDataType()->getTrueDataType();
+    if (trueDataType->isBinary())
+    {
+        info["code"] = "B";
+        info["isBinary"] = true;
+    }
+    else
+    {
+        ListType *listType = dynamic_cast<ListType *>(trueDataType);
+        assert(listType != nullptr);
+        info["code"] = getFixedCode(listType->getElementType());
+        info["isBinary"] = false;
+    }
+    return info;
+}
+
+string PythonGenerator::getFixedCode(DataType *t)
+{
+    DataType *trueDataType = t->getTrueDataType();
+
+    if (trueDataType->isEnum())
+    {
+        return "i";
+    }
+    if (trueDataType->getDataType() != DataType::data_type_t::kBuiltinType)
+    {
+        return "";
+    }
+
+    switch (dynamic_cast<const BuiltinType *>(trueDataType)->getBuiltinType())
+    {
+        case BuiltinType::builtin_type_t::kBoolType:
+        {
+            return "?";
+        }
+        case BuiltinType::builtin_type_t::kInt8Type:
+        {
+            return "b";
+        }
+        case BuiltinType::builtin_type_t::kInt16Type:
+        {
+            return "h";
+        }
+        case BuiltinType::builtin_type_t::kInt32Type:
+        {
+            return "i";
+        }
+        case BuiltinType::builtin_type_t::kInt64Type:
+        {
+            return "q";
+        }
+        case BuiltinType::builtin_type_t::kUInt8Type:
+        {
+            return "B";
+        }
+        case BuiltinType::builtin_type_t::kUInt16Type:
+        {
+            return "H";
+        }
+        case BuiltinType::builtin_type_t::kUInt32Type:
+        {
+            return "I";
+        }
+        case BuiltinType::builtin_type_t::kUInt64Type:
+        {
+            return "Q";
+        }
+        case BuiltinType::builtin_type_t::kFloatType:
+        {
+            return "f";
+        }
+        case BuiltinType::builtin_type_t::kDoubleType:
+        {
+            return "d";
+        }
+        default:
+        {
+            return "";
+        }
+    }
+}
+
 string PythonGenerator::getBuiltinTypename(const BuiltinType *t)
 {
     switch (t->getBuiltinType())
@@ -203,6 +203,15 @@ protected:
      */
     void makeAliasesTemplateData();
 
+    /*!
+     * @brief This function returns if asyncio client is generated for the interface.
+     *
+     * @param[in] iface Interface.
+     *
+     * @retval true When interface or any of its functions has @async_calls annotation.
+     */
+    bool isAsyncInterface(Interface *iface);
+
     /*!
      * @brief This function sets struct member information to struct data map variable.
      *
@@ -214,6 +223,18 @@ protected:
      */
     void setStructMembersTemplateData(StructType *structType, cpptempl::data_map &structInfo);
 
+    /*!
+     * @brief This function adds run of consecutive fixed size struct members to struct template data.
+     *
+     * Runs shorter than two members are ignored. Members of added run are marked in their template data.
+     *
+     * @param[in,out] memberInfos Template data of struct members.
+     * @param[in] run Indexes of run members in memberInfos with their struct module formats.
+     * @param[in,out] fixedRuns Template data of struct runs.
+     */
+    void addFixedRun(std::vector<cpptempl::data_map> &memberInfos, const std::vector<std::pair<size_t, std::string>> &run,
+                     cpptempl::data_list &fixedRuns);
+
     /*!
      * @brief Fill in template data for a single struct member.
      */
@@ -240,6 +261,24 @@ protected:
      */
     std::string getBuiltinTypename(const BuiltinType *t);
 
+    /*!
+     * @brief This function return struct module format character for given data type.
+     *
+     * @param[in] t Data type.
+     *
+     * @return Format character for scalar and enum types, empty string for other types.
+     */
+    std::string getFixedCode(DataType *t);
+
+    /*!
+     * @brief This function return template data of streamed parameter or return value.
+     *
+     * @param[in] structMember Parameter or return value.
+     *
+     * @return Format character of elements and binary flag, empty string when the value is not streamed.
+     */
+    cpptempl::data_ptr getStreamTemplateData(StructMember *structMember);
+
     /*!
      * @brief Filter symbol names.
      */
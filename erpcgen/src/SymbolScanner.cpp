@@ -1185,6 +1185,10 @@ AstNode *SymbolScanner::handleFunction(AstNode *node, top_down)
             {
                 addAnnotations(returnNode->getChild(1), func->getReturnStructMemberType());
             }
+            if ((returnNode->childCount() > 2) && (returnNode->getChild(2) != nullptr))
+            {
+                func->getReturnStructMemberType()->setStream(true);
+            }
         }
         else
         {
@@ -1245,6 +1249,8 @@ AstNode *SymbolScanner::handleFunction(AstNode *node, bottom_up)
 
         /* Function annotations. */
         addAnnotations(node->getChild(5), func);
+
+        checkStreams(func, true);
     }
     else /* function definition */
     {
@@ -1254,6 +1260,8 @@ AstNode *SymbolScanner::handleFunction(AstNode *node, bottom_up)
         /* Function annotations. */
         addAnnotations(node->getChild(5), func);
 
+        checkStreams(func, false);
+
         /* Add missing callbacks parameters. */
         FunctionType *callbackFunctionType = func->getFunctionType();
         if (callbackFunctionType)
@@ -1408,6 +1416,10 @@ AstNode *SymbolScanner::handleParam(AstNode *node, top_down)
             param = new StructMember("", dataType);
         }
         setParameterDirection(param, (*node)[2]);
+        if ((node->childCount() > 4) && ((*node)[4] != nullptr))
+        {
+            param->setStream(true);
+        }
     }
 
     Log::debug("param: %s\n", param->getName().c_str());
@@ -1463,6 +1475,72 @@ void SymbolScanner::setParameterDirection(StructMember *param, AstNode *directio
     param->setDirection(param_direction);
 }
 
+void SymbolScanner::checkStreams(FunctionBase *func, bool isFunctionType)
+{
+    bool hasStreamParam = false;
+
+    for (StructMember *param : func->getParameters().getMembers())
+    {
+        if (param->isStream())
+        {
+            if (hasStreamParam)
+            {
+                throw semantic_error(format_string("line %d: Function can have only one streamed parameter.",
+                                                   param->getFirstLine()));
+            }
+            if (param->getDirection() != param_direction_t::kInDirection)
+            {
+                throw semantic_error(format_string("line %d: Streamed parameter '%s' has to be 'in' parameter.",
+                                                   param->getFirstLine(), param->getName().c_str()));
+            }
+            checkStreamedValue(param, isFunctionType);
+            hasStreamParam = true;
+        }
+    }
+
+    StructMember *returnValue = func->getReturnStructMemberType();
+    if ((returnValue != nullptr) && returnValue->isStream())
+    {
+        checkStreamedValue(returnValue, isFunctionType);
+    }
+}
+
+void SymbolScanner::checkStreamedValue(StructMember *member, bool isFunctionType)
+{
+    DataType *dataType = member->getDataType()->getTrueDataType();
+    bool isValid = dataType->isBinary();
+
+    if (isFunctionType)
+    {
+        throw semantic_error(
+            format_string("line %d: Callback types cannot have streamed parameters or return values.",
+                          member->getFirstLine()));
+    }
+
+    if (dataType->isList())
+    {
+        ListType *listType = dynamic_cast<ListType *>(dataType);
+        assert(listType);
+        DataType *elementType = listType->getElementType()->getTrueDataType();
+        isValid = (elementType->isInt() || elementType->isFloat());
+    }
+
+    if (!isValid)
+    {
+        throw semantic_error(format_string(
+            "line %d: Streamed value has to be binary or list of integer or floating point numbers.",
+            member->getFirstLine()));
+    }
+
+    if ((member->findAnnotation(LENGTH_ANNOTATION, Annotation::program_lang_t::kAll) != nullptr) ||
+        (member->findAnnotation(NULLABLE_ANNOTATION, Annotation::program_lang_t::kAll) != nullptr) ||
+        (member->findAnnotation(SHARED_ANNOTATION, Annotation::program_lang_t::kAll) != nullptr))
+    {
+        throw semantic_error(format_string(
+            "line %d: Streamed value cannot have @length, @nullable or @shared annotation.", member->getFirstLine()));
+    }
+}
+
 AstNode *SymbolScanner::handleExpr(AstNode *node, bottom_up)
 {
     (void)node;
@@ -437,6 +437,30 @@ protected:
      */
     void setParameterDirection(StructMember *param, AstNode *directionNode);
 
+    /*!
+     * @brief Check streamed parameter and return value of function.
+     *
+     * Function can have one streamed 'in' parameter and streamed return value.
+     *
+     * @param[in] func Checked function or function type.
+     * @param[in] isFunctionType True for function types, which cannot have streamed values.
+     *
+     * @exception semantic_error Thrown when streamed value is not allowed.
+     */
+    void checkStreams(FunctionBase *func, bool isFunctionType);
+
+    /*!
+     * @brief Check type and annotations of streamed value.
+     *
+     * Streamed value has to be binary or list of integer or floating point numbers.
+     *
+     * @param[in] member Streamed parameter or return value.
+     * @param[in] isFunctionType True for function types, which cannot have streamed values.
+     *
+     * @exception semantic_error Thrown when streamed value is not allowed.
+     */
+    void checkStreamedValue(StructMember *member, bool isFunctionType);
+
     /*!
      * @brief Get value from symbol table for name defined by given token
      *
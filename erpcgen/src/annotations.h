@@ -10,6 +10,12 @@
 #ifndef _EMBEDDED_RPC__ANNOTATIONS_H_
 #define _EMBEDDED_RPC__ANNOTATIONS_H_
 
+//! Generate asynchronous client functions for the annotated interface or function.
+#define ASYNC_CALLS_ANNOTATION "async_calls"
+
+//! Pass the parameter to the server function as a view into the received message buffer.
+#define BORROWED_ANNOTATION "borrowed"
+
 //! Define union discriminator name for non-encapsulated unions.
 #define CRC_ANNOTATION "crc"
 
@@ -70,6 +76,9 @@
 //! Scope name for erpc shim code
 #define SCOPE_NAME_ANNOTATION "scope_name"
 
+//! Allocate parameters decoded by the server shim from the per-request arena
+#define SERVER_ARENA_ANNOTATION "server_arena"
+
 //! Data handled through shared memory area
 #define SHARED_ANNOTATION "shared"
 
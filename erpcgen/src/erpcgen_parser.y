@@ -147,6 +147,7 @@ token_loc_t mergeLocation(const token_loc_t & l1, const token_loc_t & l2);
 %token <m_token> TOK_INOUT        "inout"
 %token <m_token> TOK_ASYNC        "async"
 %token <m_token> TOK_ONEWAY       "oneway"
+%token <m_token> TOK_STREAM       "stream"
 %token <m_token> TOK_LIST         "list"
 %token <m_token> TOK_REF          "ref"
 %token <m_token> TOK_TRUE         "true"
@@ -248,6 +249,7 @@ token_loc_t mergeLocation(const token_loc_t & l1, const token_loc_t & l2);
 %type <m_ast> union_member_list
 %type <m_token> param_dir
 %type <m_token> param_dir_in
+%type <m_token> stream_opt
 %type <m_int> struct_member_options
 %type <m_int> struct_member_options_list
 
@@ -559,6 +561,13 @@ function_return_type
                             $$->appendChild($simple_data_type);
                             $$->appendChild($annotation_list_opt);
                         }
+                |   annotation_list_opt TOK_STREAM[stream] simple_data_type
+                        {
+                            $$ = new AstNode(Token(TOK_RETURN));
+                            $$->appendChild($simple_data_type);
+                            $$->appendChild($annotation_list_opt);
+                            $$->appendChild(new AstNode(*$stream));
+                        }
                 |   TOK_VOID
                         {
                             $$ = new AstNode(Token(TOK_RETURN));
@@ -620,9 +629,9 @@ param_list_in   :   param_def_in
                 ;
 
 /*
- * TOK_PARAM -> ( ident simple_data_type ( TOK_CHILDREN -> TOK_ANNOTATION* ) )
+ * TOK_PARAM -> ( ident simple_data_type param_dir ( TOK_CHILDREN -> TOK_ANNOTATION* ) stream_opt )
  */
-param_def       :   param_dir[dir] simple_data_type_scope[datatype] ident_opt[name] annotation_list_opt[annotations]
+param_def       :   param_dir[dir] stream_opt[stream] simple_data_type_scope[datatype] ident_opt[name] annotation_list_opt[annotations]
                         {
                             $$ = new AstNode(Token(TOK_PARAM, NULL, @name));
                             $$->appendChild($name);
@@ -630,6 +639,8 @@ param_def       :   param_dir[dir] simple_data_type_scope[datatype] ident_opt[na
                             AstNode *n = ($dir) ? new AstNode(*$dir) : NULL;
                             $$->appendChild(n);
                             $$->appendChild($annotations);
+                            n = ($stream) ? new AstNode(*$stream) : NULL;
+                            $$->appendChild(n);
                         }
                 ;
 
@@ -656,6 +667,16 @@ param_dir_in    :   TOK_IN
                             $$ = NULL;
                         }
 
+stream_opt      :   TOK_STREAM
+                        {
+                            $$ = $1;
+                        }
+                |   /* empty */
+                        {
+                            $$ = NULL;
+                        }
+                ;
+
 param_dir       :   param_dir_in
                         {
                             $$ = $param_dir_in;
@@ -48,7 +48,7 @@ public:
      */
     StructMember(const std::string &name, DataType *dataType) :
     Symbol(symbol_type_t::kStructMemberSymbol, name), m_dataType(dataType), m_paramDirection(), m_containList(),
-    m_containString(), m_byref(false)
+    m_containString(), m_byref(false), m_stream(false)
     {
     }
 
@@ -62,7 +62,7 @@ public:
      */
     StructMember(const Token &tok, DataType *dataType) :
     Symbol(symbol_type_t::kStructMemberSymbol, tok), m_dataType(dataType), m_paramDirection(), m_containList(),
-    m_containString(), m_byref(false)
+    m_containString(), m_byref(false), m_stream(false)
     {
     }
 
@@ -156,12 +156,27 @@ public:
      */
     void setByref(bool byref) { m_byref = byref; }
 
+    /*!
+     * @brief This function returns information if parameter or return value is streamed.
+     *
+     * @retval True when value is transferred in stream chunk messages, else false.
+     */
+    bool isStream() { return m_stream; }
+
+    /*!
+     * @brief This function sets stream flag to the parameter or return value.
+     *
+     * @param[in] stream Flag to set stream option.
+     */
+    void setStream(bool stream) { m_stream = stream; }
+
 protected:
     DataType *m_dataType;               /*!< Struct member data type. */
     param_direction_t m_paramDirection; /*!< Direction in which is member used. */
     bool m_containList;                 /*!< True when member contains list type */
     bool m_containString;               /*!< True when member contains string type */
     bool m_byref;                       /*!< True when member is byref type */
+    bool m_stream;                      /*!< True when parameter or return value is streamed */
 };
 
 } // namespace erpcgen
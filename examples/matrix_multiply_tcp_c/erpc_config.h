@@ -45,6 +45,17 @@
 #define ERPC_MESSAGE_LOGGING_DISABLED (0U) //!< Trace functions disabled.
 #define ERPC_MESSAGE_LOGGING_ENABLED (1U)  //!< Trace functions enabled.
 
+#define ERPC_CRC16_IMPLEMENTATION_BITWISE (0U)      //!< CRC16 computed bit by bit, smallest code.
+#define ERPC_CRC16_IMPLEMENTATION_TABLE (1U)        //!< CRC16 computed with 512 B lookup table.
+#define ERPC_CRC16_IMPLEMENTATION_SLICING_BY_8 (2U) //!< CRC16 computed 8 bytes at once with 4 KB lookup tables.
+#define ERPC_CRC16_IMPLEMENTATION_PORT (3U)         //!< CRC16 computed by erpc_crc16_port_compute() of the port.
+
+#define ERPC_LARGE_MESSAGES_DISABLED (0U) //!< 16-bit message sizes, messages up to 64 KB.
+#define ERPC_LARGE_MESSAGES_ENABLED (1U)  //!< 32-bit message sizes, messages up to 4 GB.
+
+#define ERPC_SERVICE_DISPATCH_TABLE_DISABLED (0U) //!< Services are searched in linked list.
+#define ERPC_SERVICE_DISPATCH_TABLE_ENABLED (1U)  //!< Services are indexed by service ID.
+
 #define ERPC_TRANSPORT_MU_USE_MCMGR_DISABLED (0U) //!< Do not use MCMGR for MU ISR management.
 #define ERPC_TRANSPORT_MU_USE_MCMGR_ENABLED (1U)  //!< Use MCMGR for MU ISR management.
 
@@ -53,6 +64,15 @@
 
 #define ERPC_PRE_POST_ACTION_DEFAULT_DISABLED (0U) //!< Pre post shim default callbacks functions disabled.
 #define ERPC_PRE_POST_ACTION_DEFAULT_ENABLED (1U)  //!< Pre post shim default callback functions enabled.
+
+#define ERPC_STATS_DISABLED (0U) //!< Call statistics disabled.
+#define ERPC_STATS_ENABLED (1U)  //!< Call statistics enabled.
+
+#define ERPC_CLIENT_REQUEST_CACHE_DISABLED (0U) //!< Codec and message buffer allocated for each client request.
+#define ERPC_CLIENT_REQUEST_CACHE_ENABLED (1U)  //!< Codec and message buffer cached for each calling thread.
+
+#define ERPC_SERVER_ARENA_DISABLED (0U) //!< Server shims allocate decoded parameters by erpc_malloc().
+#define ERPC_SERVER_ARENA_ENABLED (1U)  //!< Server shims allocate decoded parameters from per-request arena.
 //@}
 
 //! @name Configuration options
@@ -8,10 +8,18 @@ if [ "$1" = "clang" ]; then
     echo "Compiling by clang compiler."
     CC=clang CXX=clang++ make all
     python3 test/run_unit_tests.py clang
+    # C tests once more with messages compressed
+    CC=clang CXX=clang++ python3 test/run_unit_tests.py -B build_compressing --conf-file test/prj_compressing.conf -C c -S c
 else
     echo "Compiling by default gnu compiler."
     CC=gcc CXX=g++ make all
     python3 test/run_unit_tests.py gcc
+    # C tests once more with messages compressed
+    CC=gcc CXX=g++ python3 test/run_unit_tests.py -B build_compressing --conf-file test/prj_compressing.conf -C c -S c
 fi
 
+# Tests of transports, build directory was configured by run_unit_tests.py
+cmake --build build --target erpc_transport_tests
+ctest --test-dir build --output-on-failure
+
 pytest erpcgen/test/
@@ -43,9 +43,23 @@
 #define ERPC_NESTED_CALLS_DETECTION_DISABLED (0U) //!< Nested calls detection disabled.
 #define ERPC_NESTED_CALLS_DETECTION_ENABLED (1U)  //!< Nested calls detection enabled.
 
+#define ERPC_ASYNC_CALLS_DISABLED (0U) //!< No asynchronous calls support.
+#define ERPC_ASYNC_CALLS_ENABLED (1U)  //!< Asynchronous calls support.
+
 #define ERPC_MESSAGE_LOGGING_DISABLED (0U) //!< Trace functions disabled.
 #define ERPC_MESSAGE_LOGGING_ENABLED (1U)  //!< Trace functions enabled.
 
+#define ERPC_CRC16_IMPLEMENTATION_BITWISE (0U)      //!< CRC16 computed bit by bit, smallest code.
+#define ERPC_CRC16_IMPLEMENTATION_TABLE (1U)        //!< CRC16 computed with 512 B lookup table.
+#define ERPC_CRC16_IMPLEMENTATION_SLICING_BY_8 (2U) //!< CRC16 computed 8 bytes at once with 4 KB lookup tables.
+#define ERPC_CRC16_IMPLEMENTATION_PORT (3U)         //!< CRC16 computed by erpc_crc16_port_compute() of the port.
+
+#define ERPC_LARGE_MESSAGES_DISABLED (0U) //!< 16-bit message sizes, messages up to 64 KB.
+#define ERPC_LARGE_MESSAGES_ENABLED (1U)  //!< 32-bit message sizes, messages up to 4 GB.
+
+#define ERPC_SERVICE_DISPATCH_TABLE_DISABLED (0U) //!< Services are searched in linked list.
+#define ERPC_SERVICE_DISPATCH_TABLE_ENABLED (1U)  //!< Services are indexed by service ID.
+
 #define ERPC_TRANSPORT_MU_USE_MCMGR_DISABLED (0U) //!< Do not use MCMGR for MU ISR management.
 #define ERPC_TRANSPORT_MU_USE_MCMGR_ENABLED (1U)  //!< Use MCMGR for MU ISR management.
 
@@ -54,6 +68,15 @@
 
 #define ERPC_PRE_POST_ACTION_DEFAULT_DISABLED (0U) //!< Pre post shim default callbacks functions disabled.
 #define ERPC_PRE_POST_ACTION_DEFAULT_ENABLED (1U)  //!< Pre post shim default callback functions enabled.
+
+#define ERPC_STATS_DISABLED (0U) //!< Call statistics disabled.
+#define ERPC_STATS_ENABLED (1U)  //!< Call statistics enabled.
+
+#define ERPC_CLIENT_REQUEST_CACHE_DISABLED (0U) //!< Codec and message buffer allocated for each client request.
+#define ERPC_CLIENT_REQUEST_CACHE_ENABLED (1U)  //!< Codec and message buffer cached for each calling thread.
+
+#define ERPC_SERVER_ARENA_DISABLED (0U) //!< Server shims allocate decoded parameters by erpc_malloc().
+#define ERPC_SERVER_ARENA_ENABLED (1U)  //!< Server shims allocate decoded parameters from per-request arena.
 //@}
 
 //! @name Configuration options
@@ -140,6 +163,37 @@
 //! to support nested calls. See ERPC_NESTED_CALLS macro.
 //#define ERPC_NESTED_CALLS_DETECTION (ERPC_NESTED_CALLS_DETECTION_DISABLED)
 
+//! @def ERPC_ASYNC_CALLS
+//!
+//! Enable client functions with _async suffix, which send a request without waiting for its reply.
+//! Default set to ERPC_ASYNC_CALLS_DISABLED.
+#define ERPC_ASYNC_CALLS (ERPC_ASYNC_CALLS_ENABLED)
+
+//! @def ERPC_SERVICE_DISPATCH_TABLE
+//!
+//! Default set to ERPC_SERVICE_DISPATCH_TABLE_DISABLED, the server searches the linked list of added services for
+//! each received request. Uncomment to look up services with ID lower than 256 in an array indexed by service ID,
+//! which takes 256 pointers of RAM in each server object.
+#define ERPC_SERVICE_DISPATCH_TABLE (ERPC_SERVICE_DISPATCH_TABLE_ENABLED)
+
+//! @def ERPC_STATS
+//!
+//! Enable per method call statistics of clients and servers, read by erpc_server_get_stats() and
+//! erpc_client_get_stats(). Default set to ERPC_STATS_DISABLED.
+#define ERPC_STATS (ERPC_STATS_ENABLED)
+
+//! @def ERPC_CLIENT_REQUEST_CACHE
+//!
+//! Keep codec and message buffer of released client request for the next request of the same thread.
+//! Default set to ERPC_CLIENT_REQUEST_CACHE_DISABLED.
+#define ERPC_CLIENT_REQUEST_CACHE (ERPC_CLIENT_REQUEST_CACHE_ENABLED)
+
+//! @def ERPC_SERVER_ARENA
+//!
+//! Allocate parameters decoded by shims generated with @server_arena annotation from per-request arena of the server.
+//! Default set to ERPC_SERVER_ARENA_DISABLED.
+#define ERPC_SERVER_ARENA (ERPC_SERVER_ARENA_ENABLED)
+
 //! @def ERPC_MESSAGE_LOGGING
 //!
 //! Enable eRPC message logging code through the eRPC. Take look into "erpc_message_loggers.h". Can be used for base
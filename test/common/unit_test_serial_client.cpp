@@ -6,7 +6,11 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#if UNIT_TEST_COMPACT_CODEC
+#include "erpc_compact_codec.hpp"
+#else
 #include "erpc_basic_codec.hpp"
+#endif
 #include "erpc_client_manager.h"
 #include "erpc_serial_transport.hpp"
 
@@ -28,6 +32,10 @@
 #define UNIT_TEST_SERIAL_BAUD 115200
 #endif
 
+#ifndef UNIT_TEST_MESSAGE_BUFFER_SIZE
+#define UNIT_TEST_MESSAGE_BUFFER_SIZE 1024
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Code
 ////////////////////////////////////////////////////////////////////////////////
@@ -38,8 +46,8 @@ class MyMessageBufferFactory : public MessageBufferFactory
 public:
     virtual MessageBuffer create()
     {
-        uint8_t *buf = new uint8_t[1024];
-        return MessageBuffer(buf, 1024);
+        uint8_t *buf = new uint8_t[UNIT_TEST_MESSAGE_BUFFER_SIZE];
+        return MessageBuffer(buf, UNIT_TEST_MESSAGE_BUFFER_SIZE);
     }
 
     virtual void dispose(MessageBuffer *buf)
@@ -54,7 +62,11 @@ public:
 
 SerialTransport g_transport(UNIT_TEST_SERIAL_PORT, UNIT_TEST_SERIAL_BAUD);
 MyMessageBufferFactory g_msgFactory;
-BasicCodecFactory g_basicCodecFactory;
+#if UNIT_TEST_COMPACT_CODEC
+CompactCodecFactory g_codecFactory;
+#else
+BasicCodecFactory g_codecFactory;
+#endif
 ClientManager *g_client;
 
 Crc16 g_crc16;
@@ -86,7 +98,7 @@ int main(int argc, char **argv)
     g_transport.setCrc16(&g_crc16);
     g_client->setMessageBufferFactory(&g_msgFactory);
     g_client->setTransport(&g_transport);
-    g_client->setCodecFactory(&g_basicCodecFactory);
+    g_client->setCodecFactory(&g_codecFactory);
     erpc_client_t client = reinterpret_cast<erpc_client_t>(g_client);
     initInterfaces_common(client);
     initInterfaces(client);
@@ -6,7 +6,11 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#if UNIT_TEST_COMPACT_CODEC
+#include "erpc_compact_codec.hpp"
+#else
 #include "erpc_basic_codec.hpp"
+#endif
 #include "erpc_serial_transport.hpp"
 #include "erpc_simple_server.hpp"
 
@@ -29,6 +33,10 @@
 #define UNIT_TEST_SERIAL_BAUD 115200
 #endif
 
+#ifndef UNIT_TEST_MESSAGE_BUFFER_SIZE
+#define UNIT_TEST_MESSAGE_BUFFER_SIZE 1024
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Code
 ////////////////////////////////////////////////////////////////////////////////
@@ -40,8 +48,8 @@ class MyMessageBufferFactory : public MessageBufferFactory
 public:
     virtual MessageBuffer create()
     {
-        uint8_t *buf = new uint8_t[1024];
-        return MessageBuffer(buf, 1024);
+        uint8_t *buf = new uint8_t[UNIT_TEST_MESSAGE_BUFFER_SIZE];
+        return MessageBuffer(buf, UNIT_TEST_MESSAGE_BUFFER_SIZE);
     }
 
     virtual void dispose(MessageBuffer *buf)
@@ -56,7 +64,11 @@ public:
 
 SerialTransport g_transport(UNIT_TEST_SERIAL_PORT, UNIT_TEST_SERIAL_BAUD);
 MyMessageBufferFactory g_msgFactory;
-BasicCodecFactory g_basicCodecFactory;
+#if UNIT_TEST_COMPACT_CODEC
+CompactCodecFactory g_codecFactory;
+#else
+BasicCodecFactory g_codecFactory;
+#endif
 SimpleServer g_server;
 
 int ::MyAlloc::allocated_ = 0;
@@ -78,7 +90,7 @@ int main(int argc, const char *argv[])
 
     g_server.setMessageBufferFactory(&g_msgFactory);
     g_server.setTransport(&g_transport);
-    g_server.setCodecFactory(&g_basicCodecFactory);
+    g_server.setCodecFactory(&g_codecFactory);
 
     add_services(&g_server);
     add_common_service(&g_server);
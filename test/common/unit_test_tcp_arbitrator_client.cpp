@@ -7,7 +7,11 @@
  */
 
 #include "erpc_arbitrated_client_manager.hpp"
+#if UNIT_TEST_COMPACT_CODEC
+#include "erpc_compact_codec.hpp"
+#else
 #include "erpc_basic_codec.hpp"
+#endif
 #include "erpc_simple_server.hpp"
 #include "erpc_tcp_transport.hpp"
 #include "erpc_transport_arbitrator.hpp"
@@ -48,7 +52,11 @@ TCPTransport g_transport("localhost", 12345, false);
 TCPTransport g_messageLogger("localhost", 54321, false);
 #endif // USE_MESSAGE_LOGGING
 MyMessageBufferFactory g_msgFactory;
-BasicCodecFactory g_basicCodecFactory;
+#if UNIT_TEST_COMPACT_CODEC
+CompactCodecFactory g_codecFactory;
+#else
+BasicCodecFactory g_codecFactory;
+#endif
 ArbitratedClientManager *g_client;
 TransportArbitrator g_arbitrator;
 SimpleServer g_server;
@@ -130,11 +138,11 @@ int main(int argc, char **argv)
 #endif // USE_MESSAGE_LOGGING
 
     g_arbitrator.setSharedTransport(&g_transport);
-    g_arbitrator.setCodec(g_basicCodecFactory.create());
+    g_arbitrator.setCodec(g_codecFactory.create());
 
     g_client = new ArbitratedClientManager();
     g_client->setArbitrator(&g_arbitrator);
-    g_client->setCodecFactory(&g_basicCodecFactory);
+    g_client->setCodecFactory(&g_codecFactory);
     g_client->setMessageBufferFactory(&g_msgFactory);
 #if USE_MESSAGE_LOGGING
     g_client->addMessageLogger(&g_messageLogger);
@@ -143,7 +151,7 @@ int main(int argc, char **argv)
     g_arbitrator.setCrc16(&g_crc16);
 
     g_server.setTransport(&g_arbitrator);
-    g_server.setCodecFactory(&g_basicCodecFactory);
+    g_server.setCodecFactory(&g_codecFactory);
     g_server.setMessageBufferFactory(&g_msgFactory);
 #if USE_MESSAGE_LOGGING
     g_server.addMessageLogger(&g_messageLogger);
@@ -7,7 +7,11 @@
  */
 
 #include "erpc_arbitrated_client_manager.hpp"
+#if UNIT_TEST_COMPACT_CODEC
+#include "erpc_compact_codec.hpp"
+#else
 #include "erpc_basic_codec.hpp"
+#endif
 #include "erpc_simple_server.hpp"
 #include "erpc_tcp_transport.hpp"
 #include "erpc_transport_arbitrator.hpp"
@@ -45,7 +49,11 @@ int testClient();
 
 TCPTransport g_transport("localhost", 12345, true);
 MyMessageBufferFactory g_msgFactory;
-BasicCodecFactory g_basicCodecFactory;
+#if UNIT_TEST_COMPACT_CODEC
+CompactCodecFactory g_codecFactory;
+#else
+BasicCodecFactory g_codecFactory;
+#endif
 ArbitratedClientManager *g_client;
 TransportArbitrator g_arbitrator;
 SimpleServer g_server;
@@ -129,17 +137,17 @@ int main(int argc, char **argv)
     }
 
     g_arbitrator.setSharedTransport(&g_transport);
-    g_arbitrator.setCodec(g_basicCodecFactory.create());
+    g_arbitrator.setCodec(g_codecFactory.create());
 
     g_client = new ArbitratedClientManager();
     g_client->setArbitrator(&g_arbitrator);
-    g_client->setCodecFactory(&g_basicCodecFactory);
+    g_client->setCodecFactory(&g_codecFactory);
     g_client->setMessageBufferFactory(&g_msgFactory);
 
     g_arbitrator.setCrc16(&g_crc16);
 
     g_server.setTransport(&g_arbitrator);
-    g_server.setCodecFactory(&g_basicCodecFactory);
+    g_server.setCodecFactory(&g_codecFactory);
     g_server.setMessageBufferFactory(&g_msgFactory);
     add_services(&g_server);
     g_client->setServer(&g_server);
@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#if UNIT_TEST_COMPACT_CODEC
+#include "erpc_compact_codec.hpp"
+#else
+#include "erpc_basic_codec.hpp"
+#endif
+#include "erpc_client_manager.h"
+#include "erpc_tcp_transport.hpp"
+#include "erpc_transport_setup.h"
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+#include "erpc_compressing_transport.hpp"
+#endif
+
+#include "Logging.hpp"
+#include "c_test_unit_test_common_client.h"
+#include "gtest.h"
+#include "gtestListener.hpp"
+#include "myAlloc.hpp"
+#include "unit_test_wrapped.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+#ifndef UNIT_TEST_TCP_HOST
+#define UNIT_TEST_TCP_HOST "localhost"
+#endif
+
+#ifndef UNIT_TEST_TCP_PORT
+#define UNIT_TEST_TCP_PORT 12345
+#endif
+
+#ifndef UNIT_TEST_MESSAGE_BUFFER_SIZE
+#define UNIT_TEST_MESSAGE_BUFFER_SIZE 1024
+#endif
+
+#ifndef UNIT_TEST_BATCHING_DELAY_US
+#define UNIT_TEST_BATCHING_DELAY_US 500000
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// CODE
+////////////////////////////////////////////////////////////////////////////////
+using namespace erpc;
+
+class MyMessageBufferFactory : public MessageBufferFactory
+{
+public:
+    virtual MessageBuffer create()
+    {
+        uint8_t *buf = new uint8_t[UNIT_TEST_MESSAGE_BUFFER_SIZE];
+        return MessageBuffer(buf, UNIT_TEST_MESSAGE_BUFFER_SIZE);
+    }
+
+    virtual void dispose(MessageBuffer *buf)
+    {
+        erpc_assert(buf);
+        if (*buf)
+        {
+            delete[] buf->get();
+        }
+    }
+};
+
+MyMessageBufferFactory g_msgFactory;
+TCPTransport g_transport(UNIT_TEST_TCP_HOST, UNIT_TEST_TCP_PORT, false);
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+CompressingTransport g_compressingTransport;
+#endif
+erpc_transport_t g_batchingTransport;
+#if USE_MESSAGE_LOGGING
+TCPTransport g_messageLogger("localhost", 54321, false);
+#endif // USE_MESSAGE_LOGGING
+#if UNIT_TEST_COMPACT_CODEC
+CompactCodecFactory g_codecFactory;
+#else
+BasicCodecFactory g_codecFactory;
+#endif
+ClientManager *g_client;
+
+Crc16 g_crc16;
+
+int ::MyAlloc::allocated_ = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Set up global fixture
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    ::testing::TestEventListeners &listeners = ::testing::UnitTest::GetInstance()->listeners();
+    listeners.Append(new LeakChecker);
+
+    // create logger instance
+    StdoutLogger *m_logger = new StdoutLogger();
+    m_logger->setFilterLevel(Logger::log_level_t::kInfo);
+    Log::setLogger(m_logger);
+    Log::info("Starting ERPC batching client. Connecting to '%s' on port %d.\n", UNIT_TEST_TCP_HOST,
+              UNIT_TEST_TCP_PORT);
+
+    g_client = new ClientManager();
+    erpc_status_t err = g_transport.open();
+    if (err)
+    {
+        Log::error("Failed to open connection\n");
+        return err;
+    }
+
+#if USE_MESSAGE_LOGGING
+    g_messageLogger.setCrc16(&g_crc16);
+    err = g_messageLogger.open();
+    if (err)
+    {
+        Log::error("Failed to open connection in ERPC first (client) app\n");
+        return err;
+    }
+#endif // USE_MESSAGE_LOGGING
+
+    Transport *transport = &g_transport;
+    g_transport.setCrc16(&g_crc16);
+    g_client->setMessageBufferFactory(&g_msgFactory);
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+    if (g_compressingTransport.init(&g_transport, &g_msgFactory, UNIT_TEST_COMPRESSION_THRESHOLD) !=
+        kErpcStatus_Success)
+    {
+        Log::error("Failed to init compressing transport\n");
+        return 1;
+    }
+    transport = &g_compressingTransport;
+#endif
+    // Oneway calls of the tests are queued, test cases flush them through g_batchingTransport.
+    g_batchingTransport = erpc_transport_batching_init(reinterpret_cast<erpc_transport_t>(transport),
+                                                       reinterpret_cast<erpc_mbf_t>(&g_msgFactory),
+                                                       UNIT_TEST_BATCHING_DELAY_US);
+    if (g_batchingTransport == NULL)
+    {
+        Log::error("Failed to init batching transport\n");
+        return 1;
+    }
+#if UNIT_TEST_COMPACT_CODEC
+    if (erpc_transport_batching_set_codec(g_batchingTransport, kErpcCodec_Compact) != kErpcStatus_Success)
+    {
+        Log::error("Failed to select compact codec of batching transport\n");
+        return 1;
+    }
+#endif
+    g_client->setTransport(reinterpret_cast<Transport *>(g_batchingTransport));
+    g_client->setCodecFactory(&g_codecFactory);
+#if USE_MESSAGE_LOGGING
+    g_client->addMessageLogger(&g_messageLogger);
+#endif // USE_MESSAGE_LOGGING
+    erpc_client_t client = reinterpret_cast<erpc_client_t>(g_client);
+    initInterfaces_common(client);
+    initInterfaces(client);
+
+    int ret = RUN_ALL_TESTS();
+    quit();
+    // Queued quit request is not sent by deinit.
+    (void)erpc_transport_batching_flush(g_batchingTransport);
+    erpc_transport_batching_deinit(g_batchingTransport);
+    free(m_logger);
+    g_transport.close();
+    free(g_client);
+
+    return ret;
+}
+
+void initInterfaces_common(erpc_client_t client)
+{
+    initCommon_client(client);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// EOF
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#if UNIT_TEST_COMPACT_CODEC
+#include "erpc_compact_codec.hpp"
+#else
+#include "erpc_basic_codec.hpp"
+#endif
+#include "erpc_batching_transport.hpp"
+#include "erpc_simple_server.hpp"
+#include "erpc_tcp_transport.hpp"
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+#include "erpc_compressing_transport.hpp"
+#endif
+
+#include "Logging.hpp"
+#include "c_test_unit_test_common_server.h"
+#include "myAlloc.hpp"
+#include "test_unit_test_common_server.hpp"
+#include "unit_test.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+#ifndef UNIT_TEST_TCP_HOST
+#define UNIT_TEST_TCP_HOST "localhost"
+#endif
+
+#ifndef UNIT_TEST_TCP_PORT
+#define UNIT_TEST_TCP_PORT 12345
+#endif
+
+#ifndef UNIT_TEST_MESSAGE_BUFFER_SIZE
+#define UNIT_TEST_MESSAGE_BUFFER_SIZE 1024
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// CODE
+////////////////////////////////////////////////////////////////////////////////
+
+using namespace erpc;
+using namespace erpcShim;
+
+class MyMessageBufferFactory : public MessageBufferFactory
+{
+public:
+    virtual MessageBuffer create()
+    {
+        uint8_t *buf = new uint8_t[UNIT_TEST_MESSAGE_BUFFER_SIZE];
+        return MessageBuffer(buf, UNIT_TEST_MESSAGE_BUFFER_SIZE);
+    }
+
+    virtual void dispose(MessageBuffer *buf)
+    {
+        erpc_assert(buf);
+        if (*buf)
+        {
+            delete[] buf->get();
+        }
+    }
+};
+
+TCPTransport g_transport(UNIT_TEST_TCP_HOST, UNIT_TEST_TCP_PORT, true);
+MyMessageBufferFactory g_msgFactory;
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+CompressingTransport g_compressingTransport;
+#endif
+BatchingTransport g_batchingTransport;
+#if UNIT_TEST_COMPACT_CODEC
+CompactCodecFactory g_codecFactory;
+CompactCodec g_batchingCodec;
+#else
+BasicCodecFactory g_codecFactory;
+BasicCodec g_batchingCodec;
+#endif
+SimpleServer g_server;
+
+Crc16 g_crc16;
+
+int ::MyAlloc::allocated_ = 0;
+
+Common_service *svc_common;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, const char *argv[])
+{
+    // create logger instance
+    StdoutLogger *m_logger = new StdoutLogger();
+    m_logger->setFilterLevel(Logger::log_level_t::kInfo);
+    Log::setLogger(m_logger);
+    Log::info("Starting ERPC batching server on port %d...\n", UNIT_TEST_TCP_PORT);
+
+    erpc_status_t result = g_transport.open();
+    if (result)
+    {
+        Log::error("Failed to open connection\n");
+        return 1;
+    }
+
+    Transport *transport = &g_transport;
+    g_transport.setCrc16(&g_crc16);
+    g_server.setMessageBufferFactory(&g_msgFactory);
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+    if (g_compressingTransport.init(&g_transport, &g_msgFactory, UNIT_TEST_COMPRESSION_THRESHOLD) !=
+        kErpcStatus_Success)
+    {
+        Log::error("Failed to init compressing transport\n");
+        return 1;
+    }
+    transport = &g_compressingTransport;
+#endif
+    // Server sends only replies, which are never queued.
+    g_batchingTransport.setCodec(&g_batchingCodec);
+    if (g_batchingTransport.init(transport, &g_msgFactory, 0) != kErpcStatus_Success)
+    {
+        Log::error("Failed to init batching transport\n");
+        return 1;
+    }
+    g_server.setTransport(&g_batchingTransport);
+    g_server.setCodecFactory(&g_codecFactory);
+
+    add_services(&g_server);
+    add_common_service(&g_server);
+    // run server infinitely
+    erpc_status_t err = g_server.run();
+    if (err && err != kErpcStatus_ServerIsDown)
+    {
+        Log::error("Error occurred: %d\n", err);
+        return err;
+    }
+
+    free(m_logger);
+    g_transport.close();
+
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Common service implementations here
+////////////////////////////////////////////////////////////////////////////////
+void quit()
+{
+    remove_common_service(&g_server);
+    remove_services(&g_server);
+    g_server.stop();
+}
+
+int32_t getServerAllocated()
+{
+    int result = ::MyAlloc::allocated();
+    ::MyAlloc::allocated(0);
+    return result;
+}
+
+class Common_server : public Common_interface
+{
+public:
+    void quit(void) { ::quit(); }
+
+    int32_t getServerAllocated(void)
+    {
+        int32_t result;
+        result = ::getServerAllocated();
+
+        return result;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Server helper functions
+////////////////////////////////////////////////////////////////////////////////
+void add_common_service(SimpleServer *server)
+{
+    svc_common = new Common_service(new Common_server());
+
+    server->addService(svc_common);
+}
+
+void remove_common_service(SimpleServer *server)
+{
+    server->removeService(svc_common);
+    delete svc_common->getHandler();
+    delete svc_common;
+}
+
+extern "C" void erpc_add_service_to_server(void *service) {}
+extern "C" void erpc_remove_service_from_server(void *service) {}
+
+////////////////////////////////////////////////////////////////////////////////
+// EOF
+////////////////////////////////////////////////////////////////////////////////
@@ -6,9 +6,16 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#if UNIT_TEST_COMPACT_CODEC
+#include "erpc_compact_codec.hpp"
+#else
 #include "erpc_basic_codec.hpp"
+#endif
 #include "erpc_client_manager.h"
 #include "erpc_tcp_transport.hpp"
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+#include "erpc_compressing_transport.hpp"
+#endif
 
 #include "Logging.hpp"
 #include "c_test_unit_test_common_client.h"
@@ -28,6 +35,10 @@
 #define UNIT_TEST_TCP_PORT 12345
 #endif
 
+#ifndef UNIT_TEST_MESSAGE_BUFFER_SIZE
+#define UNIT_TEST_MESSAGE_BUFFER_SIZE 1024
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // CODE
 ////////////////////////////////////////////////////////////////////////////////
@@ -38,8 +49,8 @@ class MyMessageBufferFactory : public MessageBufferFactory
 public:
     virtual MessageBuffer create()
     {
-        uint8_t *buf = new uint8_t[1024];
-        return MessageBuffer(buf, 1024);
+        uint8_t *buf = new uint8_t[UNIT_TEST_MESSAGE_BUFFER_SIZE];
+        return MessageBuffer(buf, UNIT_TEST_MESSAGE_BUFFER_SIZE);
     }
 
     virtual void dispose(MessageBuffer *buf)
@@ -54,10 +65,17 @@ public:
 
 MyMessageBufferFactory g_msgFactory;
 TCPTransport g_transport(UNIT_TEST_TCP_HOST, UNIT_TEST_TCP_PORT, false);
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+CompressingTransport g_compressingTransport;
+#endif
 #if USE_MESSAGE_LOGGING
 TCPTransport g_messageLogger("localhost", 54321, false);
 #endif // USE_MESSAGE_LOGGING
-BasicCodecFactory g_basicCodecFactory;
+#if UNIT_TEST_COMPACT_CODEC
+CompactCodecFactory g_codecFactory;
+#else
+BasicCodecFactory g_codecFactory;
+#endif
 ClientManager *g_client;
 
 Crc16 g_crc16;
@@ -100,8 +118,18 @@ int main(int argc, char **argv)
 
     g_transport.setCrc16(&g_crc16);
     g_client->setMessageBufferFactory(&g_msgFactory);
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+    if (g_compressingTransport.init(&g_transport, &g_msgFactory, UNIT_TEST_COMPRESSION_THRESHOLD) !=
+        kErpcStatus_Success)
+    {
+        Log::error("Failed to init compressing transport\n");
+        return 1;
+    }
+    g_client->setTransport(&g_compressingTransport);
+#else
     g_client->setTransport(&g_transport);
-    g_client->setCodecFactory(&g_basicCodecFactory);
+#endif
+    g_client->setCodecFactory(&g_codecFactory);
 #if USE_MESSAGE_LOGGING
     g_client->addMessageLogger(&g_messageLogger);
 #endif // USE_MESSAGE_LOGGING
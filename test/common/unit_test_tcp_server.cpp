@@ -6,9 +6,16 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#if UNIT_TEST_COMPACT_CODEC
+#include "erpc_compact_codec.hpp"
+#else
 #include "erpc_basic_codec.hpp"
+#endif
 #include "erpc_simple_server.hpp"
 #include "erpc_tcp_transport.hpp"
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+#include "erpc_compressing_transport.hpp"
+#endif
 
 #include "Logging.hpp"
 #include "c_test_unit_test_common_server.h"
@@ -27,6 +34,10 @@
 #define UNIT_TEST_TCP_PORT 12345
 #endif
 
+#ifndef UNIT_TEST_MESSAGE_BUFFER_SIZE
+#define UNIT_TEST_MESSAGE_BUFFER_SIZE 1024
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // CODE
 ////////////////////////////////////////////////////////////////////////////////
@@ -39,8 +50,8 @@ class MyMessageBufferFactory : public MessageBufferFactory
 public:
     virtual MessageBuffer create()
     {
-        uint8_t *buf = new uint8_t[1024];
-        return MessageBuffer(buf, 1024);
+        uint8_t *buf = new uint8_t[UNIT_TEST_MESSAGE_BUFFER_SIZE];
+        return MessageBuffer(buf, UNIT_TEST_MESSAGE_BUFFER_SIZE);
     }
 
     virtual void dispose(MessageBuffer *buf)
@@ -55,7 +66,14 @@ public:
 
 TCPTransport g_transport(UNIT_TEST_TCP_HOST, UNIT_TEST_TCP_PORT, true);
 MyMessageBufferFactory g_msgFactory;
-BasicCodecFactory g_basicCodecFactory;
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+CompressingTransport g_compressingTransport;
+#endif
+#if UNIT_TEST_COMPACT_CODEC
+CompactCodecFactory g_codecFactory;
+#else
+BasicCodecFactory g_codecFactory;
+#endif
 SimpleServer g_server;
 
 Crc16 g_crc16;
@@ -84,8 +102,18 @@ int main(int argc, const char *argv[])
 
     g_transport.setCrc16(&g_crc16);
     g_server.setMessageBufferFactory(&g_msgFactory);
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+    if (g_compressingTransport.init(&g_transport, &g_msgFactory, UNIT_TEST_COMPRESSION_THRESHOLD) !=
+        kErpcStatus_Success)
+    {
+        Log::error("Failed to init compressing transport\n");
+        return 1;
+    }
+    g_server.setTransport(&g_compressingTransport);
+#else
     g_server.setTransport(&g_transport);
-    g_server.setCodecFactory(&g_basicCodecFactory);
+#endif
+    g_server.setCodecFactory(&g_codecFactory);
 
     add_services(&g_server);
     add_common_service(&g_server);
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_server_setup.h"
+#include "erpc_simple_server.hpp"
+#include "erpc_tcp_transport.hpp"
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+#include "erpc_compressing_transport.hpp"
+#endif
+
+#include "Logging.hpp"
+#include "c_test_unit_test_common_server.h"
+#include "myAlloc.hpp"
+#include "test_unit_test_common_server.hpp"
+#include "unit_test.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+#ifndef UNIT_TEST_TCP_HOST
+#define UNIT_TEST_TCP_HOST "localhost"
+#endif
+
+#ifndef UNIT_TEST_TCP_PORT
+#define UNIT_TEST_TCP_PORT 12345
+#endif
+
+#ifndef UNIT_TEST_MESSAGE_BUFFER_SIZE
+#define UNIT_TEST_MESSAGE_BUFFER_SIZE 1024
+#endif
+
+#ifndef UNIT_TEST_THREAD_POOL_WORKERS
+#define UNIT_TEST_THREAD_POOL_WORKERS 4
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// CODE
+////////////////////////////////////////////////////////////////////////////////
+
+using namespace erpc;
+using namespace erpcShim;
+
+class MyMessageBufferFactory : public MessageBufferFactory
+{
+public:
+    virtual MessageBuffer create()
+    {
+        uint8_t *buf = new uint8_t[UNIT_TEST_MESSAGE_BUFFER_SIZE];
+        return MessageBuffer(buf, UNIT_TEST_MESSAGE_BUFFER_SIZE);
+    }
+
+    virtual void dispose(MessageBuffer *buf)
+    {
+        erpc_assert(buf);
+        if (*buf)
+        {
+            delete[] buf->get();
+        }
+    }
+};
+
+TCPTransport g_transport(UNIT_TEST_TCP_HOST, UNIT_TEST_TCP_PORT, true);
+MyMessageBufferFactory g_msgFactory;
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+CompressingTransport g_compressingTransport;
+#endif
+erpc_server_t g_serverHandle;
+SimpleServer *g_server;
+
+Crc16 g_crc16;
+
+int ::MyAlloc::allocated_ = 0;
+
+Common_service *svc_common;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, const char *argv[])
+{
+    Transport *transport = &g_transport;
+
+    // create logger instance
+    StdoutLogger *m_logger = new StdoutLogger();
+    m_logger->setFilterLevel(Logger::log_level_t::kInfo);
+    Log::setLogger(m_logger);
+    Log::info("Starting ERPC thread pool server with %d workers on port %d...\n", UNIT_TEST_THREAD_POOL_WORKERS,
+              UNIT_TEST_TCP_PORT);
+
+    erpc_status_t result = g_transport.open();
+    if (result)
+    {
+        Log::error("Failed to open connection\n");
+        return 1;
+    }
+
+    g_transport.setCrc16(&g_crc16);
+#if defined(UNIT_TEST_COMPRESSION_THRESHOLD)
+    if (g_compressingTransport.init(&g_transport, &g_msgFactory, UNIT_TEST_COMPRESSION_THRESHOLD) !=
+        kErpcStatus_Success)
+    {
+        Log::error("Failed to init compressing transport\n");
+        return 1;
+    }
+    transport = &g_compressingTransport;
+#endif
+
+    // Server is created by the C setup API, worker threads process requests concurrently.
+    g_serverHandle = erpc_server_thread_pool_init(reinterpret_cast<erpc_transport_t>(transport),
+                                                  reinterpret_cast<erpc_mbf_t>(&g_msgFactory),
+                                                  UNIT_TEST_THREAD_POOL_WORKERS);
+    if (g_serverHandle == NULL)
+    {
+        Log::error("Failed to init thread pool server\n");
+        return 1;
+    }
+#if UNIT_TEST_COMPACT_CODEC
+    if (erpc_server_set_codec(g_serverHandle, kErpcCodec_Compact) != kErpcStatus_Success)
+    {
+        Log::error("Failed to select compact codec\n");
+        return 1;
+    }
+#endif
+    g_server = reinterpret_cast<SimpleServer *>(g_serverHandle);
+
+    add_services(g_server);
+    add_common_service(g_server);
+    // run server infinitely
+    erpc_status_t err = erpc_server_run(g_serverHandle);
+    if (err && err != kErpcStatus_ServerIsDown)
+    {
+        Log::error("Error occurred: %d\n", err);
+        return err;
+    }
+
+    erpc_server_thread_pool_deinit(g_serverHandle);
+    free(m_logger);
+    g_transport.close();
+
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Common service implementations here
+////////////////////////////////////////////////////////////////////////////////
+void quit()
+{
+    remove_common_service(g_server);
+    remove_services(g_server);
+    erpc_server_stop(g_serverHandle);
+}
+
+int32_t getServerAllocated()
+{
+    int result = ::MyAlloc::allocated();
+    ::MyAlloc::allocated(0);
+    return result;
+}
+
+class Common_server : public Common_interface
+{
+public:
+    void quit(void) { ::quit(); }
+
+    int32_t getServerAllocated(void)
+    {
+        int32_t result;
+        result = ::getServerAllocated();
+
+        return result;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Server helper functions
+////////////////////////////////////////////////////////////////////////////////
+void add_common_service(SimpleServer *server)
+{
+    svc_common = new Common_service(new Common_server());
+
+    server->addService(svc_common);
+}
+
+void remove_common_service(SimpleServer *server)
+{
+    server->removeService(svc_common);
+    delete svc_common->getHandler();
+    delete svc_common;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// EOF
+////////////////////////////////////////////////////////////////////////////////
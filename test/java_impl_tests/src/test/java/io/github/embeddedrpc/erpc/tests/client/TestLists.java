@@ -19,6 +19,7 @@ import io.github.embeddedrpc.erpc.tests.test_lists.erpc_outputs.test.interfaces.
 import org.junit.jupiter.api.*;
 
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 
 import static org.junit.jupiter.api.Assertions.*;
@@ -267,6 +268,35 @@ public class TestLists extends TestingClient {
         assertEquals(33, result);
     }
 
+    @Test
+    public void testBorrowedAnnotation() {
+        List<Long> list = new ArrayList<>();
+
+        for (int i = 0; i < 5; i++) {
+            list.add((i + 1) * 0x100000000L);
+        }
+
+        for (short pad = 0; pad < 8; pad++) {
+            assertEquals(1, client.testBorrowedAnnotation(pad, list, "borrowed"));
+        }
+    }
+
+    @Test
+    public void testBorrowedLists() {
+        List<Double> first = Arrays.asList(0.5, -1.25, 3.0);
+        List<Float> third = Arrays.asList(0.5f, -1.25f, 3.0f);
+
+        for (int pad = 1; pad <= 8; pad++) {
+            for (int secondLen = 1; secondLen <= 4; secondLen++) {
+                List<Integer> second = new ArrayList<>();
+                for (int i = 0; i < secondLen; i++) {
+                    second.add(i + 1);
+                }
+                assertEquals(1, client.testBorrowedLists(new byte[pad], "borrowed", first, second, third));
+            }
+        }
+    }
+
     @AfterAll
     public void quit() {
         new CommonClient(clientManager).quit();
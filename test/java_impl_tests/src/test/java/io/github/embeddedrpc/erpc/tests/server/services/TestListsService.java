@@ -9,6 +9,7 @@ import io.github.embeddedrpc.erpc.tests.test_lists.erpc_outputs.test.common.stru
 import io.github.embeddedrpc.erpc.tests.test_lists.erpc_outputs.test.server.AbstractPointersServiceService;
 
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 
 public class TestListsService extends AbstractPointersServiceService {
@@ -170,4 +171,32 @@ public class TestListsService extends AbstractPointersServiceService {
 
         return 33;
     }
+
+    @Override
+    public int testBorrowedAnnotation(short pad, List<Long> myList, String name) {
+        System.out.println("testBorrowedAnnotation reached");
+        for (int i = 0; i < myList.size(); i++) {
+            if (myList.get(i) != (i + 1) * 0x100000000L) {
+                return 0;
+            }
+        }
+
+        return name.equals("borrowed") ? 1 : 0;
+    }
+
+    @Override
+    public int testBorrowedLists(byte[] pad, String name, List<Double> first, List<Integer> second,
+                                 List<Float> third) {
+        System.out.println("testBorrowedLists reached");
+        if (!first.equals(Arrays.asList(0.5, -1.25, 3.0)) || !third.equals(Arrays.asList(0.5f, -1.25f, 3.0f))) {
+            return 0;
+        }
+        for (int i = 0; i < second.size(); i++) {
+            if (second.get(i) != i + 1) {
+                return 0;
+            }
+        }
+
+        return name.equals("borrowed") ? 1 : 0;
+    }
 }
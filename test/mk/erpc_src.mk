@@ -35,11 +35,15 @@ SOURCES +=  $(UT_COMMON_SRC)/addOne.cpp \
             $(ERPC_ROOT)/erpcgen/src/format_string.cpp \
             $(ERPC_ROOT)/erpcgen/src/Logging.cpp \
             $(ERPC_C_ROOT)/infra/erpc_arbitrated_client_manager.cpp \
+            $(ERPC_C_ROOT)/infra/erpc_arena.cpp \
             $(ERPC_C_ROOT)/infra/erpc_basic_codec.cpp \
+            $(ERPC_C_ROOT)/infra/erpc_call_stats.cpp \
             $(ERPC_C_ROOT)/infra/erpc_client_manager.cpp \
+            $(ERPC_C_ROOT)/infra/erpc_compact_codec.cpp \
             $(ERPC_C_ROOT)/infra/erpc_crc16.cpp \
             $(ERPC_C_ROOT)/infra/erpc_server.cpp \
             $(ERPC_C_ROOT)/infra/erpc_simple_server.cpp \
+            $(ERPC_C_ROOT)/infra/erpc_stream.cpp \
             $(ERPC_C_ROOT)/infra/erpc_framed_transport.cpp \
             $(ERPC_C_ROOT)/infra/erpc_message_buffer.cpp \
             $(ERPC_C_ROOT)/infra/erpc_message_loggers.cpp \
@@ -75,7 +75,13 @@ INCLUDES += $(TARGET_OUTPUT_ROOT) \
 #-------------------------------
 IDL_FILE = $(CUR_DIR).erpc
 
-ifeq (,$(filter $(TEST_NAME),test_arbitrator test_callbacks))
+# Client and server implementation, variables.mk of test variant can point to other test case.
+TEST_IMPL ?= $(CUR_DIR)
+
+# Main of test application, variables.mk of test case can select another one (test_thread_pool).
+TEST_MAIN ?= $(UT_COMMON_SRC)/unit_test_$(TRANSPORT)_$(APP_TYPE).cpp
+
+ifeq (,$(filter $(TEST_NAME),test_arbitrator test_callbacks test_large_messages))
 
     INCLUDES += $(ERPC_ROOT)/test/common/config
 
@@ -85,16 +91,16 @@ ifeq (,$(filter $(TEST_NAME),test_arbitrator test_callbacks))
                 $(ERPC_OUT_DIR)/$(ERPC_NAME)_unit_test_common_interface.cpp \
                 $(ERPC_OUT_DIR)/c_$(ERPC_NAME_APP)_$(APP_TYPE).cpp \
                 $(ERPC_OUT_DIR)/c_$(ERPC_NAME)_unit_test_common_$(APP_TYPE).cpp \
-                $(CUR_DIR)_$(APP_TYPE)_impl.cpp \
-                $(UT_COMMON_SRC)/unit_test_$(TRANSPORT)_$(APP_TYPE).cpp
+                $(TEST_IMPL)_$(APP_TYPE)_impl.cpp \
+                $(TEST_MAIN)
 
 .PHONY: all
 all: $(ERPC_OUT_DIR)/$(ERPC_NAME_APP)_$(APP_TYPE).cpp $(ERPC_OUT_DIR)/$(ERPC_NAME)/$(APP_TYPE).py
 
 
 # Define dependency.
-$(OUTPUT_ROOT)/test/$(TEST_NAME)/$(CUR_DIR)_$(APP_TYPE)_impl.cpp: $(UT_COMMON_SRC)/unit_test_$(TRANSPORT)_$(APP_TYPE).cpp
-$(UT_COMMON_SRC)/unit_test_$(TRANSPORT)_$(APP_TYPE).cpp: $(ERPC_OUT_DIR)/$(ERPC_NAME_APP)_$(APP_TYPE).cpp
+$(abspath $(TEST_IMPL))_$(APP_TYPE)_impl.cpp: $(TEST_MAIN)
+$(TEST_MAIN): $(ERPC_OUT_DIR)/$(ERPC_NAME_APP)_$(APP_TYPE).cpp
 $(ERPC_OUT_DIR)/$(ERPC_NAME)_unit_test_common_interface.cpp $(ERPC_OUT_DIR)/$(ERPC_NAME_APP)_interface.cpp $(ERPC_OUT_DIR)/$(ERPC_NAME_APP)_$(APP_TYPE).cpp $(ERPC_OUT_DIR)/c_$(ERPC_NAME_APP)_$(APP_TYPE).cpp $(ERPC_OUT_DIR)/c_$(ERPC_NAME)_unit_test_common_$(APP_TYPE).cpp: $(ERPC_OUT_DIR)/$(ERPC_NAME)_unit_test_common_$(APP_TYPE).cpp
 
 # Run erpcgen for C.
@@ -114,7 +120,7 @@ ifeq "$(is_mingw)" "1"
     LIBRARIES += -lws2_32
 endif
 else
-ifeq (,$(filter $(TEST_NAME),test_arbitrator))
+ifeq (,$(filter $(TEST_NAME),test_arbitrator test_large_messages))
     INCLUDES += $(ERPC_ROOT)/test/common/config
 else
     INCLUDES += $(OUTPUT_ROOT)/test/$(TEST_NAME)/config
@@ -67,7 +67,7 @@ test_client_tcp: erpcgen
 
 .PHONY: test_client_serial
 test_client_serial: erpcgen
-ifneq "$(TEST_NAME)" "test_arbitrator"
+ifeq (,$(filter $(TEST_NAME),test_arbitrator test_batching test_thread_pool))
 	@$(call printmessage,build,Building, $(CUR_DIR) $@ ,gray,,,\n)
 	@$(MAKE) $(silent_make) -j$(MAKETHREADS) -r -f $(TEST_DIR)/mk/test.mk TEST_NAME=$(CUR_DIR) TYPE=CLIENT TRANSPORT=serial
 else
@@ -84,7 +84,7 @@ test_server_tcp: erpcgen
 
 .PHONY: test_server_serial
 test_server_serial: erpcgen
-ifneq "$(TEST_NAME)" "test_arbitrator"
+ifeq (,$(filter $(TEST_NAME),test_arbitrator test_batching test_thread_pool))
 	@$(call printmessage,build,Building, $(CUR_DIR) $@ ,gray,,,\n)
 	@$(MAKE) $(silent_make) -j$(MAKETHREADS) -r -f $(TEST_DIR)/mk/test.mk TEST_NAME=$(CUR_DIR) TYPE=SERVER TRANSPORT=serial
 else
@@ -17,9 +17,10 @@ from _pytest.fixtures import FixtureRequest
 from erpc.arbitrator import TransportArbitrator
 from erpc.basic_codec import BasicCodec
 from erpc.client import ClientManager
+from erpc.compact_codec import CompactCodec
 from erpc.server import Service
 from erpc.simple_server import SimpleServer
-from erpc.transport import TCPTransport, SerialTransport
+from erpc.transport import TCPTransport, SerialTransport, CompressingTransport
 
 from .test_const.service.erpc_outputs import test_unit_test_common
 from .test_const.service.erpc_outputs.test_unit_test_common.client import CommonClient
@@ -33,6 +34,10 @@ def pytest_addoption(parser: Parser):
     parser.addoption("--port", action="store", default='40', help="run all combinations")
     parser.addoption("--serial", action="store", default=None, help="run all combinations")
     parser.addoption("--baud", action="store", default='115200', help="run all combinations")
+    parser.addoption("--codec", action="store", default='basic', choices=['basic', 'compact'],
+                     help="message format used by client and server")
+    parser.addoption("--compress", action="store", default=None,
+                     help="wrap transport into CompressingTransport with given threshold")
 
 
 ###############################################################################
@@ -54,17 +59,22 @@ class TransportFactory:
         self.host = config.getoption("host")
         self.serial = config.getoption("serial")
         self.baud = int(cast(int, config.getoption("baud")))
+        self.codec = CompactCodec if config.getoption("codec") == 'compact' else BasicCodec
+        self.compress = config.getoption("compress")
         self.arbitrator = None
 
-    def build_transport(self, is_server: bool,
-                        create_arbitrator: bool = False) -> TCPTransport | SerialTransport | TransportArbitrator:
+    def build_transport(self, is_server: bool, create_arbitrator: bool = False
+                        ) -> TCPTransport | SerialTransport | CompressingTransport | TransportArbitrator:
         if self.serial:
             transport = SerialTransport(self.serial, self.baud)
         else:
             transport = TCPTransport(self.host, self.port, is_server)
 
+        if self.compress is not None:
+            transport = CompressingTransport(transport, int(self.compress))
+
         if create_arbitrator:
-            transport = TransportArbitrator(transport, BasicCodec())
+            transport = TransportArbitrator(transport, self.codec())
 
         return transport
 
@@ -130,7 +140,7 @@ def client_manager(config: Config, transport_factory: TransportFactory, server:
         pytest.skip("No test's client, skipping.")
     else:
         time.sleep(0.1)  # Add delay to allow server run
-        return ClientManager(transport_factory.build_transport(False), BasicCodec)
+        return ClientManager(transport_factory.build_transport(False), transport_factory.codec)
 
 
 @pytest.fixture(scope="module")
@@ -155,7 +165,7 @@ def run_server(transport_factory: TransportFactory, services: list[Service]) ->
     """
     global global_server
 
-    global_server = SimpleServer(transport_factory.build_transport(True), BasicCodec)
+    global_server = SimpleServer(transport_factory.build_transport(True), transport_factory.codec)
 
     global_server.add_service(CommonService(CommonTestServiceHandler()))
 
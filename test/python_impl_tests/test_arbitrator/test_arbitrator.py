@@ -15,7 +15,6 @@ from typing import Optional
 import pytest
 from _pytest.config import Config
 from erpc.arbitrator import TransportArbitrator
-from erpc.basic_codec import BasicCodec
 from erpc.client import ClientManager
 from erpc.server import Service
 from erpc.simple_server import SimpleServer, ServerThread
@@ -83,14 +82,14 @@ def client(config: Config, transport_factory: TransportFactory, server) -> First
 
     gc_transport = transport_factory.build_transport(False, True)
 
-    client_mngr = ClientManager(gc_transport.shared_transport, BasicCodec)
+    client_mngr = ClientManager(gc_transport.shared_transport, transport_factory.codec)
     client_mngr.arbitrator = gc_transport
 
     service = SecondInterfaceService(
         SecondInterfaceHandler()
     )
 
-    gc_server = SimpleServer(gc_transport, BasicCodec)
+    gc_server = SimpleServer(gc_transport, transport_factory.codec)
     gc_server.add_service(service)
 
     server_thread = threading.Thread(target=client_server, args=())
@@ -150,7 +149,7 @@ def server_process(transport_factory: TransportFactory) -> int:
     global gs_server, gs_transport, gs_client
     gs_transport = transport_factory.build_transport(True, True)
 
-    client_mngr = ClientManager(gs_transport.shared_transport, BasicCodec)
+    client_mngr = ClientManager(gs_transport.shared_transport, transport_factory.codec)
     client_mngr.arbitrator = gs_transport
 
     gs_client = SecondInterfaceClient(client_mngr)
@@ -159,7 +158,7 @@ def server_process(transport_factory: TransportFactory) -> int:
         FirstInterfaceHandler()
     )
 
-    gs_server = SimpleServer(gs_transport, BasicCodec)
+    gs_server = SimpleServer(gs_transport, transport_factory.codec)
     gs_server.add_service(service)
 
     server_thread = threading.Thread(target=server_server, args=())
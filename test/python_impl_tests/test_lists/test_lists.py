@@ -127,6 +127,19 @@ class ListsTestServiceHandler(IPointersService):
                     return 0
         return 33
 
+    def testBorrowedAnnotation(self, pad, myList, name):
+        for y in range(len(myList)):
+            if myList[y] != (y + 1) * 0x100000000:
+                return 0
+        return 1 if name == "borrowed" else 0
+
+    def testBorrowedLists(self, pad, name, first, second, third):
+        if first != [0.5, -1.25, 3.0] or third != [0.5, -1.25, 3.0]:
+            return 0
+        if second != [x + 1 for x in range(len(second))]:
+            return 0
+        return 1 if name == "borrowed" else 0
+
 
 ###############################################################################
 # Tests
@@ -311,6 +324,24 @@ def test_sendGapAdvertisingData(client):
     assert result == 33
 
 
+def test_testBorrowedAnnotation(client):
+    myList = [(x + 1) * 0x100000000 for x in range(5)]
+    # send request to the server
+    print('\r\neRPC request is sent to the server')
+    for pad in range(8):
+        assert client.testBorrowedAnnotation(pad, myList, "borrowed") == 1
+
+
+def test_testBorrowedLists(client):
+    # pad and length of the second list move the lists to every alignment
+    print('\r\neRPC request is sent to the server')
+    for pad in range(1, 9):
+        for secondLen in range(1, 5):
+            second = [x + 1 for x in range(secondLen)]
+            assert client.testBorrowedLists(bytearray(pad), "borrowed", [0.5, -1.25, 3.0], second,
+                                            [0.5, -1.25, 3.0]) == 1
+
+
 def test_Quit(common_client):
     # send request to the server
     print("eRPC quit request send to the server.")
@@ -0,0 +1,81 @@
+#!/usr/bin/python
+
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+
+import erpc
+import pytest
+
+from .service.erpc_outputs.test.client import StreamServiceClient
+from .service.erpc_outputs.test.interface import IStreamService
+from .service.erpc_outputs.test.server import StreamServiceService
+
+
+###############################################################################
+# Fixtures
+###############################################################################
+@pytest.fixture()
+def client(client_manager):
+    if client_manager is None:
+        pytest.skip()
+
+    return StreamServiceClient(client_manager)
+
+
+@pytest.fixture(scope="module")
+def services():
+    return [StreamServiceService(StreamTestServiceHandler())]
+
+
+###############################################################################
+# Handlers
+###############################################################################
+def stream_out_element(i):
+    return ((i * 100003 - 1500000000 + 2**31) % 2**32) - 2**31
+
+
+class StreamTestServiceHandler(IStreamService):
+    def streamIn(self, seed, data):
+        return seed + sum(data)
+
+    def streamOut(self, count):
+        return [stream_out_element(i) for i in range(count)]
+
+    def streamEcho(self, values, sum_):
+        sum_.value = sum(values)
+        return values[::-1]
+
+
+###############################################################################
+# Tests
+###############################################################################
+def test_streamIn(client):
+    # Many times bigger than a message buffer.
+    data = bytearray((i * 13) & 0xff for i in range(5000))
+    assert client.streamIn(7, data) == 7 + sum(data)
+
+
+def test_streamInZeroSize(client):
+    assert client.streamIn(3, bytearray()) == 3
+
+
+def test_streamOut(client):
+    assert client.streamOut(3000) == [stream_out_element(i) for i in range(3000)]
+
+
+def test_streamOutZeroSize(client):
+    assert client.streamOut(0) == []
+
+
+def test_streamEcho(client):
+    values = [(i * 33) & 0xffff for i in range(2000)]
+    sum_ = erpc.Reference()
+    assert client.streamEcho(values, sum_) == values[::-1]
+    assert sum_.value == sum(values)
+
+
+def test_Quit(common_client):
+    # send request to the server
+    print("eRPC quit request send to the server.")
+    return common_client.quit()
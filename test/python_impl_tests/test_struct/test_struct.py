@@ -4,11 +4,17 @@
 #
 # SPDX-License-Identifier: BSD-3-Clause
 
+import asyncio
+
 import erpc
 import pytest
+from erpc.async_client import AsyncClientManager
+from erpc.async_server import AsyncServer
+from erpc.async_transport import AsyncTCPTransport
 
 from .service.erpc_outputs.test_ArithmeticService import common
 from .service.erpc_outputs.test_ArithmeticService.client import ArithmeticService1Client
+from .service.erpc_outputs.test_ArithmeticService.client import ArithmeticService1AsyncClient
 from .service.erpc_outputs.test_ArithmeticService.client import ArithmeticService2Client
 from .service.erpc_outputs.test_ArithmeticService.server import ArithmeticService1Service
 from .service.erpc_outputs.test_ArithmeticService.server import ArithmeticService2Service
@@ -291,6 +297,35 @@ def test_TestSendingByrefMembers(client2):
     assert True == client2.testSendingByrefMembers(s)
 
 
+def test_AsyncPipelinedCalls(config, transport_factory):
+    if not (config.getoption("client") and config.getoption("server")) or transport_factory.serial:
+        pytest.skip("Asyncio client and server run together over TCP only.")
+
+    async def run():
+        # Own server on next port, the server of other tests accepts one connection only.
+        server = AsyncServer(AsyncTCPTransport(transport_factory.host, transport_factory.port + 1, True),
+                             transport_factory.codec)
+        server.add_service(ArithmeticService1Service(StructTestServiceHandler1()))
+        await server.transport.open()
+        server_task = asyncio.create_task(server.run())
+
+        transport = AsyncTCPTransport(transport_factory.host, transport_factory.port + 1, False)
+        client = ArithmeticService1AsyncClient(AsyncClientManager(transport, transport_factory.codec))
+        calls = [client.getMember(common.C(m=x, n=0)) for x in range(100)]
+        calls += [client.returnStruct(float(x), float(x + 1)) for x in range(100)]
+        results = await asyncio.gather(*calls)
+        assert results[:100] == list(range(100))
+        assert [(b.x, b.y) for b in results[100:]] == [(float(x), float(x + 1)) for x in range(100)]
+
+        server.stop()
+        await client.getMember(common.C(m=0, n=0))
+        await server_task
+        await transport.close()
+        await server.transport.close()
+
+    asyncio.run(run())
+
+
 def test_Quit(common_client):
     # send request to the server
     print("eRPC quit request send to the server.")
@@ -0,0 +1,9 @@
+#-------------------------------------------------------------------------------
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#-------------------------------------------------------------------------------
+
+# Client and server of test_arrays, only IDL differs
+TEST_IMPL=$(TEST_ROOT)/test_arrays/test_arrays
+ERPC_OUT_DIR=$(RPC_OBJS_ROOT)
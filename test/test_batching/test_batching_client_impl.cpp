@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_transport_setup.h"
+
+#include "c_test_client.h"
+#include "gtest.h"
+#include "unit_test_wrapped.h"
+
+#include <chrono>
+#include <thread>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! Oneway calls filling several batches of the client transport.
+#define BATCHING_TEST_BURST_SIZE (200U)
+
+//! Wait shorter than the batching delay of the client, see UNIT_TEST_BATCHING_DELAY_US.
+#define BATCHING_TEST_SHORT_WAIT std::chrono::milliseconds(200)
+
+//! Wait longer than the batching delay of the client.
+#define BATCHING_TEST_LONG_WAIT std::chrono::milliseconds(800)
+
+//! Age of notification which was not sent together with the following call.
+#define BATCHING_TEST_MIN_AGE_MS (150U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+//! Batching transport of the client, defined by unit_test_tcp_batching_client.cpp.
+extern erpc_transport_t g_batchingTransport;
+
+////////////////////////////////////////////////////////////////////////////////
+// Unit test Implementation code
+////////////////////////////////////////////////////////////////////////////////
+
+void initInterfaces(erpc_client_t client)
+{
+    initBatching_client(client);
+}
+
+TEST(test_batching, burstThenCall)
+{
+    uint32_t firstAgeMs;
+    uint32_t lastAgeMs;
+    bool ordered;
+
+    for (uint32_t i = 0; i < BATCHING_TEST_BURST_SIZE; ++i)
+    {
+        notifyValue(i);
+    }
+    std::this_thread::sleep_for(BATCHING_TEST_SHORT_WAIT);
+
+    // Full batches were sent at once, the last one only before this invocation.
+    EXPECT_EQ(getNotified(&firstAgeMs, &lastAgeMs, &ordered), BATCHING_TEST_BURST_SIZE);
+    EXPECT_TRUE(ordered);
+    EXPECT_GE(firstAgeMs, BATCHING_TEST_MIN_AGE_MS);
+    EXPECT_LT(lastAgeMs, BATCHING_TEST_MIN_AGE_MS);
+}
+
+TEST(test_batching, sentAfterDelay)
+{
+    uint32_t firstAgeMs;
+    uint32_t lastAgeMs;
+    bool ordered;
+
+    notifyValue(0);
+    notifyValue(1);
+    std::this_thread::sleep_for(BATCHING_TEST_LONG_WAIT);
+
+    EXPECT_EQ(getNotified(&firstAgeMs, &lastAgeMs, &ordered), 2U);
+    EXPECT_TRUE(ordered);
+    EXPECT_GE(lastAgeMs, BATCHING_TEST_MIN_AGE_MS);
+}
+
+TEST(test_batching, sentByFlush)
+{
+    uint32_t firstAgeMs;
+    uint32_t lastAgeMs;
+    bool ordered;
+
+    notifyValue(0);
+    notifyValue(1);
+    EXPECT_EQ(erpc_transport_batching_flush(g_batchingTransport), kErpcStatus_Success);
+    std::this_thread::sleep_for(BATCHING_TEST_SHORT_WAIT);
+
+    EXPECT_EQ(getNotified(&firstAgeMs, &lastAgeMs, &ordered), 2U);
+    EXPECT_TRUE(ordered);
+    EXPECT_GE(lastAgeMs, BATCHING_TEST_MIN_AGE_MS);
+
+    // Nothing is queued, flush has nothing to send.
+    EXPECT_EQ(erpc_transport_batching_flush(g_batchingTransport), kErpcStatus_Success);
+}
+
+TEST(test_batching, onewayMixedWithCalls)
+{
+    uint32_t firstAgeMs;
+    uint32_t lastAgeMs;
+    bool ordered;
+
+    // Queued oneway calls are sent before each invocation, so the server sees the calls in order.
+    for (uint32_t i = 0; i < BATCHING_TEST_BURST_SIZE; ++i)
+    {
+        notifyValue(i);
+        if ((i % 7U) == 6U)
+        {
+            EXPECT_EQ(echo(i), i);
+        }
+    }
+
+    EXPECT_EQ(getNotified(&firstAgeMs, &lastAgeMs, &ordered), BATCHING_TEST_BURST_SIZE);
+    EXPECT_TRUE(ordered);
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_server_setup.h"
+
+#include "c_test_server.h"
+#include "c_test_unit_test_common_server.h"
+#include "test_server.hpp"
+#include "unit_test.h"
+#include "unit_test_wrapped.h"
+
+#include <chrono>
+
+using namespace erpc;
+using namespace erpcShim;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+Batching_service *svc;
+
+static uint32_t s_notifiedCount = 0;
+static bool s_notifiedOrdered = true;
+static std::chrono::steady_clock::time_point s_firstNotified;
+static std::chrono::steady_clock::time_point s_lastNotified;
+
+////////////////////////////////////////////////////////////////////////////////
+// Implementation of function code
+////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t ageMs(std::chrono::steady_clock::time_point time)
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - time)
+        .count();
+}
+
+void notifyValue(uint32_t value)
+{
+    s_lastNotified = std::chrono::steady_clock::now();
+    if (s_notifiedCount == 0U)
+    {
+        s_firstNotified = s_lastNotified;
+    }
+
+    if (value != s_notifiedCount)
+    {
+        s_notifiedOrdered = false;
+    }
+    ++s_notifiedCount;
+}
+
+uint32_t echo(uint32_t value)
+{
+    return value;
+}
+
+uint32_t getNotified(uint32_t *firstAgeMs, uint32_t *lastAgeMs, bool *ordered)
+{
+    uint32_t count = s_notifiedCount;
+
+    *firstAgeMs = (count != 0U) ? ageMs(s_firstNotified) : 0U;
+    *lastAgeMs = (count != 0U) ? ageMs(s_lastNotified) : 0U;
+    *ordered = s_notifiedOrdered;
+
+    s_notifiedCount = 0;
+    s_notifiedOrdered = true;
+
+    return count;
+}
+
+class Batching_server : public Batching_interface
+{
+public:
+    void notifyValue(uint32_t value) { ::notifyValue(value); }
+
+    uint32_t echo(uint32_t value)
+    {
+        uint32_t result;
+        result = ::echo(value);
+
+        return result;
+    }
+
+    uint32_t getNotified(uint32_t *firstAgeMs, uint32_t *lastAgeMs, bool *ordered)
+    {
+        uint32_t result;
+        result = ::getNotified(firstAgeMs, lastAgeMs, ordered);
+
+        return result;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Add service to server code
+////////////////////////////////////////////////////////////////////////////////
+
+void add_services(erpc::SimpleServer *server)
+{
+    // define services to add on heap
+    // allocate on heap so service doesn't go out of scope at end of method
+    svc = new Batching_service(new Batching_server());
+
+    // add services
+    server->addService(svc);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Remove service from server code
+////////////////////////////////////////////////////////////////////////////////
+
+void remove_services(erpc::SimpleServer *server)
+{
+    /* Remove services
+     * Example: server->removeService (svc);
+     */
+    server->removeService(svc);
+    /* Delete unused service
+     */
+    delete svc->getHandler();
+    delete svc;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+erpc_service_t service_test = NULL;
+void add_services_to_server(erpc_server_t server)
+{
+    service_test = create_Batching_service();
+    erpc_add_service_to_server(server, service_test);
+}
+
+void remove_services_from_server(erpc_server_t server)
+{
+    erpc_remove_service_from_server(server, service_test);
+    destroy_Batching_service(service_test);
+}
+
+#ifdef __cplusplus
+}
+#endif
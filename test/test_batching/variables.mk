@@ -0,0 +1,8 @@
+#-------------------------------------------------------------------------------
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#-------------------------------------------------------------------------------
+
+# Client and server wrap TCP transport into batching transport
+TEST_MAIN = $(UT_COMMON_SRC)/unit_test_$(TRANSPORT)_batching_$(APP_TYPE).cpp
@@ -7,6 +7,7 @@
  */
 
 #include "c_test_client.h"
+#include "erpc_client_setup.h"
 #include "gtest.h"
 #include "unit_test_wrapped.h"
 
@@ -18,8 +19,15 @@ using namespace std;
 // Unit test Implementation code
 ////////////////////////////////////////////////////////////////////////////////
 
+#if ERPC_STATS
+static erpc_client_t s_client;
+#endif
+
 void initInterfaces(erpc_client_t client)
 {
+#if ERPC_STATS
+    s_client = client;
+#endif
     initBuiltinServices_client(client);
 }
 
@@ -165,3 +173,47 @@ TEST(test_builtin, StringReturnTest1)
     EXPECT_STREQ("Hello", ret);
     erpc_free(ret);
 }
+
+#if ERPC_STATS
+TEST(test_builtin, CallStatsTest)
+{
+    erpc_call_stats_t stats[ERPC_STATS_METHODS_COUNT];
+    uint32_t calls = 1UL << ERPC_STATS_SAMPLE_SHIFT;
+    uint32_t count;
+    uint32_t i;
+    const erpc_call_stats_t *method = NULL;
+
+    (void)erpc_client_get_stats(s_client, NULL, 0, true);
+
+    // Time of one of these calls is measured.
+    for (i = 0; i < calls; ++i)
+    {
+        EXPECT_EQ(sendHello("Hello World!"), 0);
+    }
+
+    count = erpc_client_get_stats(s_client, stats, ERPC_STATS_METHODS_COUNT, true);
+    EXPECT_LE(count, ERPC_STATS_METHODS_COUNT);
+    for (i = 0; i < count; ++i)
+    {
+        if ((stats[i].serviceId == kBuiltinServices_service_id) &&
+            (stats[i].methodId == kBuiltinServices_sendHello_id))
+        {
+            method = &stats[i];
+        }
+    }
+
+    ASSERT_TRUE(method != NULL);
+    EXPECT_EQ(method->calls, calls);
+    EXPECT_EQ(method->errors, 0U);
+    EXPECT_EQ(method->sampledCalls, 1U);
+    EXPECT_GT(method->bytesOut, 0U);
+    EXPECT_GT(method->bytesIn, 0U);
+    EXPECT_GT(method->time[kErpcCallPhase_Transport], 0U);
+
+    count = erpc_client_get_stats(s_client, stats, ERPC_STATS_METHODS_COUNT, false);
+    for (i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(stats[i].calls, 0U);
+    }
+}
+#endif
@@ -0,0 +1,7 @@
+#-------------------------------------------------------------------------------
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#-------------------------------------------------------------------------------
+
+include $(TEST_ROOT)/$(TEST_NAME)/client.mk
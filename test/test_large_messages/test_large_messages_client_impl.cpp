@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "c_test_client.h"
+#include "gtest.h"
+#include "unit_test_wrapped.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! Count of list elements, messages carry about 200 KB of data.
+#define LARGE_LIST_COUNT (50000U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Unit test Implementation code
+////////////////////////////////////////////////////////////////////////////////
+
+void initInterfaces(erpc_client_t client)
+{
+    initLargeMessages_client(client);
+}
+
+TEST(test_large_messages, sumBinary)
+{
+    binary_t send;
+    uint32_t sum = 0U;
+
+    send.dataLength = 4U * LARGE_LIST_COUNT;
+    send.data = (uint8_t *)erpc_malloc(send.dataLength * sizeof(uint8_t));
+    for (uint32_t i = 0; i < send.dataLength; ++i)
+    {
+        send.data[i] = (uint8_t)(i * 7U);
+        sum += send.data[i];
+    }
+
+    EXPECT_EQ(sumBinary(&send), sum);
+
+    erpc_free(send.data);
+}
+
+TEST(test_large_messages, fillList)
+{
+    list_uint32_1_t *received_list = fillList(LARGE_LIST_COUNT, 11U);
+
+    ASSERT_TRUE(received_list != NULL);
+    ASSERT_EQ(received_list->elementsCount, LARGE_LIST_COUNT);
+    for (uint32_t i = 0; i < received_list->elementsCount; ++i)
+    {
+        ASSERT_EQ(received_list->elements[i], (i * 2654435761U) + 11U);
+    }
+
+    erpc_free(received_list->elements);
+    erpc_free(received_list);
+}
+
+TEST(test_large_messages, reverseList)
+{
+    list_uint32_1_t send_list;
+    list_uint32_1_t *received_list;
+
+    send_list.elementsCount = LARGE_LIST_COUNT;
+    send_list.elements = (uint32_t *)erpc_malloc(send_list.elementsCount * sizeof(uint32_t));
+    for (uint32_t i = 0; i < send_list.elementsCount; ++i)
+    {
+        send_list.elements[i] = i * 3U;
+    }
+
+    received_list = reverseList(&send_list);
+
+    ASSERT_TRUE(received_list != NULL);
+    ASSERT_EQ(received_list->elementsCount, send_list.elementsCount);
+    for (uint32_t i = 0; i < received_list->elementsCount; ++i)
+    {
+        ASSERT_EQ(received_list->elements[i], send_list.elements[send_list.elementsCount - i - 1U]);
+    }
+
+    erpc_free(send_list.elements);
+    erpc_free(received_list->elements);
+    erpc_free(received_list);
+}
@@ -0,0 +1,8 @@
+#-------------------------------------------------------------------------------
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#-------------------------------------------------------------------------------
+
+# Test apps use message buffers bigger than 64 KB
+CXXFLAGS += -DUNIT_TEST_MESSAGE_BUFFER_SIZE=0x40000
@@ -550,3 +550,43 @@ TEST(test_list, sendGapAdvertisingData)
     erpc_free(ad2.aData);
     erpc_free(ad.aAdStructures);
 }
+
+TEST(test_list, testBorrowedAnnotation)
+{
+    uint32_t length = 5;
+    int64_t *list = (int64_t *)erpc_malloc(length * sizeof(int64_t));
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        list[i] = (int64_t)(i + 1) * 0x100000000LL;
+    }
+    // Different pad values shift the list data in the message buffer.
+    for (uint8_t pad = 0; pad < 8; ++pad)
+    {
+        int32_t result = testBorrowedAnnotation(pad, list, length, "borrowed");
+        EXPECT_EQ(result, 1);
+    }
+    erpc_free(list);
+}
+
+TEST(test_list, testBorrowedLists)
+{
+    uint8_t pad[8] = { 0 };
+    double first[3] = { 0.5, -1.25, 3.0 };
+    uint16_t second[4] = { 1, 2, 3, 4 };
+    float third[3] = { 0.5f, -1.25f, 3.0f };
+    binary_t padBinary;
+
+    padBinary.data = pad;
+
+    // Each list is aligned in place right behind the string or the list before it. Pad and length of the second
+    // list put them at every alignment.
+    for (uint32_t padLen = 1; padLen <= 8U; ++padLen)
+    {
+        for (uint32_t secondLen = 1; secondLen <= 4U; ++secondLen)
+        {
+            padBinary.dataLength = padLen;
+            int32_t result = testBorrowedLists(&padBinary, "borrowed", first, 3, second, secondLen, third, 3);
+            EXPECT_EQ(result, 1) << "pad " << padLen << ", second list length " << secondLen;
+        }
+    }
+}
@@ -313,6 +313,52 @@ int32_t sendGapAdvertisingData(const gapAdvertisingData_t *ad)
     return 33;
 }
 
+int32_t testBorrowedAnnotation(uint8_t pad, const int64_t *myList, uint32_t len, const char *name)
+{
+    (void)pad;
+    if (((uintptr_t)myList % sizeof(int64_t)) != 0U)
+    {
+        return 0;
+    }
+    for (uint32_t i = 0; i < len; ++i)
+    {
+        if (myList[i] != (int64_t)(i + 1) * 0x100000000LL)
+        {
+            return 0;
+        }
+    }
+    return (strcmp(name, "borrowed") == 0) ? 1 : 0;
+}
+
+int32_t testBorrowedLists(const binary_t *pad, const char *name, const double *first, uint32_t firstLen,
+                          const uint16_t *second, uint32_t secondLen, const float *third, uint32_t thirdLen)
+{
+    (void)pad;
+    if ((((uintptr_t)first % sizeof(double)) != 0U) || (((uintptr_t)second % sizeof(uint16_t)) != 0U) ||
+        (((uintptr_t)third % sizeof(float)) != 0U))
+    {
+        return 0;
+    }
+    if ((firstLen != 3U) || (first[0] != 0.5) || (first[1] != -1.25) || (first[2] != 3.0))
+    {
+        return 0;
+    }
+    for (uint32_t i = 0; i < secondLen; ++i)
+    {
+        if (second[i] != (uint16_t)(i + 1U))
+        {
+            return 0;
+        }
+    }
+    if ((thirdLen != 3U) || (third[0] != 0.5f) || (third[1] != -1.25f) || (third[2] != 3.0f))
+    {
+        return 0;
+    }
+
+    // Aligning the lists must not overwrite the string.
+    return (strcmp(name, "borrowed") == 0) ? 1 : 0;
+}
+
 class PointersService_server : public PointersService_interface
 {
 public:
@@ -416,6 +462,23 @@ public:
 
         return result;
     }
+
+    int32_t testBorrowedAnnotation(uint8_t pad, const int64_t *myList, uint32_t len, const char *name)
+    {
+        int32_t result;
+        result = ::testBorrowedAnnotation(pad, myList, len, name);
+
+        return result;
+    }
+
+    int32_t testBorrowedLists(const binary_t *pad, const char *name, const double *first, uint32_t firstLen,
+                              const uint16_t *second, uint32_t secondLen, const float *third, uint32_t thirdLen)
+    {
+        int32_t result;
+        result = ::testBorrowedLists(pad, name, first, firstLen, second, secondLen, third, thirdLen);
+
+        return result;
+    }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,8 @@
+#-------------------------------------------------------------------------------
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#-------------------------------------------------------------------------------
+
+# Client and server of test_lists, only IDL differs
+TEST_IMPL=$(TEST_ROOT)/test_lists/test_lists
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "c_test_client.h"
+#include "gtest.h"
+#include "unit_test_wrapped.h"
+
+using namespace std;
+
+////////////////////////////////////////////////////////////////////////////////
+// Unit test Implementation code
+////////////////////////////////////////////////////////////////////////////////
+
+void initInterfaces(erpc_client_t client)
+{
+    initStreamService_client(client);
+}
+
+TEST(test_stream, streamIn)
+{
+    binary_t send;
+    uint32_t sum = 7U;
+
+    // Many times bigger than a message buffer.
+    send.dataLength = 5000U;
+    send.data = (uint8_t *)erpc_malloc(send.dataLength * sizeof(uint8_t));
+    for (uint32_t i = 0; i < send.dataLength; ++i)
+    {
+        send.data[i] = (uint8_t)(i * 13U);
+        sum += send.data[i];
+    }
+
+    EXPECT_EQ(streamIn(7U, &send), sum);
+
+    erpc_free(send.data);
+}
+
+TEST(test_stream, streamInZeroSize)
+{
+    binary_t send;
+    send.dataLength = 0U;
+    send.data = NULL;
+
+    EXPECT_EQ(streamIn(3U, &send), 3U);
+}
+
+TEST(test_stream, streamOut)
+{
+    list_int32_1_t *received_list = streamOut(3000U);
+
+    ASSERT_TRUE(received_list != NULL);
+    EXPECT_EQ(received_list->elementsCount, 3000U);
+    for (uint32_t i = 0; i < received_list->elementsCount; ++i)
+    {
+        EXPECT_EQ(received_list->elements[i], (int32_t)(i * 100003U) - 1500000000);
+    }
+
+    erpc_free(received_list->elements);
+    erpc_free(received_list);
+}
+
+TEST(test_stream, streamOutZeroSize)
+{
+    list_int32_1_t *received_list = streamOut(0U);
+
+    ASSERT_TRUE(received_list != NULL);
+    EXPECT_EQ(received_list->elementsCount, 0U);
+
+    erpc_free(received_list->elements);
+    erpc_free(received_list);
+}
+
+TEST(test_stream, streamEcho)
+{
+    list_uint16_1_t send_list;
+    list_uint16_1_t *received_list;
+    uint32_t sum = 0U;
+    uint32_t received_sum = 0U;
+
+    send_list.elementsCount = 2000U;
+    send_list.elements = (uint16_t *)erpc_malloc(send_list.elementsCount * sizeof(uint16_t));
+    for (uint32_t i = 0; i < send_list.elementsCount; ++i)
+    {
+        send_list.elements[i] = (uint16_t)(i * 33U);
+        sum += send_list.elements[i];
+    }
+
+    received_list = streamEcho(&send_list, &received_sum);
+
+    ASSERT_TRUE(received_list != NULL);
+    EXPECT_EQ(received_sum, sum);
+    EXPECT_EQ(received_list->elementsCount, send_list.elementsCount);
+    for (uint32_t i = 0; i < received_list->elementsCount; ++i)
+    {
+        EXPECT_EQ(received_list->elements[i], send_list.elements[send_list.elementsCount - i - 1U]);
+    }
+
+    erpc_free(send_list.elements);
+    erpc_free(received_list->elements);
+    erpc_free(received_list);
+}
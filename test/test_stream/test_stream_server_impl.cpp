@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_server_setup.h"
+
+#include "c_test_server.h"
+#include "c_test_unit_test_common_server.h"
+#include "test_server.hpp"
+#include "unit_test.h"
+#include "unit_test_wrapped.h"
+
+using namespace erpc;
+using namespace erpcShim;
+
+StreamService_service *svc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Implementation of function code
+////////////////////////////////////////////////////////////////////////////////
+
+uint32_t streamIn(uint32_t seed, const binary_t *data)
+{
+    uint32_t sum = seed;
+
+    for (uint32_t i = 0; i < data->dataLength; ++i)
+    {
+        sum += data->data[i];
+    }
+
+    return sum;
+}
+
+list_int32_1_t *streamOut(uint32_t count)
+{
+    list_int32_1_t *send_list = (list_int32_1_t *)erpc_malloc(sizeof(list_int32_1_t));
+    send_list->elementsCount = count;
+    send_list->elements = (int32_t *)erpc_malloc(count * sizeof(int32_t));
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        send_list->elements[i] = (int32_t)(i * 100003U) - 1500000000;
+    }
+
+    return send_list;
+}
+
+list_uint16_1_t *streamEcho(const list_uint16_1_t *values, uint32_t *sum)
+{
+    list_uint16_1_t *send_list = (list_uint16_1_t *)erpc_malloc(sizeof(list_uint16_1_t));
+    send_list->elementsCount = values->elementsCount;
+    send_list->elements = (uint16_t *)erpc_malloc(values->elementsCount * sizeof(uint16_t));
+
+    *sum = 0U;
+    for (uint32_t i = 0; i < values->elementsCount; ++i)
+    {
+        send_list->elements[i] = values->elements[values->elementsCount - i - 1U];
+        *sum += values->elements[i];
+    }
+
+    return send_list;
+}
+
+class StreamService_server : public StreamService_interface
+{
+public:
+    uint32_t streamIn(uint32_t seed, const binary_t *data) { return ::streamIn(seed, data); }
+
+    list_int32_1_t *streamOut(uint32_t count) { return ::streamOut(count); }
+
+    list_uint16_1_t *streamEcho(const list_uint16_1_t *values, uint32_t *sum) { return ::streamEcho(values, sum); }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Add service to server code
+////////////////////////////////////////////////////////////////////////////////
+
+void add_services(erpc::SimpleServer *server)
+{
+    /* Define services to add using dynamic memory allocation
+     * Exapmle:ArithmeticService_service * svc = new ArithmeticService_service();
+     */
+    svc = new StreamService_service(new StreamService_server());
+
+    /* Add services
+     * Example: server->addService(svc);
+     */
+    server->addService(svc);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Remove service from server code
+////////////////////////////////////////////////////////////////////////////////
+
+void remove_services(erpc::SimpleServer *server)
+{
+    /* Remove services
+     * Example: server->removeService (svc);
+     */
+    server->removeService(svc);
+    /* Delete unused service
+     */
+    delete svc->getHandler();
+    delete svc;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+erpc_service_t service_test = NULL;
+void add_services_to_server(erpc_server_t server)
+{
+    service_test = create_StreamService_service();
+    erpc_add_service_to_server(server, service_test);
+}
+
+void remove_services_from_server(erpc_server_t server)
+{
+    erpc_remove_service_from_server(server, service_test);
+    destroy_StreamService_service(service_test);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,9 @@
+#-------------------------------------------------------------------------------
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#-------------------------------------------------------------------------------
+
+# Client and server of test_struct, only IDL differs
+TEST_IMPL=$(TEST_ROOT)/test_struct/test_struct
+ERPC_NAME_APP=test_ArithmeticService
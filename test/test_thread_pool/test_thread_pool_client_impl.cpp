@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "c_test_client.h"
+#include "gtest.h"
+#include "test_client.hpp"
+#include "unit_test_wrapped.h"
+
+using namespace erpc;
+using namespace erpcShim;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! Requests processed at once, server has one more worker for releaseWorkers().
+#define THREAD_POOL_TEST_BLOCKED_WORKERS (3U)
+
+//! Asynchronous requests in flight, one for each worker of the server.
+#define THREAD_POOL_TEST_ASYNC_REQUESTS (4U)
+
+//! Delay between replies of asynchronous requests.
+#define THREAD_POOL_TEST_DELAY_STEP_MS (100U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+static ThreadPool_client *s_client;
+
+////////////////////////////////////////////////////////////////////////////////
+// Unit test Implementation code
+////////////////////////////////////////////////////////////////////////////////
+
+void initInterfaces(erpc_client_t client)
+{
+    initThreadPool_client(client);
+    s_client = new ThreadPool_client(reinterpret_cast<ClientManager *>(client));
+}
+
+TEST(test_thread_pool, add)
+{
+    for (int32_t i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(add(i, 2 * i), 3 * i);
+    }
+}
+
+TEST(test_thread_pool, concurrentWorkers)
+{
+    // Blocked workers are released only by the next request, so it has to run in another worker.
+    for (uint32_t i = 0; i < THREAD_POOL_TEST_BLOCKED_WORKERS; ++i)
+    {
+        blockWorker();
+    }
+    EXPECT_TRUE(releaseWorkers(THREAD_POOL_TEST_BLOCKED_WORKERS));
+
+    // Server keeps serving after blocked requests end.
+    EXPECT_EQ(add(1, 2), 3);
+}
+
+TEST(test_thread_pool, asyncRepliesOutOfOrder)
+{
+    AsyncRequest requests[THREAD_POOL_TEST_ASYNC_REQUESTS];
+
+    // Later requests wait shorter, so server replies in reverse order.
+    for (uint32_t i = 0; i < THREAD_POOL_TEST_ASYNC_REQUESTS; ++i)
+    {
+        uint32_t delay = (THREAD_POOL_TEST_ASYNC_REQUESTS - 1U - i) * THREAD_POOL_TEST_DELAY_STEP_MS;
+        EXPECT_EQ(s_client->delayedEcho_async(requests[i], i, delay), kErpcStatus_Success);
+    }
+
+    for (uint32_t i = 0; i < THREAD_POOL_TEST_ASYNC_REQUESTS; ++i)
+    {
+        uint32_t delay = (THREAD_POOL_TEST_ASYNC_REQUESTS - 1U - i) * THREAD_POOL_TEST_DELAY_STEP_MS;
+        EXPECT_EQ(s_client->delayedEcho_async_result(requests[i], i, delay), i);
+
+        // Replies of the following requests arrived while waiting for the first one.
+        if (i == 0U)
+        {
+            for (uint32_t j = 1U; j < THREAD_POOL_TEST_ASYNC_REQUESTS; ++j)
+            {
+                EXPECT_TRUE(requests[j].isCompleted());
+            }
+        }
+    }
+
+    // Synchronous calls still get their replies.
+    EXPECT_EQ(add(2, 3), 5);
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_server_setup.h"
+
+#include "c_test_server.h"
+#include "c_test_unit_test_common_server.h"
+#include "test_server.hpp"
+#include "unit_test.h"
+#include "unit_test_wrapped.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace erpc;
+using namespace erpcShim;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! Blocked workers give up after this time, so broken server fails the test instead of hanging.
+#define THREAD_POOL_TEST_TIMEOUT std::chrono::seconds(5)
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+ThreadPool_service *svc;
+
+static std::mutex s_workersLock;
+static std::condition_variable s_workersChanged;
+static uint32_t s_blockedWorkers = 0;
+static bool s_released = false;
+
+////////////////////////////////////////////////////////////////////////////////
+// Implementation of function code
+////////////////////////////////////////////////////////////////////////////////
+
+int32_t add(int32_t a, int32_t b)
+{
+    return a + b;
+}
+
+void blockWorker(void)
+{
+    std::unique_lock<std::mutex> lock(s_workersLock);
+
+    ++s_blockedWorkers;
+    s_workersChanged.notify_all();
+    (void)s_workersChanged.wait_for(lock, THREAD_POOL_TEST_TIMEOUT, []() { return s_released; });
+    --s_blockedWorkers;
+    if (s_blockedWorkers == 0U)
+    {
+        s_released = false;
+    }
+}
+
+bool releaseWorkers(uint32_t count)
+{
+    std::unique_lock<std::mutex> lock(s_workersLock);
+    bool blocked;
+
+    blocked =
+        s_workersChanged.wait_for(lock, THREAD_POOL_TEST_TIMEOUT, [count]() { return s_blockedWorkers >= count; });
+    s_released = true;
+    s_workersChanged.notify_all();
+
+    return blocked;
+}
+
+uint32_t delayedEcho(uint32_t value, uint32_t delayMs)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+
+    return value;
+}
+
+class ThreadPool_server : public ThreadPool_interface
+{
+public:
+    int32_t add(int32_t a, int32_t b)
+    {
+        int32_t result;
+        result = ::add(a, b);
+
+        return result;
+    }
+
+    void blockWorker(void) { ::blockWorker(); }
+
+    bool releaseWorkers(uint32_t count)
+    {
+        bool result;
+        result = ::releaseWorkers(count);
+
+        return result;
+    }
+
+    uint32_t delayedEcho(uint32_t value, uint32_t delayMs)
+    {
+        uint32_t result;
+        result = ::delayedEcho(value, delayMs);
+
+        return result;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Add service to server code
+////////////////////////////////////////////////////////////////////////////////
+
+void add_services(erpc::SimpleServer *server)
+{
+    // define services to add on heap
+    // allocate on heap so service doesn't go out of scope at end of method
+    svc = new ThreadPool_service(new ThreadPool_server());
+
+    // add services
+    server->addService(svc);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Remove service from server code
+////////////////////////////////////////////////////////////////////////////////
+
+void remove_services(erpc::SimpleServer *server)
+{
+    /* Remove services
+     * Example: server->removeService (svc);
+     */
+    server->removeService(svc);
+    /* Delete unused service
+     */
+    delete svc->getHandler();
+    delete svc;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+erpc_service_t service_test = NULL;
+void add_services_to_server(erpc_server_t server)
+{
+    service_test = create_ThreadPool_service();
+    erpc_add_service_to_server(server, service_test);
+}
+
+void remove_services_from_server(erpc_server_t server)
+{
+    erpc_remove_service_from_server(server, service_test);
+    destroy_ThreadPool_service(service_test);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,8 @@
+#-------------------------------------------------------------------------------
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#-------------------------------------------------------------------------------
+
+# Server is created by erpc_server_thread_pool_init()
+TEST_MAIN = $(UT_COMMON_SRC)/unit_test_$(TRANSPORT)_$(if $(filter server,$(APP_TYPE)),thread_pool_server,client).cpp
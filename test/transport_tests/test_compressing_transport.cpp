@@ -0,0 +1,257 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_compressing_transport.hpp"
+
+#include "gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+typedef std::vector<uint8_t> bytes_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Compressor and decompressor of the LZ4 block format used by CompressingTransport.
+ */
+class CompressingTransportTest : public ::testing::Test
+{
+protected:
+    CompressingTransport m_transport;
+
+    //! @brief Worst case size of LZ4 block.
+    static uint32_t compressBound(uint32_t length) { return length + (length / 255U) + 16U; }
+
+    bytes_t compress(const bytes_t &data)
+    {
+        bytes_t compressed(compressBound((uint32_t)data.size()));
+        uint32_t length =
+            m_transport.compress(data.data(), (uint32_t)data.size(), compressed.data(), (uint32_t)compressed.size());
+
+        EXPECT_NE(length, 0U);
+        compressed.resize(length);
+        return compressed;
+    }
+
+    static erpc_status_t decompress(const bytes_t &compressed, bytes_t &data, uint32_t dstLength)
+    {
+        uint32_t length = 0;
+        erpc_status_t status;
+
+        data.assign(dstLength, 0xA5U);
+        status = CompressingTransport::decompress(compressed.data(), (uint32_t)compressed.size(), data.data(),
+                                                  dstLength, length);
+        if (status == kErpcStatus_Success)
+        {
+            data.resize(length);
+        }
+
+        return status;
+    }
+
+    void expectRoundTrip(const bytes_t &data)
+    {
+        bytes_t compressed = compress(data);
+        bytes_t decompressed;
+
+        ASSERT_EQ(decompress(compressed, decompressed, (uint32_t)data.size()), kErpcStatus_Success);
+        EXPECT_TRUE(decompressed == data);
+    }
+
+    static bytes_t random(uint32_t length, uint32_t seed)
+    {
+        bytes_t data(length);
+
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            data[i] = (uint8_t)(seed >> 16U);
+        }
+
+        return data;
+    }
+
+    //! @brief Array of similar records, typical eRPC message.
+    static bytes_t records(uint32_t length)
+    {
+        bytes_t data(length);
+
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            data[i] = ((i % 12U) < 4U) ? (uint8_t)(i / 12U) : (uint8_t)(i % 12U);
+        }
+
+        return data;
+    }
+};
+
+TEST_F(CompressingTransportTest, Empty)
+{
+    bytes_t compressed = compress(bytes_t());
+    bytes_t decompressed;
+
+    // Only token of last sequence without literals.
+    ASSERT_EQ(compressed.size(), 1U);
+    EXPECT_EQ(compressed[0], 0U);
+    ASSERT_EQ(decompress(compressed, decompressed, 0), kErpcStatus_Success);
+    EXPECT_TRUE(decompressed.empty());
+
+    // Block has at least the last token.
+    EXPECT_EQ(decompress(bytes_t(), decompressed, 16), kErpcStatus_ReceiveFailed);
+}
+
+TEST_F(CompressingTransportTest, ShortData)
+{
+    // Data shorter than match find limit are stored as literals.
+    for (uint32_t length = 1; length <= 16U; ++length)
+    {
+        SCOPED_TRACE(length);
+        expectRoundTrip(bytes_t(length, 7U));
+    }
+}
+
+TEST_F(CompressingTransportTest, Incompressible)
+{
+    bytes_t data = random(2000, 1);
+    bytes_t compressed = compress(data);
+
+    // Literal length continues in extra bytes.
+    EXPECT_GT(compressed.size(), data.size());
+    expectRoundTrip(data);
+
+    // Compressed data are not accepted when they are not smaller.
+    bytes_t dst(data.size() - 1U);
+    EXPECT_EQ(m_transport.compress(data.data(), (uint32_t)data.size(), dst.data(), (uint32_t)dst.size()), 0U);
+}
+
+TEST_F(CompressingTransportTest, LongRun)
+{
+    bytes_t data(5000, 0x42U);
+    bytes_t compressed = compress(data);
+
+    // One match with offset 1 overlapping its own output, match length continues in extra bytes.
+    EXPECT_LT(compressed.size(), 40U);
+    expectRoundTrip(data);
+}
+
+TEST_F(CompressingTransportTest, Records)
+{
+    for (uint32_t length = 60; length < 600U; length += 7U)
+    {
+        SCOPED_TRACE(length);
+        bytes_t data = records(length);
+        bytes_t compressed = compress(data);
+
+        EXPECT_LT(compressed.size(), data.size());
+        expectRoundTrip(data);
+
+        // Too small buffer is reported, not overflowed.
+        bytes_t dst(compressed.size() + 1U, 0xA5U);
+        EXPECT_EQ(m_transport.compress(data.data(), (uint32_t)data.size(), dst.data(), (uint32_t)compressed.size() - 1U),
+                  0U);
+        EXPECT_EQ(dst[compressed.size() - 1U], 0xA5U);
+    }
+}
+
+TEST_F(CompressingTransportTest, RandomData)
+{
+    for (uint32_t seed = 0; seed < 50U; ++seed)
+    {
+        // Random bytes from small alphabet have many short matches.
+        bytes_t data = random(100U + (seed * 37U), seed);
+        for (uint8_t &byte : data)
+        {
+            byte &= 3U;
+        }
+
+        SCOPED_TRACE(seed);
+        expectRoundTrip(data);
+    }
+}
+
+TEST_F(CompressingTransportTest, OverlappingMatch)
+{
+    // Literals "ab", match of 10 bytes at offset 2 repeats them, last sequence is empty.
+    bytes_t compressed = { 0x26U, 'a', 'b', 0x02U, 0x00U, 0x00U };
+    bytes_t decompressed;
+
+    ASSERT_EQ(decompress(compressed, decompressed, 64), kErpcStatus_Success);
+    EXPECT_TRUE(decompressed == bytes_t({ 'a', 'b', 'a', 'b', 'a', 'b', 'a', 'b', 'a', 'b', 'a', 'b' }));
+
+    // Output buffer too small for the match.
+    EXPECT_EQ(decompress(compressed, decompressed, 11), kErpcStatus_ReceiveFailed);
+}
+
+TEST_F(CompressingTransportTest, InvalidOffset)
+{
+    bytes_t decompressed;
+
+    // Offset 0.
+    EXPECT_EQ(decompress(bytes_t({ 0x10U, 'a', 0x00U, 0x00U, 0x00U }), decompressed, 64), kErpcStatus_ReceiveFailed);
+
+    // Offset before start of output.
+    EXPECT_EQ(decompress(bytes_t({ 0x10U, 'a', 0x02U, 0x00U, 0x00U }), decompressed, 64), kErpcStatus_ReceiveFailed);
+    EXPECT_EQ(decompress(bytes_t({ 0x00U, 0x01U, 0x00U, 0x00U }), decompressed, 64), kErpcStatus_ReceiveFailed);
+    EXPECT_EQ(decompress(bytes_t({ 0x10U, 'a', 0xFFU, 0xFFU, 0x00U }), decompressed, 64), kErpcStatus_ReceiveFailed);
+
+    // Offset 1 is valid.
+    EXPECT_EQ(decompress(bytes_t({ 0x10U, 'a', 0x01U, 0x00U, 0x00U }), decompressed, 64), kErpcStatus_Success);
+    EXPECT_TRUE(decompressed == bytes_t(5, 'a'));
+}
+
+TEST_F(CompressingTransportTest, Truncated)
+{
+    bytes_t data = records(500);
+    bytes_t compressed = compress(data);
+    bytes_t decompressed;
+
+    for (uint32_t length = 0; length < compressed.size(); ++length)
+    {
+        SCOPED_TRACE(length);
+        bytes_t truncated(compressed.begin(), compressed.begin() + length);
+
+        // Block cut right behind literals looks like a shorter block, anything else is rejected.
+        if (decompress(truncated, decompressed, (uint32_t)data.size()) == kErpcStatus_Success)
+        {
+            ASSERT_LT(decompressed.size(), data.size());
+            EXPECT_TRUE(std::equal(decompressed.begin(), decompressed.end(), data.begin()));
+        }
+    }
+
+    // Cut in the middle of literals, of offset and of length bytes.
+    EXPECT_EQ(decompress(bytes_t({ 0x30U, 'a', 'b' }), decompressed, 64), kErpcStatus_ReceiveFailed);
+    EXPECT_EQ(decompress(bytes_t({ 0x10U, 'a', 0x01U }), decompressed, 64), kErpcStatus_ReceiveFailed);
+    EXPECT_EQ(decompress(bytes_t({ 0xF0U, 0xFFU }), decompressed, 1024), kErpcStatus_ReceiveFailed);
+    EXPECT_EQ(decompress(bytes_t({ 0x1FU, 'a', 0x01U, 0x00U }), decompressed, 1024), kErpcStatus_ReceiveFailed);
+}
+
+TEST_F(CompressingTransportTest, LengthsBeyondOutput)
+{
+    bytes_t decompressed;
+    bytes_t compressed = { 0xF0U };
+
+    // Literal length far beyond output buffer is rejected before it overflows.
+    compressed.insert(compressed.end(), 100, 0xFFU);
+    EXPECT_EQ(decompress(compressed, decompressed, 1024), kErpcStatus_ReceiveFailed);
+
+    // Same for match length.
+    compressed = { 0x1FU, 'a', 0x01U, 0x00U };
+    compressed.insert(compressed.end(), 100, 0xFFU);
+    EXPECT_EQ(decompress(compressed, decompressed, 1024), kErpcStatus_ReceiveFailed);
+
+    // Literals longer than output buffer.
+    EXPECT_EQ(decompress(bytes_t({ 0x30U, 'a', 'b', 'c' }), decompressed, 2), kErpcStatus_ReceiveFailed);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_crc16.hpp"
+
+#include "gtest.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! Longest data checked, several 8 byte blocks of slicing-by-8 with all tail lengths.
+#define CRC16_TEST_MAX_LENGTH (300U)
+
+//! Offsets of data start, covering every alignment of 8 byte blocks.
+#define CRC16_TEST_ALIGNMENTS (8U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief CRC16 used by framed transports computed bit by bit.
+ */
+static uint16_t referenceCrc16(uint16_t crcStart, const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = crcStart;
+
+    for (uint32_t j = 0; j < length; ++j)
+    {
+        crc ^= (uint32_t)data[j] << 8;
+        for (uint32_t i = 0; i < 8U; ++i)
+        {
+            crc = ((crc & 0x8000U) != 0U) ? ((crc << 1) ^ 0x1021U) : (crc << 1);
+            crc &= 0xFFFFU;
+        }
+    }
+
+    return (uint16_t)crc;
+}
+
+TEST(Crc16Test, KnownAnswers)
+{
+    const uint8_t check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    Crc16 xmodem(0);
+    Crc16 ccittFalse(0xFFFFU);
+    Crc16 erpcDefault;
+
+    // CRC-16/XMODEM and CRC-16/CCITT-FALSE check values.
+    EXPECT_EQ(xmodem.computeCRC16(check, sizeof(check)), 0x31C3U);
+    EXPECT_EQ(ccittFalse.computeCRC16(check, sizeof(check)), 0x29B1U);
+
+    // Empty data leave the start value.
+    EXPECT_EQ(erpcDefault.computeCRC16(check, 0), 0xEF4AU);
+    EXPECT_EQ(erpcDefault.computeCRC16(check, sizeof(check)), referenceCrc16(0xEF4AU, check, sizeof(check)));
+}
+
+TEST(Crc16Test, AllLengthsAndAlignments)
+{
+    std::vector<uint8_t> buffer(CRC16_TEST_MAX_LENGTH + CRC16_TEST_ALIGNMENTS);
+    uint32_t seed = 1;
+    Crc16 crc16;
+
+    for (uint8_t &byte : buffer)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        byte = (uint8_t)(seed >> 16U);
+    }
+
+    for (uint32_t offset = 0; offset < CRC16_TEST_ALIGNMENTS; ++offset)
+    {
+        for (uint32_t length = 0; length <= CRC16_TEST_MAX_LENGTH; ++length)
+        {
+            const uint8_t *data = buffer.data() + offset;
+
+            ASSERT_EQ(crc16.computeCRC16(data, length), referenceCrc16(0xEF4AU, data, length))
+                << "offset " << offset << ", length " << length;
+        }
+    }
+}
+
+TEST(Crc16Test, EveryByteAtEveryBlockPosition)
+{
+    uint8_t data[2U * CRC16_TEST_ALIGNMENTS];
+    Crc16 crc16;
+
+    // Each byte value at each position of 8 byte block reaches every entry of every lookup table.
+    for (uint32_t position = 0; position < sizeof(data); ++position)
+    {
+        for (uint32_t value = 0; value < 256U; ++value)
+        {
+            (void)memset(data, 0, sizeof(data));
+            data[position] = (uint8_t)value;
+
+            ASSERT_EQ(crc16.computeCRC16(data, sizeof(data)), referenceCrc16(0xEF4AU, data, sizeof(data)))
+                << "position " << position << ", value " << value;
+        }
+    }
+}
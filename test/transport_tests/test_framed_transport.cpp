@@ -0,0 +1,310 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_framed_transport.hpp"
+#include "erpc_tcp_transport.hpp"
+
+#include "gtest.h"
+
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#if !defined(__MINGW32__)
+extern "C" {
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+}
+#endif
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#define FRAMED_TEST_READ_AHEAD_SIZE (128U)
+
+typedef std::vector<uint8_t> bytes_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Framed transport over a scripted stream.
+ *
+ * Each queued chunk is what one read of the channel returns at most, like data which arrived on a socket
+ * together. Sent frames are collected, so they can be queued to another instance.
+ */
+class ScriptedFramedTransport : public FramedTransport
+{
+public:
+    explicit ScriptedFramedTransport(uint32_t readAheadSize = FRAMED_TEST_READ_AHEAD_SIZE) :
+    m_reads(0)
+    {
+        setCrc16(&m_crc16);
+        setReadAheadBuffer(m_readAhead, readAheadSize);
+    }
+
+    virtual ~ScriptedFramedTransport(void) {}
+
+    void addChunk(const bytes_t &chunk) { m_chunks.push_back(chunk); }
+
+    //! @brief What close() of a stream transport does with its read-ahead buffer.
+    void dropReadAhead(void) { resetReadAhead(); }
+
+    uint32_t readAheadLength(void) const { return m_readAheadTail - m_readAheadHead; }
+
+    Crc16 m_crc16;
+    uint8_t m_readAhead[FRAMED_TEST_READ_AHEAD_SIZE];
+    std::deque<bytes_t> m_chunks;
+    bytes_t m_sent;
+    uint32_t m_reads; //!< Count of reads of the channel.
+
+protected:
+    virtual erpc_status_t underlyingSend(const uint8_t *data, uint32_t size) override
+    {
+        m_sent.insert(m_sent.end(), data, data + size);
+        return kErpcStatus_Success;
+    }
+
+    virtual erpc_status_t underlyingReceive(uint8_t *data, uint32_t size) override
+    {
+        uint32_t received;
+
+        return underlyingReceiveAvailable(data, size, size, received);
+    }
+
+    virtual erpc_status_t underlyingReceiveAvailable(uint8_t *data, uint32_t minSize, uint32_t maxSize,
+                                                     uint32_t &received) override
+    {
+        erpc_status_t status = kErpcStatus_Success;
+        uint32_t length;
+
+        received = 0;
+        while (received < minSize)
+        {
+            if (m_chunks.empty())
+            {
+                status = kErpcStatus_ConnectionClosed;
+                break;
+            }
+
+            ++m_reads;
+            bytes_t &chunk = m_chunks.front();
+            length = (uint32_t)chunk.size();
+            if (length > (maxSize - received))
+            {
+                length = maxSize - received;
+            }
+            memcpy(&data[received], chunk.data(), length);
+            received += length;
+            chunk.erase(chunk.begin(), chunk.begin() + length);
+            if (chunk.empty())
+            {
+                m_chunks.pop_front();
+            }
+        }
+
+        return status;
+    }
+};
+
+/*!
+ * @brief TCP transport exposing its read-ahead state.
+ */
+class InspectedTCPTransport : public TCPTransport
+{
+public:
+    InspectedTCPTransport(const char *host, uint16_t port) :
+    TCPTransport(host, port, false)
+    {
+        setCrc16(&m_crc16);
+    }
+
+    uint32_t readAheadLength(void) const { return m_readAheadTail - m_readAheadHead; }
+
+    Crc16 m_crc16;
+};
+
+static uint8_t payloadByte(uint32_t seed, uint32_t i)
+{
+    return (uint8_t)((seed * 31U) + i);
+}
+
+//! @brief Frame of @a length payload bytes, built by the framed transport itself.
+static bytes_t frame(uint32_t length, uint32_t seed)
+{
+    ScriptedFramedTransport sender;
+    bytes_t data(sender.reserveHeaderSize() + length);
+    MessageBuffer message(data.data(), (uint32_t)data.size());
+
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        data[sender.reserveHeaderSize() + i] = payloadByte(seed, i);
+    }
+    message.setUsed((uint32_t)data.size());
+    EXPECT_EQ(sender.send(&message), kErpcStatus_Success);
+
+    return sender.m_sent;
+}
+
+static bytes_t concat(const bytes_t &first, const bytes_t &second)
+{
+    bytes_t result(first);
+
+    result.insert(result.end(), second.begin(), second.end());
+    return result;
+}
+
+//! @brief Receives one message and checks it is the frame(length, seed).
+static void expectFrame(Transport &transport, uint32_t length, uint32_t seed)
+{
+    uint8_t data[ERPC_DEFAULT_BUFFER_SIZE];
+    MessageBuffer message(data, sizeof(data));
+    uint32_t offset = transport.reserveHeaderSize();
+
+    ASSERT_EQ(transport.receive(&message), kErpcStatus_Success);
+    ASSERT_EQ(message.getUsed(), offset + length);
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        ASSERT_EQ(data[offset + i], payloadByte(seed, i)) << "at " << i;
+    }
+}
+
+TEST(FramedTransportTest, SeveralFramesInOneRead)
+{
+    ScriptedFramedTransport transport;
+
+    transport.addChunk(concat(concat(frame(10, 1), frame(0, 2)), frame(30, 3)));
+
+    expectFrame(transport, 10, 1);
+    EXPECT_TRUE(transport.hasMessage());
+    expectFrame(transport, 0, 2);
+    EXPECT_TRUE(transport.hasMessage());
+    expectFrame(transport, 30, 3);
+
+    // All frames were taken from the read-ahead buffer filled by the first read.
+    EXPECT_EQ(transport.m_reads, 1U);
+    EXPECT_EQ(transport.readAheadLength(), 0U);
+}
+
+TEST(FramedTransportTest, FramesSplitAcrossReads)
+{
+    bytes_t stream = concat(frame(40, 1), frame(20, 2));
+
+    // Split in the middle of a header, of a body and between frames.
+    for (uint32_t split = 1; split < stream.size(); ++split)
+    {
+        ScriptedFramedTransport transport;
+
+        transport.addChunk(bytes_t(stream.begin(), stream.begin() + split));
+        transport.addChunk(bytes_t(stream.begin() + split, stream.end()));
+
+        SCOPED_TRACE(split);
+        expectFrame(transport, 40, 1);
+        expectFrame(transport, 20, 2);
+        EXPECT_TRUE(transport.m_chunks.empty());
+    }
+}
+
+TEST(FramedTransportTest, FrameTrickledByteByByte)
+{
+    ScriptedFramedTransport transport;
+    bytes_t stream = concat(frame(50, 1), frame(3, 2));
+
+    for (uint8_t byte : stream)
+    {
+        transport.addChunk(bytes_t(1, byte));
+    }
+
+    expectFrame(transport, 50, 1);
+    expectFrame(transport, 3, 2);
+    EXPECT_TRUE(transport.m_chunks.empty());
+}
+
+TEST(FramedTransportTest, BodyBiggerThanReadAheadIsReceivedDirectly)
+{
+    ScriptedFramedTransport transport;
+    bytes_t big = frame(3U * FRAMED_TEST_READ_AHEAD_SIZE, 1);
+
+    // Header is read ahead and the rest is received into the message.
+    transport.addChunk(concat(big, frame(5, 2)));
+
+    expectFrame(transport, 3U * FRAMED_TEST_READ_AHEAD_SIZE, 1);
+    EXPECT_EQ(transport.m_reads, 2U);
+    expectFrame(transport, 5, 2);
+}
+
+TEST(FramedTransportTest, ResetDropsStaleBytes)
+{
+    ScriptedFramedTransport transport;
+    bytes_t second = frame(20, 2);
+
+    // Read returns first frame and a part of the second one, then the connection is closed.
+    transport.addChunk(concat(frame(10, 1), bytes_t(second.begin(), second.begin() + 7)));
+    expectFrame(transport, 10, 1);
+    EXPECT_EQ(transport.readAheadLength(), 7U);
+
+    transport.dropReadAhead();
+    EXPECT_EQ(transport.readAheadLength(), 0U);
+
+    // Next connection starts with a whole frame, stale bytes would break its header.
+    transport.addChunk(frame(15, 3));
+    expectFrame(transport, 15, 3);
+}
+
+#if !defined(__MINGW32__)
+TEST(FramedTransportTest, TcpCloseDropsStaleBytes)
+{
+    struct sockaddr_in address = {};
+    socklen_t addressLength = sizeof(address);
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+
+    ASSERT_GE(listener, 0);
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    ASSERT_EQ(bind(listener, (struct sockaddr *)&address, sizeof(address)), 0);
+    ASSERT_EQ(listen(listener, 2), 0);
+    ASSERT_EQ(getsockname(listener, (struct sockaddr *)&address, &addressLength), 0);
+
+    InspectedTCPTransport client("127.0.0.1", ntohs(address.sin_port));
+    bytes_t second = frame(20, 2);
+    bytes_t chunk = concat(frame(10, 1), bytes_t(second.begin(), second.begin() + 7));
+    bytes_t third = frame(15, 3);
+
+    ASSERT_EQ(client.open(), kErpcStatus_Success);
+    int peer = accept(listener, NULL, NULL);
+    ASSERT_GE(peer, 0);
+    ASSERT_EQ(write(peer, chunk.data(), chunk.size()), (ssize_t)chunk.size());
+
+    // Let whole chunk arrive, so the first read takes also the part of the second frame.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    expectFrame(client, 10, 1);
+    EXPECT_EQ(client.readAheadLength(), 7U);
+
+    // Reconnect, the new connection starts with a whole frame.
+    EXPECT_EQ(client.close(), kErpcStatus_Success);
+    EXPECT_EQ(client.readAheadLength(), 0U);
+    (void)::close(peer);
+    ASSERT_EQ(client.open(), kErpcStatus_Success);
+    peer = accept(listener, NULL, NULL);
+    ASSERT_GE(peer, 0);
+    ASSERT_EQ(write(peer, third.data(), third.size()), (ssize_t)third.size());
+    expectFrame(client, 15, 3);
+
+    EXPECT_EQ(client.close(), kErpcStatus_Success);
+    (void)::close(peer);
+    (void)::close(listener);
+}
+#endif
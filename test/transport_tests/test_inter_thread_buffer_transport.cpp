@@ -0,0 +1,211 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_inter_thread_buffer_transport.hpp"
+
+#include "gtest.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! Enough messages to fill the ring several times.
+#define INTER_THREAD_TEST_MESSAGES_COUNT (4U * ERPC_INTER_THREAD_QUEUE_SIZE)
+
+#define INTER_THREAD_TEST_SENDERS_COUNT (3U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Heap buffers counted to find leaked ones.
+ */
+class CountingMessageBufferFactory : public MessageBufferFactory
+{
+public:
+    CountingMessageBufferFactory(void) :
+    m_created(0), m_disposed(0)
+    {
+    }
+
+    virtual MessageBuffer create(void) override
+    {
+        (void)m_created.fetch_add(1);
+        return MessageBuffer(new uint8_t[ERPC_DEFAULT_BUFFER_SIZE], ERPC_DEFAULT_BUFFER_SIZE);
+    }
+
+    virtual void dispose(MessageBuffer *buf) override
+    {
+        if (buf->get() != NULL)
+        {
+            (void)m_disposed.fetch_add(1);
+            delete[] buf->get();
+            buf->set(NULL, 0);
+        }
+    }
+
+    std::atomic<uint32_t> m_created;
+    std::atomic<uint32_t> m_disposed;
+};
+
+class InterThreadBufferTransportTest : public ::testing::Test
+{
+protected:
+    CountingMessageBufferFactory m_factory;
+
+    virtual void TearDown(void) override
+    {
+        // Transports of each test are destroyed by now and disposed what they held.
+        EXPECT_EQ(m_factory.m_created.load(), m_factory.m_disposed.load());
+    }
+};
+
+TEST_F(InterThreadBufferTransportTest, SendFailsWithoutFactory)
+{
+    InterThreadBufferTransport client;
+    InterThreadBufferTransport server;
+    MessageBuffer message(m_factory.create());
+    uint8_t *data = message.get();
+
+    client.linkWithPeer(&server);
+    message.setUsed(1);
+    EXPECT_EQ(client.send(&message), kErpcStatus_SendFailed);
+
+    // Only the client has the factory, server would hand out buffers it cannot dispose.
+    client.setMessageBufferFactory(&m_factory);
+    EXPECT_EQ(client.send(&message), kErpcStatus_SendFailed);
+
+    // Message stays with the caller.
+    EXPECT_EQ(message.get(), data);
+    EXPECT_FALSE(server.hasMessage());
+    m_factory.dispose(&message);
+}
+
+TEST_F(InterThreadBufferTransportTest, SendFailsWithDifferentFactories)
+{
+    CountingMessageBufferFactory otherFactory;
+    InterThreadBufferTransport client;
+    InterThreadBufferTransport server;
+    MessageBuffer message(m_factory.create());
+
+    client.linkWithPeer(&server);
+    client.setMessageBufferFactory(&m_factory);
+    server.setMessageBufferFactory(&otherFactory);
+    message.setUsed(1);
+    EXPECT_EQ(client.send(&message), kErpcStatus_SendFailed);
+    EXPECT_FALSE(server.hasMessage());
+    m_factory.dispose(&message);
+}
+
+TEST_F(InterThreadBufferTransportTest, RoundTrip)
+{
+    InterThreadBufferTransport client;
+    InterThreadBufferTransport server;
+
+    client.setMessageBufferFactory(&m_factory);
+    server.setMessageBufferFactory(&m_factory);
+    client.linkWithPeer(&server);
+
+    std::thread serverThread([this, &server]() {
+        MessageBuffer message(m_factory.create());
+
+        for (uint32_t i = 0; i < INTER_THREAD_TEST_MESSAGES_COUNT; ++i)
+        {
+            ASSERT_EQ(server.receive(&message), kErpcStatus_Success);
+            ASSERT_TRUE(message.get() != NULL);
+            ASSERT_EQ(message.getUsed(), 1U);
+            EXPECT_EQ(message.get()[0], (uint8_t)i);
+
+            message.get()[0] = (uint8_t)(i + 1U);
+            ASSERT_EQ(server.send(&message), kErpcStatus_Success);
+            ASSERT_TRUE(message.get() != NULL);
+        }
+
+        m_factory.dispose(&message);
+    });
+
+    MessageBuffer message(m_factory.create());
+
+    for (uint32_t i = 0; i < INTER_THREAD_TEST_MESSAGES_COUNT; ++i)
+    {
+        message.get()[0] = (uint8_t)i;
+        message.setUsed(1);
+        ASSERT_EQ(client.send(&message), kErpcStatus_Success);
+
+        // Sender always gets a buffer back, spare one of the receiver or a new one.
+        ASSERT_TRUE(message.get() != NULL);
+
+        ASSERT_EQ(client.receive(&message), kErpcStatus_Success);
+        ASSERT_TRUE(message.get() != NULL);
+        ASSERT_EQ(message.getUsed(), 1U);
+        EXPECT_EQ(message.get()[0], (uint8_t)(i + 1U));
+    }
+
+    serverThread.join();
+    m_factory.dispose(&message);
+}
+
+TEST_F(InterThreadBufferTransportTest, SendersWaitForFreeSlots)
+{
+    InterThreadBufferTransport client;
+    InterThreadBufferTransport server;
+    uint32_t received[INTER_THREAD_TEST_SENDERS_COUNT] = {};
+    std::thread senders[INTER_THREAD_TEST_SENDERS_COUNT];
+
+    client.setMessageBufferFactory(&m_factory);
+    server.setMessageBufferFactory(&m_factory);
+    client.linkWithPeer(&server);
+
+    // Senders fill the ring before the receiver starts, so they have to block until it frees slots.
+    for (uint32_t sender = 0; sender < INTER_THREAD_TEST_SENDERS_COUNT; ++sender)
+    {
+        senders[sender] = std::thread([this, &client, sender]() {
+            MessageBuffer message(m_factory.create());
+
+            for (uint32_t i = 0; i < INTER_THREAD_TEST_MESSAGES_COUNT; ++i)
+            {
+                message.get()[0] = (uint8_t)sender;
+                message.get()[1] = (uint8_t)i;
+                message.setUsed(2);
+                ASSERT_EQ(client.send(&message), kErpcStatus_Success);
+                ASSERT_TRUE(message.get() != NULL);
+            }
+
+            m_factory.dispose(&message);
+        });
+    }
+
+    MessageBuffer message;
+
+    for (uint32_t i = 0; i < (INTER_THREAD_TEST_SENDERS_COUNT * INTER_THREAD_TEST_MESSAGES_COUNT); ++i)
+    {
+        ASSERT_EQ(server.receive(&message), kErpcStatus_Success);
+        ASSERT_TRUE(message.get() != NULL);
+        ASSERT_EQ(message.getUsed(), 2U);
+        ASSERT_LT(message.get()[0], INTER_THREAD_TEST_SENDERS_COUNT);
+
+        // Messages of one sender keep their order.
+        EXPECT_EQ(message.get()[1], (uint8_t)received[message.get()[0]]);
+        ++received[message.get()[0]];
+
+        // NULL spare buffer is left in the slot, next sender through it gets a new one from the factory.
+        m_factory.dispose(&message);
+    }
+
+    for (uint32_t sender = 0; sender < INTER_THREAD_TEST_SENDERS_COUNT; ++sender)
+    {
+        senders[sender].join();
+        EXPECT_EQ(received[sender], INTER_THREAD_TEST_MESSAGES_COUNT);
+    }
+    EXPECT_FALSE(server.hasMessage());
+}
@@ -0,0 +1,248 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_shm_transport.hpp"
+
+#include "gtest.h"
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+extern "C" {
+#include <sys/mman.h>
+#include <unistd.h>
+}
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! Enough messages to reuse each slot several times.
+#define SHM_TEST_MESSAGES_COUNT (3U * ERPC_TRANSPORT_SHM_SLOTS_COUNT)
+
+#define SHM_TEST_MESSAGE_SIZE (100U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Server and client side of one shared memory, mapped twice like in two processes.
+ */
+class ShmTransportTest : public ::testing::Test
+{
+protected:
+    ShmTransport m_server;
+    ShmTransport m_client;
+
+    virtual void SetUp(void) override
+    {
+        int fd = memfd_create("erpc_shm_transport_test", 0);
+
+        ASSERT_GE(fd, 0);
+        EXPECT_EQ(m_server.open(fd, true), kErpcStatus_Success);
+        EXPECT_EQ(m_client.open(fd, false), kErpcStatus_Success);
+        (void)::close(fd);
+    }
+
+    static void fill(uint8_t *data, uint32_t length, uint8_t seed)
+    {
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            data[i] = (uint8_t)(seed + i);
+        }
+    }
+
+    static bool check(const uint8_t *data, uint32_t length, uint8_t seed)
+    {
+        bool result = true;
+
+        for (uint32_t i = 0; (i < length) && result; ++i)
+        {
+            result = (data[i] == (uint8_t)(seed + i));
+        }
+
+        return result;
+    }
+};
+
+TEST_F(ShmTransportTest, CopiedRoundTrip)
+{
+    std::thread server([this]() {
+        uint8_t data[ERPC_DEFAULT_BUFFER_SIZE];
+        MessageBuffer message(data, sizeof(data));
+
+        for (uint32_t i = 0; i < SHM_TEST_MESSAGES_COUNT; ++i)
+        {
+            ASSERT_EQ(m_server.receive(&message), kErpcStatus_Success);
+            EXPECT_EQ(message.get(), data);
+            ASSERT_EQ(message.getUsed(), SHM_TEST_MESSAGE_SIZE);
+            EXPECT_TRUE(check(data, SHM_TEST_MESSAGE_SIZE, (uint8_t)i));
+
+            // Reply with next seed.
+            fill(data, SHM_TEST_MESSAGE_SIZE, (uint8_t)(i + 1U));
+            ASSERT_EQ(m_server.send(&message), kErpcStatus_Success);
+        }
+    });
+
+    uint8_t data[ERPC_DEFAULT_BUFFER_SIZE];
+    MessageBuffer message(data, sizeof(data));
+
+    for (uint32_t i = 0; i < SHM_TEST_MESSAGES_COUNT; ++i)
+    {
+        fill(data, SHM_TEST_MESSAGE_SIZE, (uint8_t)i);
+        message.setUsed(SHM_TEST_MESSAGE_SIZE);
+        ASSERT_EQ(m_client.send(&message), kErpcStatus_Success);
+
+        // Copied buffer stays owned by caller.
+        EXPECT_EQ(message.get(), data);
+
+        ASSERT_EQ(m_client.receive(&message), kErpcStatus_Success);
+        ASSERT_EQ(message.getUsed(), SHM_TEST_MESSAGE_SIZE);
+        EXPECT_TRUE(check(data, SHM_TEST_MESSAGE_SIZE, (uint8_t)(i + 1U)));
+    }
+
+    server.join();
+}
+
+TEST_F(ShmTransportTest, InPlaceRoundTrip)
+{
+    std::thread server([this]() {
+        MessageBuffer message;
+        MessageBuffer reply;
+
+        for (uint32_t i = 0; i < SHM_TEST_MESSAGES_COUNT; ++i)
+        {
+            // NULL buffer gets the received slot itself.
+            ASSERT_EQ(m_server.receive(&message), kErpcStatus_Success);
+            ASSERT_TRUE(message.get() != NULL);
+            ASSERT_EQ(message.getUsed(), SHM_TEST_MESSAGE_SIZE);
+            EXPECT_TRUE(check(message.get(), SHM_TEST_MESSAGE_SIZE, (uint8_t)i));
+            m_server.release(&message);
+            EXPECT_TRUE(message.get() == NULL);
+
+            reply = m_server.allocate();
+            ASSERT_TRUE(reply.get() != NULL);
+            fill(reply.get(), SHM_TEST_MESSAGE_SIZE, (uint8_t)(i + 1U));
+            reply.setUsed(SHM_TEST_MESSAGE_SIZE);
+            ASSERT_EQ(m_server.send(&reply), kErpcStatus_Success);
+            EXPECT_TRUE(reply.get() == NULL);
+        }
+    });
+
+    MessageBuffer message;
+
+    for (uint32_t i = 0; i < SHM_TEST_MESSAGES_COUNT; ++i)
+    {
+        message = m_client.allocate();
+        ASSERT_TRUE(message.get() != NULL);
+        ASSERT_GE(message.getLength(), ERPC_DEFAULT_BUFFER_SIZE);
+        fill(message.get(), SHM_TEST_MESSAGE_SIZE, (uint8_t)i);
+        message.setUsed(SHM_TEST_MESSAGE_SIZE);
+
+        // Slot is passed to the peer.
+        ASSERT_EQ(m_client.send(&message), kErpcStatus_Success);
+        EXPECT_TRUE(message.get() == NULL);
+
+        ASSERT_EQ(m_client.receive(&message), kErpcStatus_Success);
+        ASSERT_TRUE(message.get() != NULL);
+        ASSERT_EQ(message.getUsed(), SHM_TEST_MESSAGE_SIZE);
+        EXPECT_TRUE(check(message.get(), SHM_TEST_MESSAGE_SIZE, (uint8_t)(i + 1U)));
+        m_client.release(&message);
+    }
+
+    server.join();
+}
+
+TEST_F(ShmTransportTest, InPlaceSendCopiedReceive)
+{
+    uint8_t data[ERPC_DEFAULT_BUFFER_SIZE];
+    MessageBuffer received(data, sizeof(data));
+    MessageBuffer message;
+
+    // Receiver copies each message and returns the slot, so the sender never runs out of slots.
+    for (uint32_t i = 0; i < SHM_TEST_MESSAGES_COUNT; ++i)
+    {
+        message = m_client.allocate();
+        ASSERT_TRUE(message.get() != NULL);
+        fill(message.get(), SHM_TEST_MESSAGE_SIZE, (uint8_t)i);
+        message.setUsed(SHM_TEST_MESSAGE_SIZE);
+        ASSERT_EQ(m_client.send(&message), kErpcStatus_Success);
+
+        EXPECT_TRUE(m_server.hasMessage());
+        ASSERT_EQ(m_server.receive(&received), kErpcStatus_Success);
+        EXPECT_EQ(received.get(), data);
+        ASSERT_EQ(received.getUsed(), SHM_TEST_MESSAGE_SIZE);
+        EXPECT_TRUE(check(data, SHM_TEST_MESSAGE_SIZE, (uint8_t)i));
+        EXPECT_FALSE(m_server.hasMessage());
+    }
+}
+
+TEST_F(ShmTransportTest, CopiedMessageTooBigForReceiver)
+{
+    uint8_t data[SHM_TEST_MESSAGE_SIZE];
+    uint8_t small[SHM_TEST_MESSAGE_SIZE / 2U];
+    MessageBuffer message(data, sizeof(data));
+    MessageBuffer received(small, sizeof(small));
+
+    for (uint32_t i = 0; i < SHM_TEST_MESSAGES_COUNT; ++i)
+    {
+        fill(data, sizeof(data), (uint8_t)i);
+        message.setUsed(sizeof(data));
+        ASSERT_EQ(m_client.send(&message), kErpcStatus_Success);
+        EXPECT_EQ(m_server.receive(&received), kErpcStatus_ReceiveFailed);
+    }
+}
+
+TEST_F(ShmTransportTest, RejectsLengthWrittenByPeer)
+{
+    MessageBuffer slot;
+    MessageBuffer received;
+
+    for (uint32_t i = 0; i < SHM_TEST_MESSAGES_COUNT; ++i)
+    {
+        // Peer claims a message longer than the slot.
+        slot = m_client.allocate();
+        ASSERT_TRUE(slot.get() != NULL);
+        MessageBuffer forged(slot.get(), (message_size_t)(2U * slot.getLength()));
+        forged.setUsed((message_size_t)(slot.getLength() + 1U));
+        ASSERT_EQ(m_client.send(&forged), kErpcStatus_Success);
+
+        // Slot is rejected and returned, otherwise allocate() above blocks once all slots leaked.
+        EXPECT_EQ(m_server.receive(&received), kErpcStatus_ReceiveFailed);
+        EXPECT_TRUE(received.get() == NULL);
+    }
+}
+
+TEST_F(ShmTransportTest, CloseWakesBlockedReceiver)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    std::thread server([this, &status]() {
+        uint8_t data[ERPC_DEFAULT_BUFFER_SIZE];
+        MessageBuffer message(data, sizeof(data));
+
+        status = m_server.receive(&message);
+    });
+
+    // Give the receiver time to stop spinning and sleep on the futex.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    m_client.close();
+    server.join();
+
+    EXPECT_EQ(status, kErpcStatus_ConnectionClosed);
+
+    // Link stays closed for both sides.
+    MessageBuffer slot(m_server.allocate());
+    EXPECT_TRUE(slot.get() == NULL);
+    uint8_t data[SHM_TEST_MESSAGE_SIZE];
+    MessageBuffer message(data, sizeof(data));
+    message.setUsed(sizeof(data));
+    EXPECT_EQ(m_server.send(&message), kErpcStatus_ConnectionClosed);
+}
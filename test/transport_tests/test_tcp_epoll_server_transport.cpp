@@ -0,0 +1,217 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_tcp_epoll_server_transport.hpp"
+#include "erpc_tcp_transport.hpp"
+
+#include "gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <thread>
+#include <vector>
+
+extern "C" {
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+}
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#define EPOLL_TEST_CLIENTS_COUNT (4U)
+
+#define EPOLL_TEST_MESSAGES_COUNT (50U)
+
+//! Reply big enough to fill socket buffers of a peer which does not read in a few sends.
+#define EPOLL_TEST_BIG_REPLY_SIZE (60000U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Epoll server listening on a free loopback port.
+ */
+class LoopbackEpollServerTransport : public TCPEpollServerTransport
+{
+public:
+    explicit LoopbackEpollServerTransport(uint32_t maxConnections) :
+    TCPEpollServerTransport("127.0.0.1", 0, maxConnections)
+    {
+        setCrc16(&m_crc16);
+    }
+
+    uint16_t getPort(void) const
+    {
+        struct sockaddr_in address = {};
+        socklen_t addressLength = sizeof(address);
+
+        (void)getsockname(m_serverSocket, (struct sockaddr *)&address, &addressLength);
+        return ntohs(address.sin_port);
+    }
+
+    Crc16 m_crc16;
+};
+
+/*!
+ * @brief TCP client of the epoll server.
+ */
+class EpollTestClient : public TCPTransport
+{
+public:
+    explicit EpollTestClient(uint16_t port) :
+    TCPTransport("127.0.0.1", port, false)
+    {
+        setCrc16(&m_crc16);
+    }
+
+    Crc16 m_crc16;
+};
+
+//! @brief Sends message with two payload bytes @a first and @a second.
+static erpc_status_t sendRequest(Transport &transport, uint8_t first, uint8_t second)
+{
+    std::vector<uint8_t> data(transport.reserveHeaderSize() + 2U, 0);
+    MessageBuffer message(data.data(), (message_size_t)data.size());
+
+    data[transport.reserveHeaderSize()] = first;
+    data[transport.reserveHeaderSize() + 1U] = second;
+    message.setUsed((message_size_t)data.size());
+
+    return transport.send(&message);
+}
+
+TEST(TcpEpollServerTransportTest, ServesConcurrentClients)
+{
+    LoopbackEpollServerTransport server(EPOLL_TEST_CLIENTS_COUNT);
+    std::thread clients[EPOLL_TEST_CLIENTS_COUNT];
+
+    ASSERT_EQ(server.open(), kErpcStatus_Success);
+    uint16_t port = server.getPort();
+
+    // Each client expects replies to its own requests, in order.
+    for (uint32_t client = 0; client < EPOLL_TEST_CLIENTS_COUNT; ++client)
+    {
+        clients[client] = std::thread([port, client]() {
+            EpollTestClient transport(port);
+            uint8_t data[ERPC_DEFAULT_BUFFER_SIZE];
+            MessageBuffer message(data, sizeof(data));
+            uint32_t offset = transport.reserveHeaderSize();
+
+            ASSERT_EQ(transport.open(), kErpcStatus_Success);
+            for (uint32_t i = 0; i < EPOLL_TEST_MESSAGES_COUNT; ++i)
+            {
+                ASSERT_EQ(sendRequest(transport, (uint8_t)client, (uint8_t)i), kErpcStatus_Success);
+                ASSERT_EQ(transport.receive(&message), kErpcStatus_Success);
+                ASSERT_EQ(message.getUsed(), offset + 2U);
+                EXPECT_EQ(data[offset], (uint8_t)client);
+                EXPECT_EQ(data[offset + 1U], (uint8_t)(i + 1U));
+            }
+            EXPECT_EQ(transport.close(), kErpcStatus_Success);
+        });
+    }
+
+    uint8_t data[ERPC_DEFAULT_BUFFER_SIZE];
+    MessageBuffer message(data, sizeof(data));
+    uint32_t offset = server.reserveHeaderSize();
+
+    for (uint32_t i = 0; i < (EPOLL_TEST_CLIENTS_COUNT * EPOLL_TEST_MESSAGES_COUNT); ++i)
+    {
+        ASSERT_EQ(server.receive(&message), kErpcStatus_Success);
+        ASSERT_EQ(message.getUsed(), offset + 2U);
+        ++data[offset + 1U];
+        ASSERT_EQ(server.send(&message), kErpcStatus_Success);
+    }
+
+    for (uint32_t client = 0; client < EPOLL_TEST_CLIENTS_COUNT; ++client)
+    {
+        clients[client].join();
+    }
+    EXPECT_EQ(server.close(), kErpcStatus_Success);
+}
+
+TEST(TcpEpollServerTransportTest, StalledPeerDoesNotBlockOtherReplies)
+{
+    LoopbackEpollServerTransport server(2);
+    uint8_t data[ERPC_DEFAULT_BUFFER_SIZE];
+    MessageBuffer message(data, sizeof(data));
+    std::vector<uint8_t> big(EPOLL_TEST_BIG_REPLY_SIZE, 0x5A);
+    uint8_t tag[4];
+    std::atomic<uint32_t> sent(0);
+    erpc_status_t stalledStatus = kErpcStatus_Success;
+    uint32_t offset = server.reserveHeaderSize();
+
+    ASSERT_EQ(server.open(), kErpcStatus_Success);
+    EpollTestClient stalled(server.getPort());
+    EpollTestClient other(server.getPort());
+
+    // Stalled peer sends a request and never reads the replies.
+    ASSERT_EQ(stalled.open(), kErpcStatus_Success);
+    ASSERT_EQ(sendRequest(stalled, 1, 0), kErpcStatus_Success);
+    ASSERT_EQ(server.receive(&message), kErpcStatus_Success);
+    (void)memcpy(tag, data, sizeof(tag));
+
+    // Server thread replies until it waits for the full socket.
+    std::thread writer([&server, &big, &tag, &sent, &stalledStatus]() {
+        MessageBuffer reply(big.data(), (message_size_t)big.size());
+
+        do
+        {
+            // Header of the previous reply replaced the routing tag.
+            (void)memcpy(big.data(), tag, sizeof(tag));
+            reply.setUsed((message_size_t)big.size());
+            stalledStatus = server.send(&reply);
+            ++sent;
+        } while (stalledStatus == kErpcStatus_Success);
+    });
+
+    uint32_t lastSent;
+    do
+    {
+        lastSent = sent.load();
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    } while (lastSent != sent.load());
+
+    // Another connection is accepted and served while the writer waits.
+    ASSERT_EQ(other.open(), kErpcStatus_Success);
+    ASSERT_EQ(sendRequest(other, 2, 0), kErpcStatus_Success);
+    std::future<erpc_status_t> served = std::async(std::launch::async, [&server, &message, &data, offset]() {
+        erpc_status_t status = server.receive(&message);
+
+        if (status == kErpcStatus_Success)
+        {
+            ++data[offset + 1U];
+            status = server.send(&message);
+        }
+
+        return status;
+    });
+    bool replied = (served.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    EXPECT_TRUE(replied);
+    if (!replied)
+    {
+        // Unblock the writer, so the test ends.
+        (void)stalled.close();
+    }
+    EXPECT_EQ(served.get(), kErpcStatus_Success);
+    ASSERT_EQ(other.receive(&message), kErpcStatus_Success);
+    EXPECT_EQ(data[offset], 2U);
+    EXPECT_EQ(data[offset + 1U], 1U);
+
+    // Closing wakes up the writer, socket of the connection is closed when it returns.
+    EXPECT_EQ(server.close(), kErpcStatus_Success);
+    writer.join();
+    EXPECT_NE(stalledStatus, kErpcStatus_Success);
+    EXPECT_EQ(server.getConnectionCount(), 0U);
+}
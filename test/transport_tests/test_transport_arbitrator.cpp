@@ -0,0 +1,147 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_transport_arbitrator.hpp"
+
+#include "gtest.h"
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! More clients than fit into the initial table, so it grows several times.
+#define ARBITRATOR_TEST_CLIENTS_COUNT ((4U * ERPC_PENDING_CLIENTS_TABLE_SIZE) + 1U)
+
+#define ARBITRATOR_TEST_BUFFER_SIZE (64U)
+
+typedef std::vector<uint8_t> bytes_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Shared transport receiving queued messages, then reporting closed connection.
+ */
+class ScriptedSharedTransport : public Transport
+{
+public:
+    virtual erpc_status_t receive(MessageBuffer *message) override
+    {
+        erpc_status_t status = kErpcStatus_ConnectionClosed;
+
+        if (!m_messages.empty())
+        {
+            bytes_t &data = m_messages.front();
+            (void)memcpy(message->get(), data.data(), data.size());
+            message->setUsed((message_size_t)data.size());
+            m_messages.pop_front();
+            status = kErpcStatus_Success;
+        }
+
+        return status;
+    }
+
+    virtual erpc_status_t send(MessageBuffer *message) override
+    {
+        (void)message;
+        return kErpcStatus_Success;
+    }
+
+    std::deque<bytes_t> m_messages;
+};
+
+/*!
+ * @brief Client waiting for reply, with its own codec and message buffer.
+ */
+struct PendingTestClient
+{
+    explicit PendingTestClient(uint32_t sequence) :
+    m_data(ARBITRATOR_TEST_BUFFER_SIZE), m_request(sequence, &m_codec, false), m_token(0)
+    {
+        MessageBuffer message(m_data.data(), ARBITRATOR_TEST_BUFFER_SIZE);
+
+        // Received reply is swapped in, this buffer goes to the next received message.
+        m_codec.setBuffer(message);
+    }
+
+    bytes_t m_data;
+    BasicCodec m_codec;
+    RequestContext m_request;
+    TransportArbitrator::client_token_t m_token;
+};
+
+static bytes_t reply(uint32_t sequence, uint32_t value)
+{
+    bytes_t data(ARBITRATOR_TEST_BUFFER_SIZE);
+    MessageBuffer message(data.data(), ARBITRATOR_TEST_BUFFER_SIZE);
+    BasicCodec codec;
+
+    codec.setBuffer(message);
+    codec.startWriteMessage(message_type_t::kReplyMessage, 1, 1, sequence);
+    codec.write(value);
+    data.resize(codec.getBufferRef().getUsed());
+
+    return data;
+}
+
+TEST(TransportArbitratorTest, ManyPendingClients)
+{
+    ScriptedSharedTransport shared;
+    BasicCodec headerCodec;
+    TransportArbitrator arbitrator;
+    std::vector<std::unique_ptr<PendingTestClient>> clients;
+    uint8_t data[ARBITRATOR_TEST_BUFFER_SIZE];
+    MessageBuffer message(data, sizeof(data));
+    message_type_t type;
+    uint32_t service;
+    uint32_t request;
+    uint32_t sequence;
+    uint32_t value;
+
+    arbitrator.setSharedTransport(&shared);
+    arbitrator.setCodec(&headerCodec);
+
+    // Sequences with the same initial slot make long probed runs.
+    for (uint32_t i = 0; i < ARBITRATOR_TEST_CLIENTS_COUNT; ++i)
+    {
+        clients.emplace_back(new PendingTestClient((i % 3U) * 1000U + (i * ERPC_PENDING_CLIENTS_TABLE_SIZE)));
+        clients[i]->m_token = arbitrator.prepareClientReceive(clients[i]->m_request);
+        ASSERT_NE(clients[i]->m_token, 0U) << "client " << i;
+    }
+
+    // Replies arrive in reverse order.
+    for (uint32_t i = ARBITRATOR_TEST_CLIENTS_COUNT; i > 0U; --i)
+    {
+        shared.m_messages.push_back(reply(clients[i - 1U]->m_request.getSequence(), i - 1U));
+    }
+    EXPECT_EQ(arbitrator.receive(&message), kErpcStatus_ConnectionClosed);
+    EXPECT_TRUE(shared.m_messages.empty());
+
+    for (uint32_t i = 0; i < ARBITRATOR_TEST_CLIENTS_COUNT; ++i)
+    {
+        PendingTestClient &client = *clients[i];
+
+        // Reply was already swapped into the client buffer, so this returns at once.
+        arbitrator.clientReceive(client.m_token);
+        ASSERT_EQ(client.m_codec.getStatus(), kErpcStatus_Success);
+        client.m_codec.reset();
+        client.m_codec.startReadMessage(type, service, request, sequence);
+        client.m_codec.read(value);
+        ASSERT_EQ(client.m_codec.getStatus(), kErpcStatus_Success);
+        EXPECT_EQ(sequence, client.m_request.getSequence());
+        EXPECT_EQ(value, i);
+        arbitrator.removePendingClient(client.m_token);
+    }
+}